@@ -47,10 +47,17 @@
 #include <algorithm>
 #endif
 
+#include <cstring>
+#include <filesystem>
 #include <fstream>
 #include <iostream>
+#include <atomic>
 #include <memory>
+#include <mutex>
+#include <shared_mutex>
 #include <string>
+#include <thread>
+#include <chrono>
 #include <unordered_map>
 #include <vector>
 #include <functional>
@@ -91,65 +98,460 @@ public:
 		Mono,
 	};
 
+	// Runtime exports resolved once in Init. Each slot maps to the Il2Cpp and Mono
+	// symbol of the same operation (nullptr when a runtime has no equivalent).
+	enum class Export : std::uint16_t {
+		DomainGet,
+		DomainGetAssemblies,
+		DomainAssemblyOpen,
+		AssemblyForeach,
+		AssemblyGetImage,
+		ImageGetName,
+		ImageGetFilename,
+		ImageGetClassCount,
+		ImageGetClass,
+		ImageGetTableInfo,
+		TableInfoGetRows,
+		ThreadAttach,
+		ThreadDetach,
+		JitThreadAttach,
+		JitThreadDetach,
+		ClassGet,
+		ClassFromName,
+		ClassFromType,
+		ClassGetName,
+		ClassGetNamespace,
+		ClassGetParent,
+		ClassGetFields,
+		ClassGetMethods,
+		ClassGetProperties,
+		ClassGetInterfaces,
+		ClassGetType,
+		ClassIsValueType,
+		ClassIsEnum,
+		ClassVTable,
+		FieldGetName,
+		FieldGetOffset,
+		FieldGetFlags,
+		FieldGetType,
+		FieldGetParent,
+		FieldStaticGetValue,
+		FieldStaticSetValue,
+		PropertyGetName,
+		PropertyGetGetMethod,
+		PropertyGetSetMethod,
+		MethodGetName,
+		MethodGetFlags,
+		MethodGetReturnType,
+		MethodGetParamCount,
+		MethodGetParam,
+		MethodGetParamName,
+		MethodGetParamNames,
+		MethodSignature,
+		MethodDescNew,
+		MethodDescFree,
+		MethodDescSearchInClass,
+		SignatureGetReturnType,
+		SignatureGetParamCount,
+		SignatureGetParams,
+		TypeGetName,
+		TypeGetObject,
+		TypeGetClass,
+		TypeSize,
+		ObjectGetClass,
+		ObjectNew,
+		ObjectUnbox,
+		StringNew,
+		ArrayNew,
+		RuntimeInvoke,
+		CompileMethod,
+		Free,
+		Count
+	};
+
+	struct ExportName {
+		const char* il2cpp;
+		const char* mono;
+	};
+
+	static constexpr ExportName exportNames_[] = {
+		{ "il2cpp_domain_get", "mono_get_root_domain" },
+		{ "il2cpp_domain_get_assemblies", nullptr },
+		{ nullptr, "mono_domain_assembly_open" },
+		{ nullptr, "mono_assembly_foreach" },
+		{ "il2cpp_assembly_get_image", "mono_assembly_get_image" },
+		{ "il2cpp_image_get_name", "mono_image_get_name" },
+		{ "il2cpp_image_get_filename", "mono_image_get_filename" },
+		{ "il2cpp_image_get_class_count", nullptr },
+		{ "il2cpp_image_get_class", nullptr },
+		{ nullptr, "mono_image_get_table_info" },
+		{ nullptr, "mono_table_info_get_rows" },
+		{ "il2cpp_thread_attach", "mono_thread_attach" },
+		{ "il2cpp_thread_detach", "mono_thread_detach" },
+		{ nullptr, "mono_jit_thread_attach" },
+		{ nullptr, "mono_jit_thread_detach" },
+		{ nullptr, "mono_class_get" },
+		{ "il2cpp_class_from_name", "mono_class_from_name" },
+		{ "il2cpp_class_from_type", "mono_class_from_mono_type" },
+		{ "il2cpp_class_get_name", "mono_class_get_name" },
+		{ "il2cpp_class_get_namespace", "mono_class_get_namespace" },
+		{ "il2cpp_class_get_parent", "mono_class_get_parent" },
+		{ "il2cpp_class_get_fields", "mono_class_get_fields" },
+		{ "il2cpp_class_get_methods", "mono_class_get_methods" },
+		{ "il2cpp_class_get_properties", "mono_class_get_properties" },
+		{ "il2cpp_class_get_interfaces", "mono_class_get_interfaces" },
+		{ "il2cpp_class_get_type", "mono_class_get_type" },
+		{ "il2cpp_class_is_valuetype", "mono_class_is_valuetype" },
+		{ "il2cpp_class_is_enum", "mono_class_is_enum" },
+		{ nullptr, "mono_class_vtable" },
+		{ "il2cpp_field_get_name", "mono_field_get_name" },
+		{ "il2cpp_field_get_offset", "mono_field_get_offset" },
+		{ "il2cpp_field_get_flags", "mono_field_get_flags" },
+		{ "il2cpp_field_get_type", "mono_field_get_type" },
+		{ "il2cpp_field_get_parent", "mono_field_get_parent" },
+		{ "il2cpp_field_static_get_value", "mono_field_static_get_value" },
+		{ "il2cpp_field_static_set_value", "mono_field_static_set_value" },
+		{ "il2cpp_property_get_name", "mono_property_get_name" },
+		{ "il2cpp_property_get_get_method", "mono_property_get_get_method" },
+		{ "il2cpp_property_get_set_method", "mono_property_get_set_method" },
+		{ "il2cpp_method_get_name", "mono_method_get_name" },
+		{ "il2cpp_method_get_flags", "mono_method_get_flags" },
+		{ "il2cpp_method_get_return_type", nullptr },
+		{ "il2cpp_method_get_param_count", nullptr },
+		{ "il2cpp_method_get_param", nullptr },
+		{ "il2cpp_method_get_param_name", nullptr },
+		{ nullptr, "mono_method_get_param_names" },
+		{ nullptr, "mono_method_signature" },
+		{ nullptr, "mono_method_desc_new" },
+		{ nullptr, "mono_method_desc_free" },
+		{ nullptr, "mono_method_desc_search_in_class" },
+		{ nullptr, "mono_signature_get_return_type" },
+		{ nullptr, "mono_signature_get_param_count" },
+		{ nullptr, "mono_signature_get_params" },
+		{ "il2cpp_type_get_name", "mono_type_get_name" },
+		{ "il2cpp_type_get_object", "mono_type_get_object" },
+		{ "il2cpp_type_get_class_or_element_class", "mono_type_get_class" },
+		{ nullptr, "mono_type_size" },
+		{ "il2cpp_object_get_class", "mono_object_get_class" },
+		{ "il2cpp_object_new", "mono_object_new" },
+		{ "il2cpp_object_unbox", "mono_object_unbox" },
+		{ "il2cpp_string_new", "mono_string_new" },
+		{ "il2cpp_array_new", "mono_array_new" },
+		{ "il2cpp_runtime_invoke", "mono_runtime_invoke" },
+		{ nullptr, "mono_compile_method" },
+		{ "il2cpp_free", "mono_free" },
+	};
+	static_assert(std::size(exportNames_) == static_cast<std::size_t>(Export::Count), "exportNames_ must have one entry per Export slot");
+
+	// Transparent hash so the metadata indexes can be probed with std::string_view without allocating
+	struct StringHash {
+		using is_transparent = void;
+		auto operator()(const std::string_view value) const noexcept -> std::size_t { return std::hash<std::string_view>{}(value); }
+	};
+
+	template <typename T>
+	using StringMap = std::unordered_map<std::string, T, StringHash, std::equal_to<>>;
+
 	struct Assembly final {
 		void* address;
 		std::string         name;
 		std::string         file;
 		std::vector<std::unique_ptr<Class>> classes;
+		std::unordered_map<std::uint32_t, std::vector<Class*>> classIndex; // Class::nameId -> classes in declaration order
+
+		[[nodiscard]] auto Get(const std::string_view strClass, const std::string_view strNamespace = "*", const std::string_view strParent = "*") const -> Class* {
+			// A name the pool has never seen cannot belong to any class
+			std::uint32_t nameId, namespaceId{}, parentId{};
+			if (!stringPool_.Find(strClass, nameId)) return nullptr;
+			if (strNamespace != "*" && !stringPool_.Find(strNamespace, namespaceId)) return nullptr;
+			if (strParent != "*" && !stringPool_.Find(strParent, parentId)) return nullptr;
+
+			const auto bucket = classIndex.find(nameId);
+			if (bucket == classIndex.end()) return nullptr;
+			for (const auto pClass : bucket->second) if ((strNamespace == "*" || pClass->namespaceId == namespaceId) && (strParent == "*" || pClass->parentId == parentId)) return pClass;
+			return nullptr;
+		}
+	};
+
+	// Type names that get a fixed StringPool id, so callers can switch on Type::id instead of comparing names
+	enum class KnownType : std::uint32_t {
+		None,
+		Void,
+		Boolean,
+		Char,
+		SByte,
+		Byte,
+		Int16,
+		UInt16,
+		Int32,
+		UInt32,
+		Int64,
+		UInt64,
+		Single,
+		Double,
+		String,
+		Object,
+		IntPtr,
+		Vector2,
+		Vector3,
+		Vector4,
+		Quaternion,
+		Color,
+		Count
+	};
 
-		[[nodiscard]] auto Get(const std::string& strClass, const std::string& strNamespace = "*", const std::string& strParent = "*") const -> Class* {
+	static constexpr const char* knownTypeNames_[] = {
+		"",
+		"System.Void",
+		"System.Boolean",
+		"System.Char",
+		"System.SByte",
+		"System.Byte",
+		"System.Int16",
+		"System.UInt16",
+		"System.Int32",
+		"System.UInt32",
+		"System.Int64",
+		"System.UInt64",
+		"System.Single",
+		"System.Double",
+		"System.String",
+		"System.Object",
+		"System.IntPtr",
+		"UnityEngine.Vector2",
+		"UnityEngine.Vector3",
+		"UnityEngine.Vector4",
+		"UnityEngine.Quaternion",
+		"UnityEngine.Color",
+	};
+	static_assert(std::size(knownTypeNames_) == static_cast<std::size_t>(KnownType::Count), "knownTypeNames_ must have one entry per KnownType");
+
+	// C# keyword spellings of the well-known types, seeded right after knownTypeNames_ so their ids are fixed too
+	static constexpr std::pair<const char*, KnownType> knownTypeAliases_[] = {
+		{ "void", KnownType::Void },
+		{ "bool", KnownType::Boolean },
+		{ "char", KnownType::Char },
+		{ "sbyte", KnownType::SByte },
+		{ "byte", KnownType::Byte },
+		{ "short", KnownType::Int16 },
+		{ "ushort", KnownType::UInt16 },
+		{ "int", KnownType::Int32 },
+		{ "uint", KnownType::UInt32 },
+		{ "long", KnownType::Int64 },
+		{ "ulong", KnownType::UInt64 },
+		{ "float", KnownType::Single },
+		{ "double", KnownType::Double },
+		{ "string", KnownType::String },
+		{ "object", KnownType::Object },
+	};
 
-			for (const auto& pClass : classes) if (strClass == pClass->m_name && (strNamespace == "*" || pClass->namespaze == strNamespace) && (strParent == "*" || pClass->parent == strParent)) return pClass.get();
-			return nullptr;
+	// The well-known type a StringPool id names, under either spelling; None for any other name
+	static constexpr auto ToKnownType(const std::uint32_t id) -> KnownType {
+		constexpr auto count = static_cast<std::uint32_t>(KnownType::Count);
+		if (id < count) return static_cast<KnownType>(id);
+		if (id - count < std::size(knownTypeAliases_)) return knownTypeAliases_[id - count].second;
+		return KnownType::None;
+	}
+
+	// Arena-backed intern table for metadata names. Views stay valid (and NUL-terminated) for the process lifetime.
+	class StringPool final {
+	public:
+		StringPool() {
+			for (const auto name : knownTypeNames_) Intern(name);
+			for (const auto& alias : knownTypeAliases_) Intern(alias.first);
+		}
+
+		auto Intern(const std::string_view value, std::uint32_t* id = nullptr) -> std::string_view {
+			// Most calls hit names that are already pooled, so probe under the shared lock first
+			{
+				std::shared_lock lock(mutex_);
+				if (const auto it = ids_.find(value); it != ids_.end()) {
+					if (id) *id = it->second;
+					return views_[it->second];
+				}
+			}
+
+			std::unique_lock lock(mutex_);
+			if (const auto it = ids_.find(value); it != ids_.end()) {
+				if (id) *id = it->second;
+				return views_[it->second];
+			}
+
+			const auto stored = Store(value);
+			const auto newId = static_cast<std::uint32_t>(views_.size());
+			views_.push_back(stored);
+			ids_.emplace(stored, newId);
+			if (id) *id = newId;
+			return stored;
+		}
+
+		auto Intern(const char* value, std::uint32_t* id = nullptr) -> std::string_view { return Intern(value ? std::string_view(value) : std::string_view(), id); }
+
+		// Lookup-only counterpart of Intern, for probing with names that may never have been interned
+		[[nodiscard]] auto Find(const std::string_view value, std::uint32_t& id) const -> bool {
+			std::shared_lock lock(mutex_);
+			const auto it = ids_.find(value);
+			if (it == ids_.end()) return false;
+			id = it->second;
+			return true;
+		}
+
+		[[nodiscard]] auto View(const std::uint32_t id) const -> std::string_view {
+			std::shared_lock lock(mutex_);
+			return id < views_.size() ? views_[id] : std::string_view();
 		}
+
+		[[nodiscard]] auto Count() const -> std::size_t {
+			std::shared_lock lock(mutex_);
+			return views_.size();
+		}
+
+		// Arena bytes in use, including terminators
+		[[nodiscard]] auto Bytes() const -> std::size_t {
+			std::shared_lock lock(mutex_);
+			return bytes_;
+		}
+
+	private:
+		static constexpr std::size_t blockSize_ = 64 * 1024;
+
+		auto Store(const std::string_view value) -> std::string_view {
+			const auto needed = value.size() + 1;
+			if (blocks_.empty() || blockUsed_ + needed > blockCapacity_) {
+				blockCapacity_ = (std::max)(blockSize_, needed);
+				blocks_.push_back(std::make_unique<char[]>(blockCapacity_));
+				blockUsed_ = 0;
+			}
+
+			const auto dest = blocks_.back().get() + blockUsed_;
+			std::memcpy(dest, value.data(), value.size());
+			dest[value.size()] = '\0';
+			blockUsed_ += needed;
+			bytes_ += needed;
+			return { dest, value.size() };
+		}
+
+		mutable std::shared_mutex                             mutex_;
+		std::unordered_map<std::string_view, std::uint32_t> ids_;
+		std::vector<std::string_view>                         views_;
+		std::vector<std::unique_ptr<char[]>>                  blocks_;
+		std::size_t                                           blockUsed_{};
+		std::size_t                                           blockCapacity_{};
+		std::size_t                                           bytes_{};
 	};
 
 	struct Type final {
 		void* address;
-		std::string name;
+		std::string_view name; // interned, see SetName
 		int         size;
+		std::uint32_t id;      // StringPool id of name; ToKnownType maps it to a KnownType for well-known types
+
+		auto SetName(const char* value) -> void { name = stringPool_.Intern(value, &id); }
+		auto SetName(const std::string_view value) -> void { name = stringPool_.Intern(value, &id); }
+
+		[[nodiscard]] auto Is(const KnownType known) const -> bool { return ToKnownType(id) == known; }
 
 		// UnityType::CsType*
 		[[nodiscard]] auto GetCSType() const -> void* {
-			if (mode_ == Mode::Il2Cpp) return Invoke<void*>("il2cpp_type_get_object", address);
-			return Invoke<void*>("mono_type_get_object", pDomain, address);
+			if (mode_ == Mode::Il2Cpp) return Invoke<void*>(Export::TypeGetObject, address);
+			return Invoke<void*>(Export::TypeGetObject, pDomain, address);
 		}
 	};
 
 	struct Class final {
 		void* address;
-		std::string m_name;
-		std::string parent;
-		std::string namespaze;
+		std::string_view m_name;    // interned, see SetName
+		std::string_view parent;    // interned, see SetParent
+		std::string_view namespaze; // interned, see SetNamespace
+		std::uint32_t    nameId{};  // StringPool ids of the three names above
+		std::uint32_t    parentId{};
+		std::uint32_t    namespaceId{};
 		std::vector<std::unique_ptr<Field>>  fields;
 		std::vector<std::unique_ptr<Method>> methods;
 		void* objType;
 
+		std::unordered_map<std::uint32_t, Field*>               fieldIndex;  // first field with a given Field::nameId
+		std::unordered_map<std::uint32_t, std::vector<Method*>> methodIndex; // overload bucket per Method::nameId
+
+		// fields/methods (and their indexes) are filled on first use when lazy members are enabled
+		std::once_flag   membersOnce;
+		std::atomic_bool membersLoaded{};
+
+		std::uint32_t token{};         // image class index (Il2Cpp) or TypeDef token (Mono)
+		const char*   cachedMembers{}; // member record in the metadata cache, if loaded from it
+
+		auto SetName(const char* value) -> void { m_name = stringPool_.Intern(value, &nameId); }
+		auto SetName(const std::string_view value) -> void { m_name = stringPool_.Intern(value, &nameId); }
+		auto SetParent(const char* value) -> void { parent = stringPool_.Intern(value, &parentId); }
+		auto SetParent(const std::string_view value) -> void { parent = stringPool_.Intern(value, &parentId); }
+		auto SetNamespace(const char* value) -> void { namespaze = stringPool_.Intern(value, &namespaceId); }
+		auto SetNamespace(const std::string_view value) -> void { namespaze = stringPool_.Intern(value, &namespaceId); }
+
+		auto EnsureMembers() -> void {
+			std::call_once(membersOnce, [this] {
+				if (cachedMembers) LoadCachedMembers(this);
+				else ForeachMember(this);
+				membersLoaded.store(true, std::memory_order_release);
+			});
+		}
+
+		[[nodiscard]] auto MembersLoaded() const -> bool { return membersLoaded.load(std::memory_order_acquire); }
+
+		auto GetFields() -> std::vector<std::unique_ptr<Field>>& {
+			EnsureMembers();
+			return fields;
+		}
+
+		auto GetMethods() -> std::vector<std::unique_ptr<Method>>& {
+			EnsureMembers();
+			return methods;
+		}
+
 		template <typename RType>
-		auto Get(const std::string& name, const std::vector<std::string>& args = {}) -> RType* {
+		auto Get(const std::string_view name, const std::vector<std::string>& args = {}) -> RType* {
+			EnsureMembers();
+
+			std::uint32_t nameId;
+			if (!stringPool_.Find(name, nameId)) return nullptr;
 
-			if constexpr (std::is_same_v<RType, Field>) for (const auto& pField : fields) if (pField->name == name) return static_cast<RType*>(pField.get());
-			if constexpr (std::is_same_v<RType, std::int32_t>) for (const auto& pField : fields) if (pField->name == name) return reinterpret_cast<RType*>(pField->offset);
+			if constexpr (std::is_same_v<RType, Field>) if (const auto it = fieldIndex.find(nameId); it != fieldIndex.end()) return static_cast<RType*>(it->second);
+			if constexpr (std::is_same_v<RType, std::int32_t>) if (const auto it = fieldIndex.find(nameId); it != fieldIndex.end()) return reinterpret_cast<RType*>(it->second->offset);
 			if constexpr (std::is_same_v<RType, Method>) {
-				for (const auto& pMethod : methods) {
-					if (pMethod->name == name) {
-						if (pMethod->m_args.empty() && args.empty()) return static_cast<RType*>(pMethod.get());
-						if (pMethod->m_args.size() == args.size()) {
-							size_t index{ 0 };
-							for (size_t i{ 0 }; const auto& typeName : args) {
-								if (typeName == "*" || typeName.empty() ? true : pMethod->m_args[i].get()->pType->name == typeName) index++;
-								i++;
-							}
-							if (index == pMethod->m_args.size()) return static_cast<RType*>(pMethod.get());
-						}
+				const auto bucket = methodIndex.find(nameId);
+				if (bucket == methodIndex.end()) return nullptr;
+
+				// "*" or an empty name matches any argument type; a type name the pool never saw matches no overload
+				constexpr auto anyType = UINT32_MAX;
+				std::vector<std::uint32_t> argIds(args.size(), anyType);
+				bool resolvable = true;
+				for (size_t i{ 0 }; i < args.size() && resolvable; i++) {
+					if (args[i] != "*" && !args[i].empty()) resolvable = stringPool_.Find(args[i], argIds[i]);
+				}
+
+				if (resolvable) {
+					for (const auto pMethod : bucket->second) {
+						if (pMethod->m_args.size() != args.size()) continue;
+						size_t i{ 0 };
+						while (i < argIds.size() && (argIds[i] == anyType || pMethod->m_args[i]->pType->id == argIds[i])) i++;
+						if (i == argIds.size()) return static_cast<RType*>(pMethod);
 					}
 				}
 
-				for (const auto& pMethod : methods) if (pMethod->name == name) return static_cast<RType*>(pMethod.get());
+				return static_cast<RType*>(bucket->second.front());
 			}
 			return nullptr;
 		}
 
+		auto BuildIndex() -> void {
+			fieldIndex.clear();
+			methodIndex.clear();
+			fieldIndex.reserve(fields.size());
+			methodIndex.reserve(methods.size());
+
+			for (const auto& pField : fields) fieldIndex.try_emplace(pField->nameId, pField.get());
+			for (const auto& pMethod : methods) methodIndex[pMethod->nameId].push_back(pMethod.get());
+		}
+
 		template <typename RType>
 		auto GetValue(void* obj, const std::string& name) -> RType { return *reinterpret_cast<RType*>(reinterpret_cast<uintptr_t>(obj) + Get<Field>(name)->offset); }
 
@@ -166,12 +568,12 @@ public:
 		[[nodiscard]] auto GetType() -> void* {
 			if (objType) return objType;
 			if (mode_ == Mode::Il2Cpp) {
-				const auto pUType = Invoke<void*, void*>("il2cpp_class_get_type", address);
-				objType = Invoke<void*>("il2cpp_type_get_object", pUType);
+				const auto pUType = Invoke<void*, void*>(Export::ClassGetType, address);
+				objType = Invoke<void*>(Export::TypeGetObject, pUType);
 				return objType;
 			}
-			const auto pUType = Invoke<void*, void*>("mono_class_get_type", address);
-			objType = Invoke<void*>("mono_type_get_object", pDomain, pUType);
+			const auto pUType = Invoke<void*, void*>(Export::ClassGetType, address);
+			objType = Invoke<void*>(Export::TypeGetObject, pDomain, pUType);
 			return objType;
 		}
 
@@ -213,34 +615,38 @@ public:
 
 		template <typename T>
 		auto New() -> T* {
-			if (mode_ == Mode::Il2Cpp) return Invoke<T*, void*>("il2cpp_object_new", address);
-			return Invoke<T*, void*, void*>("mono_object_new", pDomain, address);
+			if (mode_ == Mode::Il2Cpp) return Invoke<T*, void*>(Export::ObjectNew, address);
+			return Invoke<T*, void*, void*>(Export::ObjectNew, pDomain, address);
 		}
 	};
 
 	struct Field final {
 		void* address;
-		std::string name;
+		std::string_view name; // interned, see SetName
+		std::uint32_t nameId{};
 		std::unique_ptr<Type> type;
 		Class* klass;
 		std::int32_t offset; // If offset is -1, then it's thread static
 		bool static_field;
 		void* vTable;
 
+		auto SetName(const char* value) -> void { name = stringPool_.Intern(value, &nameId); }
+		auto SetName(const std::string_view value) -> void { name = stringPool_.Intern(value, &nameId); }
+
 		template <typename T>
 		auto SetStaticValue(T* value) const -> void {
 			if (!static_field) return;
-			if (mode_ == Mode::Il2Cpp) return Invoke<void, void*, T*>("il2cpp_field_static_set_value", address, value);
-			const auto VTable = Invoke<void*>("mono_class_vtable", pDomain, klass->address);
-			return Invoke<void, void*, void*, T*>("mono_field_static_set_value", VTable, address, value);
+			if (mode_ == Mode::Il2Cpp) return Invoke<void, void*, T*>(Export::FieldStaticSetValue, address, value);
+			const auto VTable = Invoke<void*>(Export::ClassVTable, pDomain, klass->address);
+			return Invoke<void, void*, void*, T*>(Export::FieldStaticSetValue, VTable, address, value);
 		}
 
 		template <typename T>
 		auto GetStaticValue(T* value) const -> void {
 			if (!static_field) return;
-			if (mode_ == Mode::Il2Cpp) return Invoke<void, void*, T*>("il2cpp_field_static_get_value", address, value);
-			const auto VTable = Invoke<void*>("mono_class_vtable", pDomain, klass->address);
-			return Invoke<void, void*, void*, T*>("mono_field_static_get_value", VTable, address, value);
+			if (mode_ == Mode::Il2Cpp) return Invoke<void, void*, T*>(Export::FieldStaticGetValue, address, value);
+			const auto VTable = Invoke<void*>(Export::ClassVTable, pDomain, klass->address);
+			return Invoke<void, void*, void*, T*>(Export::FieldStaticGetValue, VTable, address, value);
 		}
 
 		template <typename T, typename C>
@@ -272,7 +678,8 @@ public:
 
 	struct Method final {
 		void* address;
-		std::string  name;
+		std::string_view name; // interned, see SetName
+		std::uint32_t nameId{};
 		Class* klass;
 		std::unique_ptr<Type> return_type;
 		std::int32_t flags;
@@ -280,12 +687,15 @@ public:
 		void* function;
 
 		struct Arg {
-			std::string name;
+			std::string_view name; // interned
 			std::unique_ptr<Type> pType;
 		};
 
 		std::vector<std::unique_ptr<Arg>> m_args;
 
+		auto SetName(const char* value) -> void { name = stringPool_.Intern(value, &nameId); }
+		auto SetName(const std::string_view value) -> void { name = stringPool_.Intern(value, &nameId); }
+
 		template <typename Return, typename... Args>
 		auto Invoke(Args... args) -> Return {
 
@@ -298,7 +708,7 @@ public:
 
 			if (address && !function && mode_ == Mode::Mono) {
 				ThreadAttach();
-				function = UnityResolve::Invoke<void*>("mono_compile_method", address);
+				function = UnityResolve::Invoke<void*>(Export::CompileMethod, address);
 			}
 		}
 
@@ -308,20 +718,20 @@ public:
 
 			if (mode_ == Mode::Il2Cpp) {
 				if constexpr (std::is_void_v<Return>) {
-					UnityResolve::Invoke<void*>("il2cpp_runtime_invoke", address, obj, sizeof...(Args) ? argArray : nullptr, nullptr);
+					UnityResolve::Invoke<void*>(Export::RuntimeInvoke, address, obj, sizeof...(Args) ? argArray : nullptr, nullptr);
 					return;
 				}
-				else return Unbox<Return>(Invoke<void*>("il2cpp_runtime_invoke", address, obj, sizeof...(Args) ? argArray : nullptr, nullptr));
+				else return Unbox<Return>(UnityResolve::Invoke<void*>(Export::RuntimeInvoke, address, obj, sizeof...(Args) ? argArray : nullptr, nullptr));
 			}
 			Compile();
 
 			if constexpr (std::is_void_v<Return>) {
-				UnityResolve::Invoke<void*>("mono_runtime_invoke", address, obj, sizeof...(Args) ? argArray : nullptr, nullptr);
+				UnityResolve::Invoke<void*>(Export::RuntimeInvoke, address, obj, sizeof...(Args) ? argArray : nullptr, nullptr);
 				return;
 			}
 			else {
 				void* exc = nullptr;
-				void* result = UnityResolve::Invoke<void*>("mono_runtime_invoke", address, obj, sizeof...(Args) ? argArray : nullptr, &exc);
+				void* result = UnityResolve::Invoke<void*>(Export::RuntimeInvoke, address, obj, sizeof...(Args) ? argArray : nullptr, &exc);
 				if (exc != nullptr) {
 					std::cout << "Mono runtime exception occurred!" << std::endl;
 					return Return();
@@ -367,9 +777,9 @@ public:
 		template <typename T>
 		T Unbox(void* obj) {
 			if (mode_ == Mode::Il2Cpp) {
-				return static_cast<T>(Invoke<void*>("il2cpp_object_unbox", obj));
+				return static_cast<T>(UnityResolve::Invoke<void*>(Export::ObjectUnbox, obj));
 			}
-			return static_cast<T>(Invoke<void*>("mono_object_unbox", obj));
+			return static_cast<T>(UnityResolve::Invoke<void*>(Export::ObjectUnbox, obj));
 		}
 	};
 
@@ -377,16 +787,16 @@ public:
 	public:
 		explicit AssemblyLoad(const std::string& path, std::string namespaze = "", std::string className = "", std::string desc = "") {
 			if (mode_ == Mode::Mono) {
-				assembly = Invoke<void*>("mono_domain_assembly_open", pDomain, path.data());
-				image = Invoke<void*>("mono_assembly_get_image", assembly);
+				assembly = Invoke<void*>(Export::DomainAssemblyOpen, pDomain, path.data());
+				image = Invoke<void*>(Export::AssemblyGetImage, assembly);
 				if (namespaze.empty() || className.empty() || desc.empty()) {
 					return;
 				}
-				klass = Invoke<void*>("mono_class_from_name", image, namespaze.data(), className.data());
-				const auto entry_point_method_desc = Invoke<void*>("mono_method_desc_new", desc.data(), true);
-				method = Invoke<void*>("mono_method_desc_search_in_class", entry_point_method_desc, klass);
-				Invoke<void>("mono_method_desc_free", entry_point_method_desc);
-				Invoke<void*>("mono_runtime_invoke", method, nullptr, nullptr, nullptr);
+				klass = Invoke<void*>(Export::ClassFromName, image, namespaze.data(), className.data());
+				const auto entry_point_method_desc = Invoke<void*>(Export::MethodDescNew, desc.data(), true);
+				method = Invoke<void*>(Export::MethodDescSearchInClass, entry_point_method_desc, klass);
+				Invoke<void>(Export::MethodDescFree, entry_point_method_desc);
+				Invoke<void*>(Export::RuntimeInvoke, method, nullptr, nullptr, nullptr);
 			}
 		}
 
@@ -397,44 +807,45 @@ public:
 	};
 
 	static auto ThreadAttach() -> void {
-		if (mode_ == Mode::Il2Cpp) Invoke<void*>("il2cpp_thread_attach", pDomain);
+		if (mode_ == Mode::Il2Cpp) Invoke<void*>(Export::ThreadAttach, pDomain);
 		else {
-			Invoke<void*>("mono_thread_attach", pDomain);
-			Invoke<void*>("mono_jit_thread_attach", pDomain);
+			Invoke<void*>(Export::ThreadAttach, pDomain);
+			Invoke<void*>(Export::JitThreadAttach, pDomain);
 		}
 	}
 
 	static auto ThreadDetach() -> void {
-		if (mode_ == Mode::Il2Cpp) Invoke<void*>("il2cpp_thread_detach", pDomain);
+		if (mode_ == Mode::Il2Cpp) Invoke<void*>(Export::ThreadDetach, pDomain);
 		else {
-			Invoke<void*>("mono_thread_detach", pDomain);
-			Invoke<void*>("mono_jit_thread_detach", pDomain);
+			Invoke<void*>(Export::ThreadDetach, pDomain);
+			Invoke<void*>(Export::JitThreadDetach, pDomain);
 		}
 	}
 
 	static auto Init(void* hmodule, const Mode mode = Mode::Mono) -> void {
 		mode_ = mode;
 		hmodule_ = hmodule;
+		ResolveExports();
 
 		if (mode_ == Mode::Il2Cpp) {
 			do {
-				pDomain = Invoke<void*>("il2cpp_domain_get");
+				pDomain = Invoke<void*>(Export::DomainGet);
 				if (pDomain) break;
 				std::this_thread::sleep_for(std::chrono::milliseconds(10));
 			} while (true);
-			Invoke<void*>("il2cpp_thread_attach", pDomain);
+			Invoke<void*>(Export::ThreadAttach, pDomain);
 
 			ForeachAssembly();
 		}
 		else {
 			do {
-				pDomain = Invoke<void*>("mono_get_root_domain");
+				pDomain = Invoke<void*>(Export::DomainGet);
 				if (pDomain) break;
 				std::this_thread::sleep_for(std::chrono::milliseconds(10));
 			} while (true);
 
-			Invoke<void*>("mono_thread_attach", pDomain);
-			Invoke<void*>("mono_jit_thread_attach", pDomain);
+			Invoke<void*>(Export::ThreadAttach, pDomain);
+			Invoke<void*>(Export::JitThreadAttach, pDomain);
 
 			ForeachAssembly();
 		}
@@ -447,11 +858,12 @@ public:
 
 		for (const auto& pAssembly : assembly) {
 			for (const auto& pClass : pAssembly->classes) {
+				pClass->EnsureMembers();
 				io << std::format("\tnamespace: {}", pClass->namespaze.empty() ? "" : pClass->namespaze);
 				io << "\n";
 				io << std::format("\tAssembly: {}\n", pAssembly->name.empty() ? "" : pAssembly->name);
 				io << std::format("\tAssemblyFile: {} \n", pAssembly->file.empty() ? "" : pAssembly->file);
-				io << std::format("\tclass {}{} ", pClass->m_name, pClass->parent.empty() ? "" : " : " + pClass->parent);
+				io << std::format("\tclass {}{} ", pClass->m_name, pClass->parent.empty() ? "" : std::string(" : ").append(pClass->parent));
 				io << "{\n\n";
 				for (const auto& pField : pClass->fields) io << std::format("\t\t{:+#06X} | {}{} {};\n", pField->offset, pField->static_field ? "static " : "", pField->type->name, pField->name);
 				io << "\n";
@@ -478,11 +890,12 @@ public:
 
 		for (const auto& pAssembly : assembly) {
 			for (const auto& pClass : pAssembly->classes) {
+				pClass->EnsureMembers();
 				io2 << std::format("\tnamespace: {}", pClass->namespaze.empty() ? "" : pClass->namespaze);
 				io2 << "\n";
 				io2 << std::format("\tAssembly: {}\n", pAssembly->name.empty() ? "" : pAssembly->name);
 				io2 << std::format("\tAssemblyFile: {} \n", pAssembly->file.empty() ? "" : pAssembly->file);
-				io2 << std::format("\tstruct {}{} ", pClass->m_name, pClass->parent.empty() ? "" : " : " + pClass->parent);
+				io2 << std::format("\tstruct {}{} ", pClass->m_name, pClass->parent.empty() ? "" : std::string(" : ").append(pClass->parent));
 				io2 << "{\n\n";
 
 				for (size_t i = 0; i < pClass->fields.size(); i++) {
@@ -500,7 +913,7 @@ public:
 					goto next;
 				}
 
-				std::string name = field->name;
+				std::string name(field->name);
 				std::ranges::replace(name, '<', '_');
 				std::ranges::replace(name, '>', '_');
 
@@ -663,110 +1076,616 @@ public:
 		return Return();
 	}
 
+	// Indexed counterpart of Invoke(funcName, ...): no string hashing, one table load per call.
+	template <typename Return, typename... Args>
+	static auto Invoke(const Export slot, Args... args) -> Return {
+		if (const auto function = exports_[static_cast<std::size_t>(slot)]) {
+			try {
+				return reinterpret_cast<MethodPointer<Return, Args...>>(function)(args...);
+			}
+			catch (...) {
+				return Return();
+			}
+		}
+		return Return();
+	}
+
+	// Raw function pointer for hot loops that want to hoist the table load out of the loop.
+	template <typename Return, typename... Args>
+	[[nodiscard]] static auto GetExport(const Export slot) -> MethodPointer<Return, Args...> {
+		return reinterpret_cast<MethodPointer<Return, Args...>>(exports_[static_cast<std::size_t>(slot)]);
+	}
+
+	[[nodiscard]] static auto HasExport(const Export slot) -> bool {
+		return exports_[static_cast<std::size_t>(slot)] != nullptr;
+	}
+
+	[[nodiscard]] static auto GetExportName(const Export slot) -> const char* {
+		const auto& names = exportNames_[static_cast<std::size_t>(slot)];
+		return mode_ == Mode::Il2Cpp ? names.il2cpp : names.mono;
+	}
+
 	inline static std::vector<std::unique_ptr<Assembly>> assembly;
 
 	static auto Get(const std::string& strAssembly) -> Assembly* {
-		for (const auto& pAssembly : assembly) if (pAssembly->name == strAssembly) return pAssembly.get();
-		return nullptr;
+		const auto it = assemblyIndex_.find(strAssembly);
+		return it != assemblyIndex_.end() ? it->second : nullptr;
+	}
+
+	// "Namespace.Name" (or just "Name" for classes without a namespace); first match across all assemblies
+	[[nodiscard]] static auto GetClass(const std::string_view fullName) -> Class* {
+		const auto it = classByFullName_.find(fullName);
+		return it != classByFullName_.end() ? it->second : nullptr;
+	}
+
+	// Every class whose short name matches, in assembly enumeration order
+	[[nodiscard]] static auto GetClassesByName(const std::string_view name) -> const std::vector<Class*>& {
+		static const std::vector<Class*> empty;
+		std::uint32_t nameId;
+		if (!stringPool_.Find(name, nameId)) return empty;
+		const auto it = classByName_.find(nameId);
+		return it != classByName_.end() ? it->second : empty;
+	}
+
+	[[nodiscard]] static auto GetClassByHandle(void* handle) -> Class* {
+		const auto it = classByHandle_.find(handle);
+		return it != classByHandle_.end() ? it->second : nullptr;
+	}
+
+	// Must be set before Init; Class members are then resolved on first GetFields/GetMethods/Get instead of at startup
+	static auto SetLazyMembers(const bool enabled) -> void { lazyMembers_ = enabled; }
+
+	[[nodiscard]] static auto LazyMembers() -> bool { return lazyMembers_; }
+
+	struct ImageTiming {
+		std::string name; // empty if the image failed to load
+		std::size_t classes{};
+		double      milliseconds{};
+	};
+
+	// Must be set before Init; 0 or 1 walks the images on the calling thread
+	static auto SetInitWorkers(const unsigned count) -> void { initWorkers_ = count; }
+
+	// Per-image enumeration cost of the last ForeachAssembly, in runtime order
+	[[nodiscard]] static auto GetImageTimings() -> const std::vector<ImageTiming>& { return imageTimings_; }
+
+	[[nodiscard]] static auto GetInitWorkersUsed() -> unsigned { return initWorkersUsed_; }
+
+	[[nodiscard]] static auto GetWalkMilliseconds() -> double { return walkMilliseconds_; }
+
+	// Must be set before Init; an empty path disables the on-disk metadata cache.
+	// A miss writes the file from a full member walk, which defeats lazy members for that run only;
+	// there is no shutdown point to persist members loaded later, so this is the deliberate tradeoff
+	static auto SetMetadataCache(const std::string& path) -> void { cachePath_ = path; }
+
+	[[nodiscard]] static auto LoadedFromCache() -> bool { return loadedFromCache_; }
+
+	[[nodiscard]] static auto GetStringPool() -> StringPool& { return stringPool_; }
+
+	// Must be called again whenever `assembly` is repopulated; ForeachAssembly does this itself
+	static auto RebuildIndex() -> void {
+		assemblyIndex_.clear();
+		classByFullName_.clear();
+		classByName_.clear();
+		classByHandle_.clear();
+		assemblyIndex_.reserve(assembly.size());
+
+		std::string fullName;
+		for (const auto& pAssembly : assembly) {
+			assemblyIndex_.try_emplace(pAssembly->name, pAssembly.get());
+
+			pAssembly->classIndex.clear();
+			pAssembly->classIndex.reserve(pAssembly->classes.size());
+			for (const auto& pClass : pAssembly->classes) {
+				pAssembly->classIndex[pClass->nameId].push_back(pClass.get());
+				classByName_[pClass->nameId].push_back(pClass.get());
+				classByHandle_.try_emplace(pClass->address, pClass.get());
+
+				fullName.clear();
+				if (!pClass->namespaze.empty()) fullName.append(pClass->namespaze).append(".");
+				fullName.append(pClass->m_name);
+				classByFullName_.try_emplace(fullName, pClass.get());
+			}
+		}
 	}
 
 private:
+	static auto ResolveExports() -> void {
+		for (std::size_t i = 0; i < static_cast<std::size_t>(Export::Count); i++) {
+			const auto funcName = GetExportName(static_cast<Export>(i));
+			if (!funcName) {
+				exports_[i] = nullptr;
+				continue;
+			}
+#if WINDOWS_MODE
+			exports_[i] = static_cast<void*>(GetProcAddress(static_cast<HMODULE>(hmodule_), funcName));
+#elif  ANDROID_MODE || LINUX_MODE || IOS_MODE || HARMONYOS_MODE
+			exports_[i] = dlsym(hmodule_, funcName);
+#endif
+		}
+	}
+
 	static auto ForeachAssembly() -> void {
+		const auto walkStart = std::chrono::steady_clock::now();
+
+		std::vector<void*> handles;
 		if (mode_ == Mode::Il2Cpp) {
 			size_t     nrofassemblies = 0;
-			const auto assemblies = Invoke<void**>("il2cpp_domain_get_assemblies", pDomain, &nrofassemblies);
-			for (auto i = 0; i < nrofassemblies; i++) {
-				const auto ptr = assemblies[i];
-				if (ptr == nullptr) continue;
-				auto       pAssembly = std::make_unique<Assembly>(Assembly{ .address = ptr });
-				const auto image = Invoke<void*>("il2cpp_assembly_get_image", ptr);
-				pAssembly->file = Invoke<const char*>("il2cpp_image_get_filename", image);
-				pAssembly->name = Invoke<const char*>("il2cpp_image_get_name", image);
-				ForeachClass(pAssembly.get(), image);
-				assembly.push_back(std::move(pAssembly));
+			const auto assemblies = Invoke<void**>(Export::DomainGetAssemblies, pDomain, &nrofassemblies);
+			for (auto i = 0; i < nrofassemblies; i++) if (assemblies[i] != nullptr) handles.push_back(assemblies[i]);
+		}
+		else {
+			Invoke<void*, void(*)(void* ptr, std::vector<void*>&), std::vector<void*>&>(Export::AssemblyForeach,
+				[](void* ptr, std::vector<void*>& v) {
+					if (ptr != nullptr) v.push_back(ptr);
+				}, handles);
+		}
+
+		const auto cacheKey = cachePath_.empty() ? 0 : ComputeCacheKey(handles);
+		if (!cachePath_.empty() && LoadMetadataCache(handles, cacheKey)) {
+			imageTimings_.clear();
+			initWorkersUsed_ = 1;
+			loadedFromCache_ = true;
+			walkMilliseconds_ = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - walkStart).count();
+			RebuildIndex();
+			return;
+		}
+
+		// Every image lands in its own slot so the merge below keeps the runtime's enumeration order
+		std::vector<std::unique_ptr<Assembly>> loaded(handles.size());
+		std::vector<ImageTiming>               timings(handles.size());
+		const auto loadImage = [&](const std::size_t index) {
+			const auto imageStart = std::chrono::steady_clock::now();
+			try {
+				loaded[index] = LoadAssembly(handles[index]);
 			}
+			catch (...) {}
+			if (loaded[index]) timings[index] = ImageTiming{ .name = loaded[index]->name, .classes = loaded[index]->classes.size() };
+			timings[index].milliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - imageStart).count();
+		};
+
+		const auto workerCount = std::min<std::size_t>(initWorkers_, handles.size());
+		if (workerCount > 1) {
+			std::atomic_size_t       next{};
+			std::vector<std::thread> workers;
+			workers.reserve(workerCount);
+			for (std::size_t w = 0; w < workerCount; w++) {
+				workers.emplace_back([&] {
+					const auto thread = Invoke<void*>(Export::ThreadAttach, pDomain);
+					for (std::size_t i; (i = next.fetch_add(1, std::memory_order_relaxed)) < handles.size();) loadImage(i);
+					if (thread) Invoke<void>(Export::ThreadDetach, thread);
+				});
+			}
+			for (auto& worker : workers) worker.join();
 		}
 		else {
-			Invoke<void*, void(*)(void* ptr, std::vector<std::unique_ptr<Assembly>>&), std::vector<std::unique_ptr<Assembly>>&>("mono_assembly_foreach",
-				[](void* ptr, std::vector<std::unique_ptr<Assembly>>& v) {
-					if (ptr == nullptr) return;
+			for (std::size_t i = 0; i < handles.size(); i++) loadImage(i);
+		}
 
-					auto assembly = std::make_unique<Assembly>(Assembly{ .address = ptr });
-					try {
-						const auto image = Invoke<void*>("mono_assembly_get_image", ptr);
-						assembly->file = Invoke<const char*>("mono_image_get_filename", image);
-						assembly->name = Invoke<const char*>("mono_image_get_name", image);
-						assembly->name += ".dll";
-						ForeachClass(assembly.get(), image);
-						v.push_back(std::move(assembly));
+		for (auto& pAssembly : loaded) if (pAssembly) assembly.push_back(std::move(pAssembly));
+		imageTimings_ = std::move(timings);
+		initWorkersUsed_ = workerCount > 1 ? static_cast<unsigned>(workerCount) : 1;
+		walkMilliseconds_ = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - walkStart).count();
+
+		// Writing needs every member, so a lazy first run pays the full walk once per game build (see SetMetadataCache)
+		if (!cachePath_.empty()) WriteMetadataCache(cacheKey);
+
+		RebuildIndex();
+	}
+
+	static auto LoadAssembly(void* ptr) -> std::unique_ptr<Assembly> {
+		auto       pAssembly = std::make_unique<Assembly>(Assembly{ .address = ptr });
+		const auto image = Invoke<void*>(Export::AssemblyGetImage, ptr);
+		pAssembly->file = Invoke<const char*>(Export::ImageGetFilename, image);
+		pAssembly->name = Invoke<const char*>(Export::ImageGetName, image);
+		if (mode_ == Mode::Mono) pAssembly->name += ".dll";
+		ForeachClass(pAssembly.get(), image);
+		return pAssembly;
+	}
+
+	// On-disk metadata cache: a string pool followed by a class section and a member section. Classes are
+	// re-resolved through their metadata token at load, members only once EnsureMembers runs for the class.
+	static constexpr std::uint32_t cacheVersion_ = 1;
+
+	struct CacheHeader {
+		char          magic[4];
+		std::uint32_t version;
+		std::uint64_t key;
+		std::uint32_t assemblyCount;
+		std::uint32_t stringBytes;
+		std::uint32_t classBytes;
+		std::uint32_t memberBytes;
+	};
+
+	struct CacheWriter {
+		std::string                                    strings;
+		StringMap<std::uint32_t>                       stringOffsets;
+
+		template <typename T>
+		static auto Write(std::string& out, const T& value) -> void { out.append(reinterpret_cast<const char*>(&value), sizeof(T)); }
+
+		auto WriteString(std::string& out, const std::string_view value) -> void {
+			auto it = stringOffsets.find(value);
+			if (it == stringOffsets.end()) {
+				it = stringOffsets.emplace(std::string(value), static_cast<std::uint32_t>(strings.size())).first;
+				strings += value;
+			}
+			Write(out, it->second);
+			Write(out, static_cast<std::uint32_t>(value.size()));
+		}
+	};
+
+	struct CacheReader {
+		const char* cursor;
+		const char* end;
+		const char* strings;
+		std::uint32_t stringBytes;
+
+		template <typename T>
+		auto Read(T& value) -> bool {
+			if (static_cast<std::size_t>(end - cursor) < sizeof(T)) return false;
+			std::memcpy(&value, cursor, sizeof(T));
+			cursor += sizeof(T);
+			return true;
+		}
+
+		auto ReadView(std::string_view& value) -> bool {
+			std::uint32_t offset, length;
+			if (!Read(offset) || !Read(length)) return false;
+			if (offset > stringBytes || length > stringBytes - offset) return false;
+			value = std::string_view(strings + offset, length);
+			return true;
+		}
+
+		auto ReadString(std::string& value) -> bool {
+			std::string_view view;
+			if (!ReadView(view)) return false;
+			value.assign(view);
+			return true;
+		}
+
+		// Interns the next string as the name of a Type, Field or Method
+		template <typename T>
+		auto ReadName(T& owner) -> bool {
+			std::string_view view;
+			if (!ReadView(view)) return false;
+			owner.SetName(view);
+			return true;
+		}
+
+		auto ReadType(Type& type) -> bool { return ReadName(type); }
+	};
+
+	static auto ComputeCacheKey(const std::vector<void*>& handles) -> std::uint64_t {
+		std::uint64_t hash = 14695981039346656037ull;
+		const auto mix = [&hash](const void* data, const std::size_t size) {
+			for (std::size_t i = 0; i < size; i++) {
+				hash ^= static_cast<const std::uint8_t*>(data)[i];
+				hash *= 1099511628211ull;
+			}
+		};
+		const auto mixString = [&mix](const char* value) {
+			if (value) mix(value, std::strlen(value) + 1);
+		};
+
+		mix(&cacheVersion_, sizeof(cacheVersion_));
+		mix(&mode_, sizeof(mode_));
+#if WINDOWS_MODE
+		// The runtime module's PE identity changes with every rebuild of GameAssembly / the mono runtime
+		const auto dosHeader = static_cast<const IMAGE_DOS_HEADER*>(hmodule_);
+		const auto ntHeaders = reinterpret_cast<const IMAGE_NT_HEADERS*>(static_cast<const char*>(hmodule_) + dosHeader->e_lfanew);
+		mix(&ntHeaders->FileHeader.TimeDateStamp, sizeof(ntHeaders->FileHeader.TimeDateStamp));
+		mix(&ntHeaders->OptionalHeader.SizeOfImage, sizeof(ntHeaders->OptionalHeader.SizeOfImage));
+		mix(&ntHeaders->OptionalHeader.CheckSum, sizeof(ntHeaders->OptionalHeader.CheckSum));
+#endif
+		for (const auto handle : handles) {
+			const auto image = Invoke<void*>(Export::AssemblyGetImage, handle);
+			const auto file = Invoke<const char*>(Export::ImageGetFilename, image);
+			mixString(Invoke<const char*>(Export::ImageGetName, image));
+			mixString(file);
+
+			// Mono images are real files on disk and can change without the runtime module changing
+			if (mode_ == Mode::Mono && file) {
+				std::error_code error;
+				const auto size = std::filesystem::file_size(file, error);
+				if (!error) mix(&size, sizeof(size));
+				const auto written = std::filesystem::last_write_time(file, error).time_since_epoch().count();
+				if (!error) mix(&written, sizeof(written));
+			}
+		}
+		return hash;
+	}
+
+	static auto MapCacheFile(const std::string& path) -> bool {
+#if WINDOWS_MODE
+		const auto file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+		if (file == INVALID_HANDLE_VALUE) return false;
+		LARGE_INTEGER size{};
+		const auto mapping = GetFileSizeEx(file, &size) && size.QuadPart > 0 ? CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr) : nullptr;
+		CloseHandle(file);
+		if (!mapping) return false;
+		const auto view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+		CloseHandle(mapping);
+		if (!view) return false;
+		cacheData_ = static_cast<const char*>(view);
+		cacheSize_ = static_cast<std::size_t>(size.QuadPart);
+#else
+		std::ifstream in(path, std::ios::binary);
+		if (!in) return false;
+		cacheBuffer_.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+		cacheData_ = cacheBuffer_.data();
+		cacheSize_ = cacheBuffer_.size();
+#endif
+		return true;
+	}
+
+	static auto UnmapCacheFile() -> void {
+#if WINDOWS_MODE
+		if (cacheData_) UnmapViewOfFile(cacheData_);
+#else
+		cacheBuffer_.clear();
+		cacheBuffer_.shrink_to_fit();
+#endif
+		cacheData_ = nullptr;
+		cacheSize_ = 0;
+	}
+
+	static auto ResolveClassHandle(void* image, const std::uint32_t token) -> void* {
+		try {
+			if (mode_ == Mode::Il2Cpp) return Invoke<void*>(Export::ImageGetClass, image, static_cast<int>(token));
+			return Invoke<void*>(Export::ClassGet, image, token);
+		}
+		catch (...) {
+			return nullptr;
+		}
+	}
+
+	// Populates `assembly` from the cache file; the mapping stays alive for the cached member sections
+	static auto LoadMetadataCache(const std::vector<void*>& handles, const std::uint64_t key) -> bool {
+		if (!MapCacheFile(cachePath_)) return false;
+
+		CacheHeader header{};
+		const auto valid = [&] {
+			if (cacheSize_ < sizeof(header)) return false;
+			std::memcpy(&header, cacheData_, sizeof(header));
+			if (std::memcmp(header.magic, "URMC", 4) != 0 || header.version != cacheVersion_ || header.key != key) return false;
+			if (header.assemblyCount != handles.size()) return false;
+			return static_cast<std::uint64_t>(header.stringBytes) + header.classBytes + header.memberBytes <= cacheSize_ - sizeof(header);
+		}();
+		if (!valid) {
+			UnmapCacheFile();
+			return false;
+		}
+
+		const auto strings = cacheData_ + sizeof(header);
+		CacheReader reader{ strings + header.stringBytes, strings + header.stringBytes + header.classBytes, strings, header.stringBytes };
+		cacheStringBytes_ = header.stringBytes;
+		cacheMembers_ = reader.end;
+		cacheMembersEnd_ = cacheMembers_ + header.memberBytes;
+
+		std::vector<std::unique_ptr<Assembly>> loaded;
+		for (const auto handle : handles) {
+			auto          pAssembly = std::make_unique<Assembly>(Assembly{ .address = handle });
+			const auto    image = Invoke<void*>(Export::AssemblyGetImage, handle);
+			std::uint32_t classCount{};
+			if (!reader.ReadString(pAssembly->name) || !reader.ReadString(pAssembly->file) || !reader.Read(classCount)) {
+				UnmapCacheFile();
+				return false;
+			}
+
+			pAssembly->classes.reserve(classCount);
+			for (std::uint32_t i = 0; i < classCount; i++) {
+				auto             pAClass = std::make_unique<Class>();
+				std::uint32_t    membersOffset{};
+				std::string_view name, namespaze, parent;
+				if (!reader.ReadView(name) || !reader.ReadView(namespaze) || !reader.ReadView(parent) ||
+					!reader.Read(pAClass->token) || !reader.Read(membersOffset) || membersOffset >= header.memberBytes) {
+					UnmapCacheFile();
+					return false;
+				}
+				pAClass->SetName(name);
+				pAClass->SetNamespace(namespaze);
+				pAClass->SetParent(parent);
+
+				pAClass->address = ResolveClassHandle(image, pAClass->token);
+				if (pAClass->address == nullptr) continue;
+				pAClass->cachedMembers = cacheMembers_ + membersOffset;
+				pAssembly->classes.push_back(std::move(pAClass));
+			}
+			loaded.push_back(std::move(pAssembly));
+		}
+
+		for (auto& pAssembly : loaded) assembly.push_back(std::move(pAssembly));
+		return true;
+	}
+
+	static auto WriteMetadataCache(const std::uint64_t key) -> void {
+		CacheWriter writer;
+		std::string classes;
+		std::string members;
+
+		for (const auto& pAssembly : assembly) {
+			writer.WriteString(classes, pAssembly->name);
+			writer.WriteString(classes, pAssembly->file);
+			CacheWriter::Write(classes, static_cast<std::uint32_t>(pAssembly->classes.size()));
+
+			for (const auto& pClass : pAssembly->classes) {
+				writer.WriteString(classes, pClass->m_name);
+				writer.WriteString(classes, pClass->namespaze);
+				writer.WriteString(classes, pClass->parent);
+				CacheWriter::Write(classes, pClass->token);
+				CacheWriter::Write(classes, static_cast<std::uint32_t>(members.size()));
+
+				const auto& fields = pClass->GetFields();
+				CacheWriter::Write(members, static_cast<std::uint32_t>(fields.size()));
+				for (const auto& pField : fields) {
+					writer.WriteString(members, pField->name);
+					writer.WriteString(members, pField->type->name);
+					CacheWriter::Write(members, pField->offset);
+					CacheWriter::Write(members, static_cast<std::int32_t>(pField->type->size));
+					CacheWriter::Write(members, static_cast<std::uint8_t>(pField->static_field));
+				}
+
+				const auto& methods = pClass->GetMethods();
+				CacheWriter::Write(members, static_cast<std::uint32_t>(methods.size()));
+				for (const auto& pMethod : methods) {
+					writer.WriteString(members, pMethod->name);
+					writer.WriteString(members, pMethod->return_type->name);
+					CacheWriter::Write(members, static_cast<std::int32_t>(pMethod->return_type->size));
+					CacheWriter::Write(members, pMethod->flags);
+					CacheWriter::Write(members, static_cast<std::uint8_t>(pMethod->static_function));
+					CacheWriter::Write(members, static_cast<std::uint32_t>(pMethod->m_args.size()));
+					for (const auto& pArg : pMethod->m_args) {
+						writer.WriteString(members, pArg->name);
+						writer.WriteString(members, pArg->pType->name);
+						CacheWriter::Write(members, static_cast<std::int32_t>(pArg->pType->size));
 					}
-					catch (...) {}
-				}, assembly);
+				}
+			}
 		}
+
+		CacheHeader header{ .magic = { 'U', 'R', 'M', 'C' }, .version = cacheVersion_, .key = key, .assemblyCount = static_cast<std::uint32_t>(assembly.size()),
+			.stringBytes = static_cast<std::uint32_t>(writer.strings.size()), .classBytes = static_cast<std::uint32_t>(classes.size()), .memberBytes = static_cast<std::uint32_t>(members.size()) };
+
+		// Written beside the real file and swapped in so a crash mid-write never leaves a truncated cache behind
+		const auto tempPath = cachePath_ + ".tmp";
+		{
+			std::ofstream out(tempPath, std::ios::binary | std::ios::trunc);
+			if (!out) return;
+			out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+			out.write(writer.strings.data(), static_cast<std::streamsize>(writer.strings.size()));
+			out.write(classes.data(), static_cast<std::streamsize>(classes.size()));
+			out.write(members.data(), static_cast<std::streamsize>(members.size()));
+			if (!out) return;
+		}
+		std::error_code error;
+		std::filesystem::rename(tempPath, cachePath_, error);
+	}
+
+	// Fields and methods of a cache-loaded class; native handles are re-resolved by walking the runtime in
+	// ForeachMember's order. Any disagreement with the cached layout falls back to a full ForeachMember.
+	static auto LoadCachedMembers(Class* klass) -> void {
+		std::vector<void*> fieldHandles;
+		std::vector<void*> methodHandles;
+		const auto collect = [&](void* pKlass) {
+			void* iter = nullptr;
+			while (const auto field = Invoke<void*>(Export::ClassGetFields, pKlass, &iter)) fieldHandles.push_back(field);
+			iter = nullptr;
+			while (const auto method = Invoke<void*>(Export::ClassGetMethods, pKlass, &iter)) {
+				if (mode_ == Mode::Mono && !Invoke<void*>(Export::MethodSignature, method)) continue;
+				methodHandles.push_back(method);
+			}
+		};
+
+		const auto loaded = [&] {
+			try {
+				collect(klass->address);
+				void* iter{};
+				while (const auto iClass = Invoke<void*>(Export::ClassGetInterfaces, klass->address, &iter)) collect(iClass);
+			}
+			catch (...) {
+				return false;
+			}
+
+			CacheReader   reader{ klass->cachedMembers, cacheMembersEnd_, cacheData_ + sizeof(CacheHeader), cacheStringBytes_ };
+			std::uint32_t fieldCount{};
+			if (!reader.Read(fieldCount) || fieldCount != fieldHandles.size()) return false;
+			for (const auto field : fieldHandles) {
+				auto         pField = std::make_unique<Field>(Field{ .address = field, .type = std::make_unique<Type>(Type{ .address = Invoke<void*>(Export::FieldGetType, field) }), .klass = klass, .vTable = nullptr });
+				std::uint8_t isStatic{};
+				if (!reader.ReadName(*pField) || !reader.ReadType(*pField->type) || !reader.Read(pField->offset) || !reader.Read(pField->type->size) || !reader.Read(isStatic)) return false;
+				pField->static_field = isStatic != 0;
+				klass->fields.push_back(std::move(pField));
+			}
+
+			std::uint32_t methodCount{};
+			if (!reader.Read(methodCount) || methodCount != methodHandles.size()) return false;
+			for (const auto method : methodHandles) {
+				auto pMethod = std::make_unique<Method>();
+				pMethod->address = method;
+				pMethod->klass = klass;
+				pMethod->return_type = std::make_unique<Type>();
+
+				std::vector<void*> paramTypes;
+				if (mode_ == Mode::Il2Cpp) {
+					pMethod->function = *static_cast<void**>(method);
+					pMethod->return_type->address = Invoke<void*>(Export::MethodGetReturnType, method);
+					const auto paramCount = Invoke<int>(Export::MethodGetParamCount, method);
+					for (auto index = 0; index < paramCount; index++) paramTypes.push_back(Invoke<void*>(Export::MethodGetParam, method, index));
+				}
+				else {
+					const auto signature = Invoke<void*>(Export::MethodSignature, method);
+					pMethod->return_type->address = Invoke<void*>(Export::SignatureGetReturnType, signature);
+					void* iter = nullptr;
+					while (const auto type = Invoke<void*>(Export::SignatureGetParams, signature, &iter)) paramTypes.push_back(type);
+				}
+
+				std::uint8_t  isStatic{};
+				std::uint32_t argCount{};
+				if (!reader.ReadName(*pMethod) || !reader.ReadType(*pMethod->return_type) || !reader.Read(pMethod->return_type->size) ||
+					!reader.Read(pMethod->flags) || !reader.Read(isStatic) || !reader.Read(argCount) || argCount != paramTypes.size()) return false;
+				pMethod->static_function = isStatic != 0;
+
+				for (const auto paramType : paramTypes) {
+					auto             arg = std::make_unique<Method::Arg>(Method::Arg{ .pType = std::make_unique<Type>(Type{ .address = paramType }) });
+					std::string_view argName;
+					if (!reader.ReadView(argName) || !reader.ReadType(*arg->pType) || !reader.Read(arg->pType->size)) return false;
+					arg->name = stringPool_.Intern(argName);
+					pMethod->m_args.push_back(std::move(arg));
+				}
+				klass->methods.push_back(std::move(pMethod));
+			}
+			return true;
+		}();
+
+		if (loaded) {
+			klass->BuildIndex();
+			return;
+		}
+
+		klass->fields.clear();
+		klass->methods.clear();
+		ForeachMember(klass);
 	}
 
 	static auto ForeachClass(Assembly* pAssembly, void* image) -> void {
 		if (mode_ == Mode::Il2Cpp) {
-			const auto count = Invoke<int>("il2cpp_image_get_class_count", image);
+			const auto count = Invoke<int>(Export::ImageGetClassCount, image);
 			for (auto i = 0; i < count; i++) {
-				const auto pClass = Invoke<void*>("il2cpp_image_get_class", image, i);
+				const auto pClass = Invoke<void*>(Export::ImageGetClass, image, i);
 				if (pClass == nullptr) continue;
 				auto pAClass = std::make_unique<Class>();
 				pAClass->address = pClass;
-				pAClass->m_name = Invoke<const char*>("il2cpp_class_get_name", pClass);
-				if (const auto pPClass = Invoke<void*>("il2cpp_class_get_parent", pClass)) pAClass->parent = Invoke<const char*>("il2cpp_class_get_name", pPClass);
-				pAClass->namespaze = Invoke<const char*>("il2cpp_class_get_namespace", pClass);
+				pAClass->token = static_cast<std::uint32_t>(i);
+				pAClass->SetName(Invoke<const char*>(Export::ClassGetName, pClass));
+				if (const auto pPClass = Invoke<void*>(Export::ClassGetParent, pClass)) pAClass->SetParent(Invoke<const char*>(Export::ClassGetName, pPClass));
+				pAClass->SetNamespace(Invoke<const char*>(Export::ClassGetNamespace, pClass));
 
-				ForeachFields(pAClass.get(), pClass);
-				ForeachMethod(pAClass.get(), pClass);
-
-				void* i_class;
-				void* iter{};
-				do {
-					if ((i_class = Invoke<void*>("il2cpp_class_get_interfaces", pClass, &iter))) {
-						ForeachFields(pAClass.get(), i_class);
-						ForeachMethod(pAClass.get(), i_class);
-					}
-				} while (i_class);
+				if (!lazyMembers_) pAClass->EnsureMembers();
 				pAssembly->classes.push_back(std::move(pAClass));
 			}
 		}
 		else {
 			try {
-				const void* table = Invoke<void*>("mono_image_get_table_info", image, 2);
-				const auto  count = Invoke<int>("mono_table_info_get_rows", table);
+				const void* table = Invoke<void*>(Export::ImageGetTableInfo, image, 2);
+				const auto  count = Invoke<int>(Export::TableInfoGetRows, table);
 				for (auto i = 0; i < count; i++) {
-					const auto pClass = Invoke<void*>("mono_class_get", image, 0x02000000 | (i + 1));
+					const auto pClass = Invoke<void*>(Export::ClassGet, image, 0x02000000 | (i + 1));
 					if (pClass == nullptr) continue;
 
 					auto pAClass = std::make_unique<Class>();
 					pAClass->address = pClass;
+					pAClass->token = 0x02000000 | (i + 1);
 					try {
-						pAClass->m_name = Invoke<const char*>("mono_class_get_name", pClass);
-						if (const auto pPClass = Invoke<void*>("mono_class_get_parent", pClass)) pAClass->parent = Invoke<const char*>("mono_class_get_name", pPClass);
-						pAClass->namespaze = Invoke<const char*>("mono_class_get_namespace", pClass);
+						pAClass->SetName(Invoke<const char*>(Export::ClassGetName, pClass));
+						if (const auto pPClass = Invoke<void*>(Export::ClassGetParent, pClass)) pAClass->SetParent(Invoke<const char*>(Export::ClassGetName, pPClass));
+						pAClass->SetNamespace(Invoke<const char*>(Export::ClassGetNamespace, pClass));
 					}
 					catch (...) {
 						return;
 					}
 
-					ForeachFields(pAClass.get(), pClass);
-					ForeachMethod(pAClass.get(), pClass);
-
-					void* iClass;
-					void* iiter{};
-
-					do {
-						try {
-							if ((iClass = Invoke<void*>("mono_class_get_interfaces", pClass, &iiter))) {
-								ForeachFields(pAClass.get(), iClass);
-								ForeachMethod(pAClass.get(), iClass);
-							}
-						}
-						catch (...) {
-							return;
-						}
-					} while (iClass);
+					if (!lazyMembers_) pAClass->EnsureMembers();
 					pAssembly->classes.push_back(std::move(pAClass));
 				}
 			}
@@ -774,17 +1693,56 @@ private:
 		}
 	}
 
+	// Fields and methods of the class itself plus everything reachable through its interfaces
+	static auto ForeachMember(Class* klass) -> void {
+		const auto pClass = klass->address;
+		if (mode_ == Mode::Il2Cpp) {
+			ForeachFields(klass, pClass);
+			ForeachMethod(klass, pClass);
+
+			void* i_class;
+			void* iter{};
+			do {
+				if ((i_class = Invoke<void*>(Export::ClassGetInterfaces, pClass, &iter))) {
+					ForeachFields(klass, i_class);
+					ForeachMethod(klass, i_class);
+				}
+			} while (i_class);
+		}
+		else {
+			ForeachFields(klass, pClass);
+			ForeachMethod(klass, pClass);
+
+			void* iClass;
+			void* iiter{};
+
+			do {
+				try {
+					if ((iClass = Invoke<void*>(Export::ClassGetInterfaces, pClass, &iiter))) {
+						ForeachFields(klass, iClass);
+						ForeachMethod(klass, iClass);
+					}
+				}
+				catch (...) {
+					break;
+				}
+			} while (iClass);
+		}
+		klass->BuildIndex();
+	}
+
 	static auto ForeachFields(Class* klass, void* pKlass) -> void {
 		if (mode_ == Mode::Il2Cpp) {
 			void* iter = nullptr;
 			void* field;
 			do {
-				if ((field = Invoke<void*>("il2cpp_class_get_fields", pKlass, &iter))) {
-					auto pField = std::make_unique<Field>(Field{ .address = field, .name = Invoke<const char*>("il2cpp_field_get_name", field), .type = std::make_unique<Type>(Type{.address = Invoke<void*>("il2cpp_field_get_type", field)}), .klass = klass, .offset = Invoke<int>("il2cpp_field_get_offset", field), .static_field = false, .vTable = nullptr });
+				if ((field = Invoke<void*>(Export::ClassGetFields, pKlass, &iter))) {
+					auto pField = std::make_unique<Field>(Field{ .address = field, .type = std::make_unique<Type>(Type{.address = Invoke<void*>(Export::FieldGetType, field)}), .klass = klass, .offset = Invoke<int>(Export::FieldGetOffset, field), .static_field = false, .vTable = nullptr });
+					pField->SetName(Invoke<const char*>(Export::FieldGetName, field));
 					pField->static_field = pField->offset <= 0;
-					const auto name = Invoke<char*>("il2cpp_type_get_name", pField->type->address);
-					pField->type->name = name;
-					Invoke<void>("il2cpp_free", name);
+					const auto name = Invoke<char*>(Export::TypeGetName, pField->type->address);
+					pField->type->SetName(name);
+					Invoke<void>(Export::Free, name);
 					pField->type->size = -1;
 					klass->fields.push_back(std::move(pField));
 				}
@@ -795,15 +1753,18 @@ private:
 			void* field;
 			do {
 				try {
-					if ((field = Invoke<void*>("mono_class_get_fields", pKlass, &iter))) {
-						auto pField = std::make_unique<Field>(Field{ .address = field, .name = Invoke<const char*>("mono_field_get_name", field), .type = std::make_unique<Type>(Type{.address = Invoke<void*>("mono_field_get_type", field)}), .klass = klass, .offset = Invoke<int>("mono_field_get_offset", field), .static_field = false, .vTable = nullptr });
+					if ((field = Invoke<void*>(Export::ClassGetFields, pKlass, &iter))) {
+						auto pField = std::make_unique<Field>(Field{ .address = field, .type = std::make_unique<Type>(Type{.address = Invoke<void*>(Export::FieldGetType, field)}), .klass = klass, .offset = Invoke<int>(Export::FieldGetOffset, field), .static_field = false, .vTable = nullptr });
+						pField->SetName(Invoke<const char*>(Export::FieldGetName, field));
 						int        tSize{};
-						if (const int flags = Invoke<int>("mono_field_get_flags", field); flags & 0x10)
+						if (const int flags = Invoke<int>(Export::FieldGetFlags, field); flags & 0x10)
 						{
 							pField->static_field = true;
 						}
-						pField->type->name = Invoke<const char*>("mono_type_get_name", pField->type->address);
-						pField->type->size = Invoke<int>("mono_type_size", pField->type->address, &tSize);
+						const auto name = Invoke<char*>(Export::TypeGetName, pField->type->address);
+						pField->type->SetName(name);
+						Invoke<void>(Export::Free, name);
+						pField->type->size = Invoke<int>(Export::TypeSize, pField->type->address, &tSize);
 						klass->fields.push_back(std::move(pField));
 					}
 				}
@@ -819,31 +1780,31 @@ private:
 			void* iter = nullptr;
 			void* method;
 			do {
-				if ((method = Invoke<void*>("il2cpp_class_get_methods", pKlass, &iter))) {
+				if ((method = Invoke<void*>(Export::ClassGetMethods, pKlass, &iter))) {
 					int        fFlags{};
 					auto pMethod = std::make_unique<Method>();
 					pMethod->address = method;
-					pMethod->name = Invoke<const char*>("il2cpp_method_get_name", method);
+					pMethod->SetName(Invoke<const char*>(Export::MethodGetName, method));
 					pMethod->klass = klass;
-					pMethod->return_type = std::make_unique<Type>(Type{ .address = Invoke<void*>("il2cpp_method_get_return_type", method), });
-					pMethod->flags = Invoke<int>("il2cpp_method_get_flags", method, &fFlags);
+					pMethod->return_type = std::make_unique<Type>(Type{ .address = Invoke<void*>(Export::MethodGetReturnType, method), });
+					pMethod->flags = Invoke<int>(Export::MethodGetFlags, method, &fFlags);
 
 					pMethod->static_function = pMethod->flags & 0x10;
-					const auto name = Invoke<char*>("il2cpp_type_get_name", pMethod->return_type->address);
-					pMethod->return_type->name = name;
-					Invoke<void>("il2cpp_free", name);
+					const auto name = Invoke<char*>(Export::TypeGetName, pMethod->return_type->address);
+					pMethod->return_type->SetName(name);
+					Invoke<void>(Export::Free, name);
 					pMethod->return_type->size = -1;
 					pMethod->function = *static_cast<void**>(method);
-					const auto argCount = Invoke<int>("il2cpp_method_get_param_count", method);
+					const auto argCount = Invoke<int>(Export::MethodGetParamCount, method);
 					for (auto index = 0; index < argCount; index++) {
 						auto arg = new Method::Arg();
-						arg->name = Invoke<const char*>("il2cpp_method_get_param_name", method, index);
+						arg->name = stringPool_.Intern(Invoke<const char*>(Export::MethodGetParamName, method, index));
 						{
 							auto pType = std::make_unique<Type>();
-							pType->address = Invoke<void*>("il2cpp_method_get_param", method, index);
-							const auto type_name = Invoke<char*>("il2cpp_type_get_name", pType->address);
-							pType->name = type_name;
-							Invoke<void>("il2cpp_free", type_name);
+							pType->address = Invoke<void*>(Export::MethodGetParam, method, index);
+							const auto type_name = Invoke<char*>(Export::TypeGetName, pType->address);
+							pType->SetName(type_name);
+							Invoke<void>(Export::Free, type_name);
 							pType->size = -1;
 							arg->pType = std::move(pType);
 						}
@@ -859,8 +1820,8 @@ private:
 
 			do {
 				try {
-					if ((method = Invoke<void*>("mono_class_get_methods", pKlass, &iter))) {
-						const auto signature = Invoke<void*>("mono_method_signature", method);
+					if ((method = Invoke<void*>(Export::ClassGetMethods, pKlass, &iter))) {
+						const auto signature = Invoke<void*>(Export::MethodSignature, method);
 						if (!signature) continue;
 
 						int fFlags{};
@@ -869,20 +1830,22 @@ private:
 
 						std::vector<char*> names;
 						try {
-							pMethod->name = Invoke<const char*>("mono_method_get_name", method);
+							pMethod->SetName(Invoke<const char*>(Export::MethodGetName, method));
 							pMethod->klass = klass;
-							pMethod->return_type = std::make_unique<Type>(Type{ .address = Invoke<void*>("mono_signature_get_return_type", signature) });
+							pMethod->return_type = std::make_unique<Type>(Type{ .address = Invoke<void*>(Export::SignatureGetReturnType, signature) });
 
-							pMethod->flags = Invoke<int>("mono_method_get_flags", method, &fFlags);
+							pMethod->flags = Invoke<int>(Export::MethodGetFlags, method, &fFlags);
 							pMethod->static_function = pMethod->flags & 0x10;
 
-							pMethod->return_type->name = Invoke<const char*>("mono_type_get_name", pMethod->return_type->address);
+							const auto name = Invoke<char*>(Export::TypeGetName, pMethod->return_type->address);
+							pMethod->return_type->SetName(name);
+							Invoke<void>(Export::Free, name);
 							int tSize{};
-							pMethod->return_type->size = Invoke<int>("mono_type_size", pMethod->return_type->address, &tSize);
+							pMethod->return_type->size = Invoke<int>(Export::TypeSize, pMethod->return_type->address, &tSize);
 
-							const int param_count = Invoke<int>("mono_signature_get_param_count", signature);
+							const int param_count = Invoke<int>(Export::SignatureGetParamCount, signature);
 							names.resize(param_count);
-							Invoke<void>("mono_method_get_param_names", method, names.data());
+							Invoke<void>(Export::MethodGetParamNames, method, names.data());
 						}
 						catch (...) {
 							continue;
@@ -894,13 +1857,14 @@ private:
 
 						do {
 							try {
-								if ((mType = Invoke<void*>("mono_signature_get_params", signature, &mIter))) {
+								if ((mType = Invoke<void*>(Export::SignatureGetParams, signature, &mIter))) {
 									int t_size{};
 									try {
-										pMethod->m_args.push_back(std::make_unique<Method::Arg>(Method::Arg{
-											names[iname],
-											std::make_unique<Type>(Type{.address = mType, .name = Invoke<const char*>("mono_type_get_name", mType), .size = Invoke<int>("mono_type_size", mType, &t_size) })
-											}));
+										auto pType = std::make_unique<Type>(Type{ .address = mType, .size = Invoke<int>(Export::TypeSize, mType, &t_size) });
+										const auto type_name = Invoke<char*>(Export::TypeGetName, mType);
+										pType->SetName(type_name);
+										Invoke<void>(Export::Free, type_name);
+										pMethod->m_args.push_back(std::make_unique<Method::Arg>(Method::Arg{ stringPool_.Intern(names[iname]), std::move(pType) }));
 									}
 									catch (...) {
 
@@ -1982,8 +2946,8 @@ public:
 			}
 
 			static auto New(const std::string& str) -> String* {
-				if (mode_ == Mode::Il2Cpp) return UnityResolve::Invoke<String*, const char*>("il2cpp_string_new", str.c_str());
-				return UnityResolve::Invoke<String*, void*, const char*>("mono_string_new", UnityResolve::Invoke<void*>("mono_get_root_domain"), str.c_str());
+				if (mode_ == Mode::Il2Cpp) return UnityResolve::Invoke<String*, const char*>(Export::StringNew, str.c_str());
+				return UnityResolve::Invoke<String*, void*, const char*>(Export::StringNew, UnityResolve::Invoke<void*>(Export::DomainGet), str.c_str());
 			}
 		};
 
@@ -2055,8 +3019,8 @@ public:
 			}
 
 			static auto New(const Class* klass, const std::uintptr_t size) -> Array* {
-				if (mode_ == Mode::Il2Cpp) return UnityResolve::Invoke<Array*, void*, std::uintptr_t>("il2cpp_array_new", klass->address, size);
-				return UnityResolve::Invoke<Array*, void*, void*, std::uintptr_t>("mono_array_new", pDomain, klass->address, size);
+				if (mode_ == Mode::Il2Cpp) return UnityResolve::Invoke<Array*, void*, std::uintptr_t>(Export::ArrayNew, klass->address, size);
+				return UnityResolve::Invoke<Array*, void*, void*, std::uintptr_t>(Export::ArrayNew, pDomain, klass->address, size);
 			}
 		};
 
@@ -3914,6 +4878,27 @@ private:
 	inline static Mode                                   mode_{};
 	inline static void* hmodule_;
 	inline static std::unordered_map<std::string, void*> address_{};
+	inline static void* exports_[static_cast<std::size_t>(Export::Count)]{};
+	inline static StringMap<Assembly*>              assemblyIndex_{};
+	inline static StringMap<Class*>                 classByFullName_{};
+	inline static std::unordered_map<std::uint32_t, std::vector<Class*>> classByName_{};
+	inline static std::unordered_map<void*, Class*> classByHandle_{};
+	inline static bool                              lazyMembers_{};
+	inline static unsigned                          initWorkers_{};
+	inline static unsigned                          initWorkersUsed_{};
+	inline static double                            walkMilliseconds_{};
+	inline static std::vector<ImageTiming>          imageTimings_{};
+	inline static StringPool                        stringPool_{};
+	inline static std::string                       cachePath_{};
+	inline static bool                              loadedFromCache_{};
+	inline static const char*                       cacheData_{};
+	inline static std::size_t                       cacheSize_{};
+	inline static std::uint32_t                     cacheStringBytes_{};
+	inline static const char*                       cacheMembers_{};
+	inline static const char*                       cacheMembersEnd_{};
+#if !WINDOWS_MODE
+	inline static std::vector<char>                 cacheBuffer_{};
+#endif
 	
 public:
 	inline static void* pDomain{};
@@ -31,6 +31,11 @@ struct UserSettings
 		bool internal_overlay = true;
 		bool external_overlay = false;
 		bool lua_jit_enabled = false;
+		bool lazy_metadata = false;
+		bool parallel_metadata = false;
+		// On a cache miss the writer walks every class's fields and methods once, even with
+		// lazy_metadata; later runs of the same game build load members lazily from the file
+		bool metadata_cache = false;
 	} ini;
 
 	struct InspectorSettings
@@ -48,6 +53,11 @@ struct UserSettings
 		bool showWindow = false;
 	} memoryScanner;
 
+	struct TestsSettings
+	{
+		bool showWindow = false;
+	} tests;
+
 	Theme theme = Theme::DarkPlus;
 
 	void Load()
@@ -65,6 +75,9 @@ struct UserSettings
 				configFile["Config"]["internal_overlay"] = ini.internal_overlay;
 				configFile["Config"]["external_overlay"] = ini.external_overlay;
 				configFile["Config"]["lua_jit_enabled"] = ini.lua_jit_enabled;
+				configFile["Config"]["lazy_metadata"] = ini.lazy_metadata;
+				configFile["Config"]["parallel_metadata"] = ini.parallel_metadata;
+				configFile["Config"]["metadata_cache"] = ini.metadata_cache;
 				configFile.save(configPath.string());
 				return;
 			}
@@ -79,6 +92,9 @@ struct UserSettings
 				if (c.contains("internal_overlay"))  ini.internal_overlay = c["internal_overlay"].as<bool>();
 				if (c.contains("external_overlay"))  ini.external_overlay = c["external_overlay"].as<bool>();
 				if (c.contains("lua_jit_enabled"))   ini.lua_jit_enabled = c["lua_jit_enabled"].as<bool>();
+				if (c.contains("lazy_metadata"))     ini.lazy_metadata = c["lazy_metadata"].as<bool>();
+				if (c.contains("parallel_metadata")) ini.parallel_metadata = c["parallel_metadata"].as<bool>();
+				if (c.contains("metadata_cache"))    ini.metadata_cache = c["metadata_cache"].as<bool>();
 			}
 		}
 		catch (...)
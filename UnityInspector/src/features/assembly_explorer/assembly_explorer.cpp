@@ -64,15 +64,14 @@ void AssemblyExplorer::LoadAssemblyData()
 			classInfo.name = klass->m_name;
 			classInfo.parent = klass->parent;
 			classInfo.classHandle = klass.get();
-			classInfo.fieldCount = static_cast<int>(klass->fields.size());
-			classInfo.methodCount = static_cast<int>(klass->methods.size());
+			if (klass->MembersLoaded()) LoadMemberCounts(classInfo);
 
 			if (!klass->namespaze.empty())
-				classInfo.fullName = klass->namespaze + "." + klass->m_name;
+				classInfo.fullName = std::format("{}.{}", klass->namespaze, klass->m_name);
 			else
 				classInfo.fullName = klass->m_name;
 
-			std::string nsName = klass->namespaze.empty() ? "<Global Namespace>" : klass->namespaze;
+			std::string nsName(klass->namespaze.empty() ? "<Global Namespace>" : klass->namespaze);
 			nsMap[nsName].push_back(std::move(classInfo));
 		}
 
@@ -104,6 +103,10 @@ void AssemblyExplorer::LoadAssemblyData()
 	{
 		return a.name < b.name;
 	});
+
+	for (auto& assembly : assemblies)
+		BuildClassSearchIndex(assembly);
+	classSearch = {};
 }
 
 void AssemblyExplorer::RefreshAssemblyData()
@@ -312,74 +315,36 @@ void AssemblyExplorer::RenderClassListPanel()
 
 	ImGui::Separator();
 
-	int totalVisibleClasses = 0;
-	int totalClasses = 0;
+	const ClassSearchResults& search = UpdateClassSearch();
+	const ClassSearchIndex& index = selectedAssembly->searchIndex;
+	const bool searching = !search.search.empty();
 
-	for (auto& ns : selectedAssembly->namespaces)
-	{
-		totalClasses += static_cast<int>(ns.classes.size());
-
-		if (classSearchBuffer[0] == '\0')
-		{
-			totalVisibleClasses += static_cast<int>(ns.classes.size());
-		}
-		else
-		{
-			for (const auto& klass : ns.classes)
-			{
-				if (klass.name.find(classSearchBuffer) != std::string::npos ||
-					klass.fullName.find(classSearchBuffer) != std::string::npos)
-				{
-					totalVisibleClasses++;
-				}
-			}
-		}
-	}
+	const int totalClasses = static_cast<int>(index.classes.size());
+	const int totalVisibleClasses = searching ? static_cast<int>(search.matches.size()) : totalClasses;
 
 	ImGui::TextDisabled("Classes: %d/%d", totalVisibleClasses, totalClasses);
 	ImGui::Spacing();
 
 	ImGui::BeginChild("ClassListScroll", ImVec2(0, 0), false);
 
-	for (auto& ns : selectedAssembly->namespaces)
+	if (groupByNamespace)
 	{
-		if (groupByNamespace)
+		for (size_t n = 0; n < selectedAssembly->namespaces.size(); n++)
 		{
-			bool hasMatch = false;
-			if (classSearchBuffer[0] == '\0')
-			{
-				hasMatch = true;
-			}
-			else
-			{
-				for (const auto& klass : ns.classes)
-				{
-					if (klass.name.find(classSearchBuffer) != std::string::npos ||
-						klass.fullName.find(classSearchBuffer) != std::string::npos)
-					{
-						hasMatch = true;
-						break;
-					}
-				}
-			}
+			if (searching && search.namespaceMatches[n] == 0) continue;
 
-			if (!hasMatch) continue;
-
-			RenderNamespaceNode(ns);
+			RenderNamespaceNode(selectedAssembly->namespaces[n], n);
 		}
-		else
+	}
+	else
+	{
+		// Without namespaces every row is a single leaf, so only the visible ones are submitted
+		ImGuiListClipper clipper;
+		clipper.Begin(totalVisibleClasses);
+		while (clipper.Step())
 		{
-			for (auto& klass : ns.classes)
-			{
-				if (classSearchBuffer[0] != '\0' &&
-					klass.name.find(classSearchBuffer) == std::string::npos &&
-					klass.fullName.find(classSearchBuffer) == std::string::npos)
-				{
-					continue;
-				}
-
-				RenderClassNode(klass);
-			}
+			for (int row = clipper.DisplayStart; row < clipper.DisplayEnd; row++)
+				RenderClassNode(*index.classes[searching ? search.ranked[row] : row]);
 		}
 	}
 
@@ -388,7 +353,7 @@ void AssemblyExplorer::RenderClassListPanel()
 	ImGui::EndChild();
 }
 
-void AssemblyExplorer::RenderNamespaceNode(NamespaceGroup& ns)
+void AssemblyExplorer::RenderNamespaceNode(NamespaceGroup& ns, const size_t namespaceIndex)
 {
 	ImGui::PushID(&ns);
 
@@ -414,16 +379,14 @@ void AssemblyExplorer::RenderNamespaceNode(NamespaceGroup& ns)
 
 	if (nodeOpen)
 	{
-		for (auto& klass : ns.classes)
+		const bool searching = !classSearch.search.empty();
+		const uint32_t firstId = selectedAssembly->searchIndex.namespaceStarts[namespaceIndex];
+		for (size_t i = 0; i < ns.classes.size(); i++)
 		{
-			if (classSearchBuffer[0] != '\0' &&
-				klass.name.find(classSearchBuffer) == std::string::npos &&
-				klass.fullName.find(classSearchBuffer) == std::string::npos)
-			{
+			if (searching && !classSearch.matched[firstId + i])
 				continue;
-			}
 
-			RenderClassNode(klass);
+			RenderClassNode(ns.classes[i]);
 		}
 
 		ImGui::TreePop();
@@ -459,6 +422,8 @@ void AssemblyExplorer::RenderClassNode(AssemblyClassInfo& classInfo)
 
 	if (ImGui::IsItemHovered())
 	{
+		LoadMemberCounts(classInfo);
+
 		ImGui::BeginTooltip();
 		ImGui::Text("Full Name: %s", classInfo.fullName.c_str());
 		if (!classInfo.parent.empty())
@@ -610,7 +575,7 @@ void AssemblyExplorer::RenderClassDetailsPanel()
 
 	ImGui::Separator();
 
-	if (!klass->fields.empty())
+	if (!klass->GetFields().empty())
 	{
 		if (ImGui::CollapsingHeader("Fields", ImGuiTreeNodeFlags_DefaultOpen))
 		{
@@ -638,7 +603,7 @@ void AssemblyExplorer::RenderClassDetailsPanel()
 				ImGui::TableSetupColumn("Value", ImGuiTableColumnFlags_WidthStretch);
 				ImGui::TableSetupColumn("Action", ImGuiTableColumnFlags_WidthFixed, 50.0f);
 
-				for (const auto& field : klass->fields)
+				for (const auto& field : klass->GetFields())
 				{
 					if (!field) continue;
 
@@ -654,7 +619,7 @@ void AssemblyExplorer::RenderClassDetailsPanel()
 					ImGui::TableSetColumnIndex(0);
 					ImVec4 color = isStatic ? ImVec4(0.4f, 0.7f, 1.0f, 1.0f) : ImVec4(0.8f, 0.8f, 0.8f, 1.0f);
 					ImGui::PushStyleColor(ImGuiCol_Text, color);
-					ImGui::TextUnformatted(field->name.c_str());
+					ImGui::TextUnformatted(field->name.data());
 					ImGui::PopStyleColor();
 					if (ImGui::IsItemHovered() && ImGui::IsMouseReleased(ImGuiMouseButton_Right))
 						ImGui::OpenPopup("##fctx");
@@ -675,7 +640,7 @@ void AssemblyExplorer::RenderClassDetailsPanel()
 
 					ImGui::TableSetColumnIndex(1);
 					ImGui::PushStyleColor(ImGuiCol_Text, ImVec4(0.5f, 0.7f, 0.5f, 1.0f));
-					std::string typeName = field->type->name;
+					std::string typeName(field->type->name);
 					if (typeName.length() > 35) typeName = typeName.substr(0, 32) + "...";
 					ImGui::TextUnformatted(typeName.c_str());
 					ImGui::PopStyleColor();
@@ -711,7 +676,7 @@ void AssemblyExplorer::RenderClassDetailsPanel()
 						{
 							target = inst->instance;
 						}
-						std::string title = "Edit Field: " + field->name;
+						std::string title = std::format("Edit Field: {}", field->name);
 
 						if (!fieldEditor)
 							fieldEditor = std::make_unique<FieldEditor>();
@@ -747,7 +712,7 @@ void AssemblyExplorer::RenderClassDetailsPanel()
 		}
 	}
 
-	if (!klass->methods.empty())
+	if (!klass->GetMethods().empty())
 	{
 		if (ImGui::CollapsingHeader("Methods"))
 		{
@@ -771,7 +736,7 @@ void AssemblyExplorer::RenderClassDetailsPanel()
 				ImGui::TableSetupColumn("Flags", ImGuiTableColumnFlags_WidthFixed, 40.0f);
 				ImGui::TableSetupColumn("Action", ImGuiTableColumnFlags_WidthFixed, 60.0f);
 
-				for (const auto& method : klass->methods)
+				for (const auto& method : klass->GetMethods())
 				{
 					if (!method) continue;
 
@@ -784,7 +749,7 @@ void AssemblyExplorer::RenderClassDetailsPanel()
 					ImGui::TableSetColumnIndex(0);
 					ImVec4 color = isStatic ? ImVec4(0.4f, 0.7f, 1.0f, 1.0f) : ImVec4(0.8f, 0.8f, 0.8f, 1.0f);
 					ImGui::PushStyleColor(ImGuiCol_Text, color);
-					ImGui::TextUnformatted(method->name.c_str());
+					ImGui::TextUnformatted(method->name.data());
 					ImGui::PopStyleColor();
 					if (ImGui::IsItemHovered() && ImGui::IsMouseReleased(ImGuiMouseButton_Right))
 						ImGui::OpenPopup("##mctx");
@@ -811,7 +776,7 @@ void AssemblyExplorer::RenderClassDetailsPanel()
 
 					ImGui::TableSetColumnIndex(1);
 					ImGui::PushStyleColor(ImGuiCol_Text, ImVec4(0.5f, 0.7f, 0.5f, 1.0f));
-					std::string retType = method->return_type->name;
+					std::string retType(method->return_type->name);
 					if (retType.length() > 35) retType = retType.substr(0, 32) + "...";
 					ImGui::Text("-> %s", retType.c_str());
 					ImGui::PopStyleColor();
@@ -824,7 +789,7 @@ void AssemblyExplorer::RenderClassDetailsPanel()
 						{
 							if (!arg) continue;
 							if (!params.empty()) params += ", ";
-							params += arg->pType->name + " " + arg->name;
+							params += std::format("{} {}", arg->pType->name, arg->name);
 						}
 						if (params.length() > 50) params = params.substr(0, 47) + "...";
 						ImGui::TextDisabled("(%s)", params.c_str());
@@ -930,10 +895,19 @@ void AssemblyExplorer::SelectClass(AssemblyClassInfo* classInfo)
 
 	if (selectedClass)
 	{
+		LoadMemberCounts(*selectedClass);
 		RefreshInstances(selectedClass);
 	}
 }
 
+void AssemblyExplorer::LoadMemberCounts(AssemblyClassInfo& classInfo)
+{
+	if (classInfo.fieldCount >= 0 || !classInfo.classHandle) return;
+
+	classInfo.fieldCount = static_cast<int>(classInfo.classHandle->GetFields().size());
+	classInfo.methodCount = static_cast<int>(classInfo.classHandle->GetMethods().size());
+}
+
 void AssemblyExplorer::SelectInstance(ClassInstanceInfo* instance)
 {
 	selectedInstance = instance;
@@ -1208,13 +1182,13 @@ static void ScanObject(void* obj, int depth, std::unordered_set<void*>& visited,
 
 		if (urClass)
 		{
-			for (const auto& field : urClass->fields)
+			for (const auto& field : urClass->GetFields())
 			{
 				if (!field || field->static_field || !field->type) continue;
 
 				if (void* fieldPtr = nullptr; Helper::SafeReadPointer(obj, field->offset, fieldPtr) && fieldPtr)
 				{
-					if (const std::string& typeName = field->type->name; typeName.find("[]") != std::string::npos)
+					if (const std::string_view typeName = field->type->name; typeName.find("[]") != std::string_view::npos)
 					{
 						void* dummyElem = nullptr;
 						if (uintptr_t len = 0; SafeGetArrayLengthAndElement(fieldPtr, 0, dummyElem, len))
@@ -1275,7 +1249,7 @@ void AssemblyExplorer::RefreshInstances(AssemblyClassInfo* classInfo) const
 				if (cls.classHandle)
 				{
 					classMap[cls.classHandle->address] = cls.classHandle;
-					std::string fullName = cls.classHandle->namespaze + "." + cls.classHandle->m_name;
+					std::string fullName = std::format("{}.{}", cls.classHandle->namespaze, cls.classHandle->m_name);
 					nameToClassMap[fullName] = cls.classHandle;
 				}
 			}
@@ -1383,7 +1357,7 @@ void AssemblyExplorer::RefreshInstances(AssemblyClassInfo* classInfo) const
 					{
 						if (cls.classHandle)
 						{
-							for (const auto& field : cls.classHandle->fields)
+							for (const auto& field : cls.classHandle->GetFields())
 							{
 								if (field && field->static_field && field->type && field->type->size == sizeof(void*))
 								{
@@ -1476,7 +1450,7 @@ void AssemblyExplorer::RenderFieldRow(const UR::Field* field, void* instance) co
 {
 	if (!field || !field->type) return;
 
-	const std::string typeName = field->type->name;
+	const std::string typeName(field->type->name);
 
 	try
 	{
@@ -1697,7 +1671,7 @@ void AssemblyExplorer::RenderMethodInvokePopup()
 
 	if (ImGui::BeginPopupModal("Invoke Method", &invokeState.showPopup, ImGuiWindowFlags_AlwaysAutoResize))
 	{
-		ImGui::Text("Method: %s", invokeState.targetMethod->name.c_str());
+		ImGui::Text("Method: %s", invokeState.targetMethod->name.data());
 		ImGui::Separator();
 
 		for (size_t i = 0; i < invokeState.targetMethod->m_args.size(); i++)
@@ -1705,11 +1679,11 @@ void AssemblyExplorer::RenderMethodInvokePopup()
 			const auto& arg = invokeState.targetMethod->m_args[i];
 			if (!arg) continue;
 
-			std::string typeName = arg->pType ? arg->pType->name : "unknown";
+			std::string typeName(arg->pType ? arg->pType->name : "unknown");
 			const EditableType paramType = DetermineEditableType(typeName);
 
 			ImGui::PushID(static_cast<int>(i));
-			ImGui::Text("%s (%s):", arg->name.c_str(), typeName.c_str());
+			ImGui::Text("%s (%s):", arg->name.data(), typeName.c_str());
 			ImGui::SameLine();
 			ImGui::SetNextItemWidth(-1);
 
@@ -1770,7 +1744,7 @@ void AssemblyExplorer::RenderMethodInvokePopup()
 			invokeState.hasResult = true;
 			if (success && result)
 			{
-				const std::string retTypeName = invokeState.targetMethod->return_type
+				const std::string_view retTypeName = invokeState.targetMethod->return_type
 					                                ? invokeState.targetMethod->return_type->name
 					                                : "void";
 
@@ -1781,10 +1755,7 @@ void AssemblyExplorer::RenderMethodInvokePopup()
 				else
 				{
 					const EditableType retType = DetermineEditableType(retTypeName);
-					void* unboxed = UR::Invoke<void*, void*>(
-						Config::state.unityMode == UnityResolve::Mode::Mono
-							? "mono_object_unbox"
-							: "il2cpp_object_unbox", result);
+					void* unboxed = UR::Invoke<void*, void*>(UR::Export::ObjectUnbox, result);
 
 					if (unboxed)
 					{
@@ -1816,7 +1787,7 @@ void AssemblyExplorer::RenderMethodInvokePopup()
 			}
 			else if (success)
 			{
-				const std::string retTypeName = invokeState.targetMethod->return_type
+				const std::string_view retTypeName = invokeState.targetMethod->return_type
 					                                ? invokeState.targetMethod->return_type->name
 					                                : "void";
 				invokeState.resultText = (retTypeName == "System.Void" || retTypeName == "void")
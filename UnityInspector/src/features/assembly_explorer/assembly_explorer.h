@@ -22,8 +22,8 @@ private:
 		std::string fullName;
 		std::string parent;
 		UR::Class* classHandle = nullptr;
-		int fieldCount = 0;
-		int methodCount = 0;
+		int fieldCount = -1; // -1 until the class members have been materialized
+		int methodCount = -1;
 
 		std::vector<ClassInstanceInfo> instances;
 		float instancesRefreshTimer = 0.0f;
@@ -36,6 +36,27 @@ private:
 		bool isExpanded = false;
 	};
 
+	// One assembly's classes, built once on load. Ids run through the namespaces in display order, so
+	// namespace n owns ids [namespaceStarts[n], namespaceStarts[n + 1]). Full names are stored lowercase,
+	// one per line, and every trigram in them maps to the ascending ids that contain it.
+	struct ClassSearchIndex
+	{
+		std::vector<AssemblyClassInfo*> classes;
+		std::vector<uint32_t> namespaceStarts;
+		std::vector<uint32_t> nameStarts;
+		std::vector<uint32_t> fullNameOffsets;
+		std::string fullNamePool;
+		std::vector<uint32_t> trigrams;
+		std::vector<uint32_t> postingOffsets;
+		std::vector<uint32_t> postings;
+
+		[[nodiscard]] std::string_view FullName(const uint32_t id) const
+		{
+			return std::string_view(fullNamePool).substr(fullNameOffsets[id],
+			                                             fullNameOffsets[id + 1] - fullNameOffsets[id] - 1);
+		}
+	};
+
 	struct AssemblyInfo
 	{
 		std::string name;
@@ -44,6 +65,20 @@ private:
 		int classCount = 0;
 		bool isExpanded = false;
 		std::vector<NamespaceGroup> namespaces;
+		ClassSearchIndex searchIndex;
+	};
+
+	// The last class search, kept until the text or assembly changes. `matches` holds ascending ids and
+	// `ranked` the same ids best first: name prefix, then word start, then any substring. `matched` is
+	// 1 + that rank for every matching id and 0 for the rest.
+	struct ClassSearchResults
+	{
+		const AssemblyInfo* assembly = nullptr;
+		std::string search;
+		std::vector<uint32_t> matches;
+		std::vector<uint32_t> ranked;
+		std::vector<uint8_t> matched;
+		std::vector<uint32_t> namespaceMatches;
 	};
 
 	bool dataLoaded = false;
@@ -56,6 +91,7 @@ private:
 
 	char assemblySearchBuffer[256] = {};
 	char classSearchBuffer[256] = {};
+	ClassSearchResults classSearch;
 
 	bool showDetailsPanel = true;
 	bool groupByNamespace = true;
@@ -74,12 +110,16 @@ private:
 	void RenderDivider(const char* id, float& widthToAdjust, float height) const;
 
 	void RenderAssemblyNode(AssemblyInfo& assembly);
-	void RenderNamespaceNode(NamespaceGroup& ns);
+	void RenderNamespaceNode(NamespaceGroup& ns, size_t namespaceIndex);
 	void RenderClassNode(AssemblyClassInfo& classInfo);
 
+	static void BuildClassSearchIndex(AssemblyInfo& assembly);
+	const ClassSearchResults& UpdateClassSearch();
+
 	void SelectAssembly(AssemblyInfo* assembly);
 	void SelectClass(AssemblyClassInfo* classInfo);
 	void SelectInstance(ClassInstanceInfo* instance);
+	static void LoadMemberCounts(AssemblyClassInfo& classInfo);
 	void RefreshInstances(AssemblyClassInfo* classInfo) const;
 
 	void RenderFieldRow(const UR::Field* field, void* instance) const;
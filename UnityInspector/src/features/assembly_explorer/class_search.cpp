@@ -0,0 +1,183 @@
+#include "pch.h"
+#include "assembly_explorer.h"
+#include "helper/text_search.h"
+
+namespace
+{
+	char FoldAscii(const char c)
+	{
+		return c >= 'A' && c <= 'Z' ? static_cast<char>(c | 0x20) : c;
+	}
+
+	uint32_t Trigram(const char* p)
+	{
+		return static_cast<uint32_t>(static_cast<uint8_t>(p[0])) |
+			static_cast<uint32_t>(static_cast<uint8_t>(p[1])) << 8 |
+			static_cast<uint32_t>(static_cast<uint8_t>(p[2])) << 16;
+	}
+
+	// After a separator, or where camel case steps up to a capital
+	bool IsWordStart(const std::string& text, const size_t pos)
+	{
+		if (pos == 0) return true;
+		const auto previous = static_cast<unsigned char>(text[pos - 1]);
+		const auto current = static_cast<unsigned char>(text[pos]);
+		if (!std::isalnum(previous)) return true;
+		return std::isupper(current) && !std::isupper(previous);
+	}
+
+	// 0 when the class name starts with the search, 1 when some word in the full name does, 2 otherwise.
+	// `lower` is `fullName` folded to lowercase, so positions in one are positions in the other.
+	uint8_t RankMatch(const std::string_view lower, const std::string& fullName, const size_t nameStart,
+	                  const std::string_view search)
+	{
+		if (lower.substr(nameStart).starts_with(search)) return 0;
+		for (size_t pos = lower.find(search); pos != std::string_view::npos; pos = lower.find(search, pos + 1))
+		{
+			if (IsWordStart(fullName, pos)) return 1;
+		}
+		return 2;
+	}
+}
+
+void AssemblyExplorer::BuildClassSearchIndex(AssemblyInfo& assembly)
+{
+	ClassSearchIndex& index = assembly.searchIndex;
+	index = {};
+
+	for (auto& ns : assembly.namespaces)
+	{
+		index.namespaceStarts.push_back(static_cast<uint32_t>(index.classes.size()));
+		for (auto& klass : ns.classes)
+		{
+			index.classes.push_back(&klass);
+			index.nameStarts.push_back(static_cast<uint32_t>(klass.fullName.size() - klass.name.size()));
+			index.fullNameOffsets.push_back(static_cast<uint32_t>(index.fullNamePool.size()));
+			for (const char c : klass.fullName)
+				index.fullNamePool.push_back(FoldAscii(c));
+			index.fullNamePool.push_back('\n');
+		}
+	}
+	const auto count = static_cast<uint32_t>(index.classes.size());
+	index.namespaceStarts.push_back(count);
+	index.fullNameOffsets.push_back(static_cast<uint32_t>(index.fullNamePool.size()));
+
+	// Trigram in the high half, id in the low half: sorting groups each trigram's ids in ascending order
+	std::vector<uint64_t> entries;
+	entries.reserve(index.fullNamePool.size());
+	for (uint32_t id = 0; id < count; id++)
+	{
+		const std::string_view name = index.FullName(id);
+		for (size_t i = 0; i + 3 <= name.size(); i++)
+			entries.push_back(static_cast<uint64_t>(Trigram(name.data() + i)) << 32 | id);
+	}
+	std::ranges::sort(entries);
+	entries.erase(std::ranges::unique(entries).begin(), entries.end());
+
+	index.postings.reserve(entries.size());
+	for (const uint64_t entry : entries)
+	{
+		if (const auto trigram = static_cast<uint32_t>(entry >> 32); index.trigrams.empty() || index.trigrams.back() != trigram)
+		{
+			index.trigrams.push_back(trigram);
+			index.postingOffsets.push_back(static_cast<uint32_t>(index.postings.size()));
+		}
+		index.postings.push_back(static_cast<uint32_t>(entry));
+	}
+	index.postingOffsets.push_back(static_cast<uint32_t>(index.postings.size()));
+}
+
+// Only queries the index when the search text or selected assembly changed. Typing more characters
+// narrows the previous matches; otherwise candidates come from intersecting the search's trigram
+// postings, or for one- and two-character searches from a single scan of the name pool.
+const AssemblyExplorer::ClassSearchResults& AssemblyExplorer::UpdateClassSearch()
+{
+	ClassSearchResults& results = classSearch;
+	const Helper::SearchNeedle needle(classSearchBuffer);
+	const std::string& search = needle.Lower();
+	if (results.assembly == selectedAssembly && results.search == search)
+		return results;
+
+	const bool narrowing = results.assembly == selectedAssembly && !results.search.empty() &&
+		search.starts_with(results.search);
+	results.assembly = selectedAssembly;
+	results.search = search;
+
+	std::vector<uint32_t> candidates;
+	candidates.swap(results.matches);
+	results.ranked.clear();
+	if (!selectedAssembly || search.empty())
+		return results;
+
+	const ClassSearchIndex& index = selectedAssembly->searchIndex;
+	const auto count = static_cast<uint32_t>(index.classes.size());
+
+	// When narrowing, the previous matches are a superset of this search's and are filtered again as they are
+	if (!narrowing && search.size() >= 3)
+	{
+		candidates.clear();
+
+		// Posting ranges of every trigram in the search, rarest first
+		std::vector<std::pair<uint32_t, uint32_t>> lists;
+		for (size_t i = 0; i + 3 <= search.size(); i++)
+		{
+			const uint32_t trigram = Trigram(search.data() + i);
+			const auto it = std::ranges::lower_bound(index.trigrams, trigram);
+			if (it == index.trigrams.end() || *it != trigram)
+			{
+				lists.clear();
+				break;
+			}
+			const size_t slot = it - index.trigrams.begin();
+			lists.emplace_back(index.postingOffsets[slot], index.postingOffsets[slot + 1]);
+		}
+		std::ranges::sort(lists, {}, [](const auto& list) { return list.second - list.first; });
+
+		if (!lists.empty())
+		{
+			const auto postings = index.postings.begin();
+			candidates.assign(postings + lists[0].first, postings + lists[0].second);
+			for (size_t i = 1; i < lists.size() && !candidates.empty(); i++)
+			{
+				std::erase_if(candidates, [&](const uint32_t id)
+				{
+					return !std::binary_search(postings + lists[i].first, postings + lists[i].second, id);
+				});
+			}
+		}
+	}
+	else if (!narrowing)
+	{
+		candidates.clear();
+
+		// Names are newline-separated and the search is a single line, so no hit spans two classes
+		const std::string_view pool = index.fullNamePool;
+		uint32_t id = 0;
+		for (size_t pos = pool.find(search); pos != std::string_view::npos;)
+		{
+			while (index.fullNameOffsets[id + 1] <= pos) id++;
+			candidates.push_back(id);
+			pos = pool.find(search, index.fullNameOffsets[id + 1]);
+		}
+	}
+
+	results.matches.clear();
+	results.matched.assign(count, 0);
+	results.namespaceMatches.assign(selectedAssembly->namespaces.size(), 0);
+
+	size_t ns = 0;
+	for (const uint32_t id : candidates)
+	{
+		const std::string_view lower = index.FullName(id);
+		if (lower.find(search) == std::string_view::npos) continue;
+
+		results.matches.push_back(id);
+		results.matched[id] = 1 + RankMatch(lower, index.classes[id]->fullName, index.nameStarts[id], search);
+		while (index.namespaceStarts[ns + 1] <= id) ns++;
+		results.namespaceMatches[ns]++;
+	}
+
+	results.ranked = results.matches;
+	std::ranges::stable_sort(results.ranked, {}, [&](const uint32_t id) { return results.matched[id]; });
+	return results;
+}
@@ -154,12 +154,12 @@ bool DebugConsole::ShouldShowLogType(LogType type) const
 	}
 }
 
-bool DebugConsole::PassesFilter(const LogEntry& entry, std::string_view lowerFilter) const
+bool DebugConsole::PassesFilter(const LogEntry& entry, const Helper::SearchNeedle& filter) const
 {
-	if (lowerFilter.empty()) return true;
+	if (filter.Empty()) return true;
 
-	if (Helper::CaseInsensitiveFind(entry.message, lowerFilter)) return true;
-	return Helper::CaseInsensitiveFind(entry.source, lowerFilter);
+	if (filter.FoundIn(entry.message)) return true;
+	return filter.FoundIn(entry.source);
 }
 
 void DebugConsole::RenderLogEntry(const LogEntry& entry, int index)
@@ -266,14 +266,13 @@ void DebugConsole::RenderConsoleWindow()
 
 	std::scoped_lock lock(logMutex);
 
-	std::string lowerFilter = filterBuffer;
-	std::ranges::transform(lowerFilter, lowerFilter.begin(), tolower);
+	const Helper::SearchNeedle filter(filterBuffer);
 
 	int index = 0;
 	for (const auto& entry : logBuffer)
 	{
 		if (!ShouldShowLogType(entry.type)) continue;
-		if (!PassesFilter(entry, lowerFilter)) continue;
+		if (!PassesFilter(entry, filter)) continue;
 
 		RenderLogEntry(entry, index++);
 	}
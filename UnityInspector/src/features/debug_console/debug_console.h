@@ -1,5 +1,6 @@
 #pragma once
 #include "features/features.h"
+#include "helper/text_search.h"
 
 enum class LogType : uint8_t
 {
@@ -58,5 +59,5 @@ private:
 	[[nodiscard]] ImU32 GetLogColor(LogType type) const;
 	[[nodiscard]] const char* GetLogTypeString(LogType type) const;
 	[[nodiscard]] bool ShouldShowLogType(LogType type) const;
-	[[nodiscard]] bool PassesFilter(const LogEntry& entry, std::string_view lowerFilter) const;
+	[[nodiscard]] bool PassesFilter(const LogEntry& entry, const Helper::SearchNeedle& filter) const;
 };
\ No newline at end of file
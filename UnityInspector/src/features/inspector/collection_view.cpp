@@ -0,0 +1,269 @@
+#include "pch.h"
+#include "inspector.h"
+#include "helper/helper.h"
+
+namespace
+{
+	constexpr uint32_t CANCEL_CHECK_INTERVAL = 4096;
+	constexpr int MAX_STRING_CHARS = 256;
+
+	using EnumValues = std::vector<std::pair<std::string, int>>;
+
+	template <typename T>
+	T Load(const uint8_t* p)
+	{
+		T value;
+		std::memcpy(&value, p, sizeof(T));
+		return value;
+	}
+
+	void ReadManagedString(void* str, std::string& out)
+	{
+		out.clear();
+		int length = 0;
+		if (!str || !Helper::SafeReadInt(str, 0x10, length) || length <= 0) return;
+
+		wchar_t chars[MAX_STRING_CHARS];
+		length = std::min(length, MAX_STRING_CHARS);
+		if (!Helper::SafeReadSpan(str, 0x14, length * sizeof(wchar_t), chars)) return;
+
+		const int size = WideCharToMultiByte(CP_UTF8, 0, chars, length, nullptr, 0, nullptr, nullptr);
+		if (size <= 0) return;
+		out.resize(size);
+		WideCharToMultiByte(CP_UTF8, 0, chars, length, out.data(), size, nullptr, nullptr);
+	}
+
+	double DecodeScalar(const uint8_t* p, const CollectionScalar scalar)
+	{
+		switch (scalar)
+		{
+		case CollectionScalar::I8: return Load<int8_t>(p);
+		case CollectionScalar::U8:
+		case CollectionScalar::Bool: return Load<uint8_t>(p);
+		case CollectionScalar::I16: return Load<int16_t>(p);
+		case CollectionScalar::U16: return Load<uint16_t>(p);
+		case CollectionScalar::I32:
+		case CollectionScalar::Enum: return Load<int32_t>(p);
+		case CollectionScalar::U32: return Load<uint32_t>(p);
+		case CollectionScalar::I64: return static_cast<double>(Load<int64_t>(p));
+		case CollectionScalar::U64: return static_cast<double>(Load<uint64_t>(p));
+		case CollectionScalar::F32: return Load<float>(p);
+		case CollectionScalar::F64: return Load<double>(p);
+		default: return 0.0;
+		}
+	}
+
+	// The text a filter is matched against: what the row's editor shows, or the constant's name for enums
+	void FormatScalar(const uint8_t* p, const CollectionScalar scalar, const EnumValues* enumValues, std::string& out)
+	{
+		char buffer[64];
+		switch (scalar)
+		{
+		case CollectionScalar::I64:
+			snprintf(buffer, sizeof(buffer), "%lld", static_cast<long long>(Load<int64_t>(p)));
+			break;
+		case CollectionScalar::U64:
+			snprintf(buffer, sizeof(buffer), "%llu", static_cast<unsigned long long>(Load<uint64_t>(p)));
+			break;
+		case CollectionScalar::F32:
+		case CollectionScalar::F64:
+			snprintf(buffer, sizeof(buffer), "%g", DecodeScalar(p, scalar));
+			break;
+		case CollectionScalar::Bool:
+			out = Load<uint8_t>(p) ? "true" : "false";
+			return;
+		case CollectionScalar::Enum:
+			if (enumValues)
+			{
+				const int value = Load<int32_t>(p);
+				for (const auto& [name, constant] : *enumValues)
+				{
+					if (constant != value) continue;
+					out = name;
+					return;
+				}
+			}
+			[[fallthrough]];
+		default:
+			snprintf(buffer, sizeof(buffer), "%.0f", DecodeScalar(p, scalar));
+			break;
+		}
+		out = buffer;
+	}
+
+	// One guarded copy of the whole collection, plus each string element's text when a filter or sort
+	// needs it. The guarded helpers cache regions per thread, so this runs on the view's worker as well.
+	bool ReadCollection(const CollectionLayout& layout, const CollectionHeader& header, const bool readTexts,
+	                    std::vector<uint8_t>& bytes, std::vector<std::string>& texts, const std::atomic<bool>* cancel)
+	{
+		bytes.resize(static_cast<size_t>(header.slots) * layout.stride);
+		if (!bytes.empty() && !Helper::SafeReadSpan(reinterpret_cast<void*>(header.data), 0, bytes.size(), bytes.data()))
+			return false;
+		if (!readTexts)
+			return true;
+
+		texts.resize(header.slots);
+		for (int i = 0; i < header.slots; i++)
+		{
+			if (cancel && i % CANCEL_CHECK_INTERVAL == 0 && cancel->load(std::memory_order_relaxed))
+				return false;
+
+			const uint8_t* entry = bytes.data() + static_cast<size_t>(i) * layout.stride;
+			if (layout.kind == CollectionKind::HashSet && Load<int32_t>(entry) < 0) continue;
+			ReadManagedString(Load<void*>(entry + layout.element.offset), texts[i]);
+		}
+		return true;
+	}
+
+	std::shared_ptr<const CollectionOrder> OrderCollection(const CollectionLayout& layout,
+	                                                       const std::vector<uint8_t>& bytes,
+	                                                       const std::vector<std::string>& texts,
+	                                                       std::shared_ptr<CollectionOrder> order,
+	                                                       const EnumValues* enumValues,
+	                                                       const std::atomic<bool>* cancel)
+	{
+		const Helper::SearchNeedle needle(order->filter);
+		const bool byText = layout.scalar == CollectionScalar::String;
+		const auto slots = static_cast<uint32_t>(order->slots);
+		const auto stride = static_cast<size_t>(layout.stride);
+
+		std::vector<double> numbers;
+		std::string text;
+		for (uint32_t i = 0; i < slots; i++)
+		{
+			if (cancel && i % CANCEL_CHECK_INTERVAL == 0 && cancel->load(std::memory_order_relaxed))
+				return nullptr;
+
+			const uint8_t* entry = bytes.data() + i * stride;
+			if (layout.kind == CollectionKind::HashSet && Load<int32_t>(entry) < 0) continue;
+
+			const uint8_t* element = entry + layout.element.offset;
+			if (!needle.Empty())
+			{
+				if (!byText) FormatScalar(element, layout.scalar, enumValues, text);
+				if (!needle.FoundIn(byText ? texts[i] : text)) continue;
+			}
+
+			order->indices.push_back(i);
+			if (order->sort != 0 && !byText)
+			{
+				const double number = DecodeScalar(element, layout.scalar);
+				numbers.push_back(std::isnan(number) ? -std::numeric_limits<double>::infinity() : number);
+			}
+		}
+
+		if (order->sort == 0) return order;
+
+		if (cancel && cancel->load(std::memory_order_relaxed))
+			return nullptr;
+
+		// Sort positions into `indices` so numbers stay aligned with the entries they were decoded from
+		std::vector<uint32_t> positions(order->indices.size());
+		for (uint32_t i = 0; i < positions.size(); i++)
+			positions[i] = i;
+		const bool descending = order->sort == 2;
+		const auto& indices = order->indices;
+		std::ranges::stable_sort(positions, [&](const uint32_t a, const uint32_t b)
+		{
+			if (byText)
+			{
+				const std::string& lhs = texts[indices[descending ? b : a]];
+				const std::string& rhs = texts[indices[descending ? a : b]];
+				return lhs < rhs;
+			}
+			return descending ? numbers[b] < numbers[a] : numbers[a] < numbers[b];
+		});
+
+		for (uint32_t& position : positions)
+			position = indices[position];
+		order->indices = std::move(positions);
+		return order;
+	}
+}
+
+// Returns the newest finished order for `view`, which may still be for an older filter, sort or
+// collection size. The whole collection is copied once per refresh; copying, filtering and sorting
+// run inline for small collections and on the view's worker for larger ones.
+std::shared_ptr<const CollectionOrder> Inspector::UpdateCollectionOrder(const CollectionLayout& layout,
+                                                                        const CollectionHeader& header,
+                                                                        CollectionView& view) const
+{
+	const Helper::SearchNeedle needle(view.filterBuffer);
+	if (view.running)
+	{
+		if (view.runningFilter != needle.Lower() || view.runningSort != view.sort)
+			view.cancel = true;
+
+		std::scoped_lock lock(view.mutex);
+		return view.completed;
+	}
+
+	if (view.thread.joinable())
+		view.thread.join();
+
+	const double now = ImGui::GetTime();
+	{
+		std::scoped_lock lock(view.mutex);
+		if (const CollectionOrder* done = view.completed.get(); done && done->filter == needle.Lower() &&
+			done->sort == view.sort && done->data == header.data && done->slots == header.slots &&
+			(now - done->builtAt) * 1000.0 < collectionOrderRefreshMs)
+		{
+			return view.completed;
+		}
+	}
+
+	const size_t size = static_cast<size_t>(header.slots) * layout.stride;
+	view.tooLarge = size > collectionMaterializeMaxBytes;
+	if (view.tooLarge || !header.data || layout.stride <= 0)
+		return nullptr;
+
+	const bool readTexts = layout.scalar == CollectionScalar::String && (!needle.Empty() || view.sort != 0);
+	const EnumValues* enumValues = layout.scalar == CollectionScalar::Enum
+		                               ? &GetEnumValues(layout.element.enumTypeName)
+		                               : nullptr;
+
+	auto order = std::make_shared<CollectionOrder>();
+	order->data = header.data;
+	order->slots = header.slots;
+	order->filter = needle.Lower();
+	order->sort = view.sort;
+	order->builtAt = now;
+
+	if (header.slots < collectionOrderAsyncSlots)
+	{
+		std::vector<uint8_t> bytes;
+		std::vector<std::string> texts;
+		if (!ReadCollection(layout, header, readTexts, bytes, texts, nullptr))
+		{
+			std::scoped_lock lock(view.mutex);
+			return view.completed;
+		}
+
+		auto result = OrderCollection(layout, bytes, texts, std::move(order), enumValues, nullptr);
+		std::scoped_lock lock(view.mutex);
+		view.completed = std::move(result);
+		return view.completed;
+	}
+
+	view.runningFilter = order->filter;
+	view.runningSort = order->sort;
+	view.cancel = false;
+	view.running = true;
+	view.thread = std::thread([&view, &layout, header, readTexts, order = std::move(order), enumValues]() mutable
+		{
+			std::vector<uint8_t> bytes;
+			std::vector<std::string> texts;
+			if (ReadCollection(layout, header, readTexts, bytes, texts, &view.cancel))
+			{
+				if (auto result = OrderCollection(layout, bytes, texts, std::move(order), enumValues, &view.cancel))
+				{
+					std::scoped_lock lock(view.mutex);
+					view.completed = std::move(result);
+				}
+			}
+			view.running = false;
+		});
+
+	std::scoped_lock lock(view.mutex);
+	return view.completed;
+}
@@ -2,73 +2,72 @@
 #include "field_editor.h"
 #include "helper/helper.h"
 
-#define API(fn) (Config::state.unityMode == UnityResolve::Mode::Mono ? "mono_" fn : "il2cpp_" fn)
-
 bool IsEnumClass(std::string_view typeName)
 {
-	for (const auto& assembly : UR::assembly)
+	for (const UR::Class* klass : UR::GetClassesByName(typeName))
 	{
-		if (!assembly) continue;
-		for (const auto& klass : assembly->classes)
-		{
-			if (!klass) continue;
-			if (klass->m_name == typeName)
-			{
-				if (void* klassPtr = klass->address; UR::Invoke<bool, void*>(API("class_is_enum"), klassPtr))
-					return true;
-			}
-		}
+		if (UR::Invoke<bool, void*>(UR::Export::ClassIsEnum, klass->address))
+			return true;
 	}
 	return false;
 }
 
-std::vector<std::pair<std::string, int>> GetEnumValues(std::string_view enumTypeName)
+namespace
 {
-	std::vector<std::pair<std::string, int>> result;
-
-	void* enumClass = nullptr;
-	for (const auto& assembly : UR::assembly)
+	struct EnumNameHash
 	{
-		if (!assembly) continue;
-		for (const auto& klass : assembly->classes)
-		{
-			if (!klass) continue;
-			if (klass->m_name == enumTypeName)
-			{
-				enumClass = klass->address;
-				break;
-			}
-		}
-		if (enumClass) break;
-	}
+		using is_transparent = void;
+		size_t operator()(const std::string_view value) const noexcept { return std::hash<std::string_view>{}(value); }
+	};
 
-	if (!enumClass) return result;
+	// An enum's constants never change once its class is loaded, so each type is only enumerated once
+	std::unordered_map<std::string, std::vector<std::pair<std::string, int>>, EnumNameHash, std::equal_to<>> enumValueCache;
 
-	void* iter = nullptr;
-	void* field;
-	while ((field = UR::Invoke<void*, void*, void*>(API("class_get_fields"), enumClass, &iter)))
+	std::vector<std::pair<std::string, int>> ReadEnumValues(void* enumClass)
 	{
-		if (const int flags = UR::Invoke<int, void*>(API("field_get_flags"), field); (flags & 0x10) != 0)
+		std::vector<std::pair<std::string, int>> result;
+
+		void* iter = nullptr;
+		void* field;
+		while ((field = UR::Invoke<void*, void*, void*>(UR::Export::ClassGetFields, enumClass, &iter)))
 		{
-			if (const char* fieldName = UR::Invoke<const char*, void*>(API("field_get_name"), field))
+			if (const int flags = UR::Invoke<int, void*>(UR::Export::FieldGetFlags, field); (flags & 0x10) != 0)
 			{
-				int value = 0;
-				if (Config::state.unityMode == UnityResolve::Mode::Mono)
+				if (const char* fieldName = UR::Invoke<const char*, void*>(UR::Export::FieldGetName, field))
 				{
-					void* vTable = UR::Invoke<void*, void*, void*>("mono_class_vtable", UR::pDomain,
-					                                               UR::Invoke<void*, void*>("mono_field_get_parent", field));
-					UR::Invoke<void, void*, void*, int*>("mono_field_static_get_value", vTable, field, &value);
-				}
-				else
-				{
-					UR::Invoke<void, void*, int*>("il2cpp_field_static_get_value", field, &value);
+					int value = 0;
+					if (Config::state.unityMode == UnityResolve::Mode::Mono)
+					{
+						void* vTable = UR::Invoke<void*, void*, void*>(UR::Export::ClassVTable, UR::pDomain,
+						                                               UR::Invoke<void*, void*>(UR::Export::FieldGetParent, field));
+						UR::Invoke<void, void*, void*, int*>(UR::Export::FieldStaticGetValue, vTable, field, &value);
+					}
+					else
+					{
+						UR::Invoke<void, void*, int*>(UR::Export::FieldStaticGetValue, field, &value);
+					}
+					result.push_back({fieldName, value});
 				}
-				result.push_back({fieldName, value});
 			}
 		}
+
+		return result;
 	}
+}
+
+const std::vector<std::pair<std::string, int>>& GetEnumValues(const std::string_view enumTypeName)
+{
+	if (const auto it = enumValueCache.find(enumTypeName); it != enumValueCache.end())
+		return it->second;
 
-	return result;
+	const auto& candidates = UR::GetClassesByName(enumTypeName);
+	if (candidates.empty())
+	{
+		static const std::vector<std::pair<std::string, int>> none;
+		return none;
+	}
+
+	return enumValueCache.emplace(enumTypeName, ReadEnumValues(candidates.front()->address)).first->second;
 }
 
 static void CheckAndUpdateEnumType(std::string& typeName, std::string_view fieldTypeName,
@@ -203,11 +202,11 @@ void FieldEditor::OpenFieldEditor(const ComponentFieldInfo& fieldInfo, void* ins
 	state.ownedField.reset();
 
 	auto ownedField = std::make_unique<UR::Field>();
-	ownedField->name = fieldInfo.name;
+	ownedField->SetName(fieldInfo.name);
 	ownedField->offset = fieldInfo.offset;
 	ownedField->static_field = fieldInfo.isStatic;
 	auto fieldType = std::make_unique<UR::Type>();
-	fieldType->name = fieldInfo.typeName;
+	fieldType->SetName(fieldInfo.typeName);
 	ownedField->type = std::move(fieldType);
 	state.ownedField = std::move(ownedField);
 	state.targetField = state.ownedField.get();
@@ -278,12 +277,12 @@ void FieldEditor::Render()
 		const UR::Field* field = state.targetField;
 
 		ImGui::PushStyleColor(ImGuiCol_Text, ImVec4(1.0f, 0.8f, 0.4f, 1.0f));
-		ImGui::Text("%s", field->name.c_str());
+		ImGui::Text("%s", field->name.data());
 		ImGui::PopStyleColor();
 
 		ImGui::SameLine();
 		ImGui::PushStyleColor(ImGuiCol_Text, ImVec4(0.5f, 0.7f, 0.5f, 1.0f));
-		ImGui::Text("(%s)", field->type ? field->type->name.c_str() : "unknown");
+		ImGui::Text("(%s)", field->type ? field->type->name.data() : "unknown");
 		ImGui::PopStyleColor();
 
 		ImGui::Separator();
@@ -294,7 +293,7 @@ void FieldEditor::Render()
 		}
 		else if (state.nestedClass && !state.nestedInstance)
 		{
-			ImGui::TextDisabled("This field is a pointer to %s", state.nestedClass->m_name.c_str());
+			ImGui::TextDisabled("This field is a pointer to %s", state.nestedClass->m_name.data());
 			ImGui::TextDisabled("Current value: null");
 
 			ImGui::Separator();
@@ -302,7 +301,7 @@ void FieldEditor::Render()
 		}
 		else if (IsEditableType(field->type ? field->type->name : ""))
 		{
-			if (const std::string typeName = field->type->name; typeName == "System.String")
+			if (const std::string_view typeName = field->type->name; typeName == "System.String")
 			{
 				RenderStringEditor();
 			}
@@ -322,7 +321,7 @@ void FieldEditor::Render()
 		else
 		{
 			ImGui::TextDisabled("This field type is not directly editable.");
-			ImGui::TextDisabled("Type: %s", field->type ? field->type->name.c_str() : "unknown");
+			ImGui::TextDisabled("Type: %s", field->type ? field->type->name.data() : "unknown");
 		}
 
 		ImGui::Separator();
@@ -410,30 +409,16 @@ bool FieldEditor::IsPointerType(std::string_view typeName)
 
 UR::Class* FieldEditor::GetPointerClass(std::string_view typeName)
 {
-	for (const auto& assembly : UR::assembly)
-	{
-		if (!assembly) continue;
-		for (const auto& klass : assembly->classes)
-		{
-			if (!klass) continue;
-			if (klass->m_name == typeName)
-				return klass.get();
-		}
-	}
+	if (const auto& byName = UR::GetClassesByName(typeName); !byName.empty())
+		return byName.front();
+
+	if (UR::Class* byFullName = UR::GetClass(typeName))
+		return byFullName;
 
 	if (const size_t lastDot = typeName.rfind('.'); lastDot != std::string::npos)
 	{
-		const std::string_view shortName = typeName.substr(lastDot + 1);
-		for (const auto& assembly : UR::assembly)
-		{
-			if (!assembly) continue;
-			for (const auto& klass : assembly->classes)
-			{
-				if (!klass) continue;
-				if (klass->m_name == shortName)
-					return klass.get();
-			}
-		}
+		if (const auto& byShortName = UR::GetClassesByName(typeName.substr(lastDot + 1)); !byShortName.empty())
+			return byShortName.front();
 	}
 
 	return nullptr;
@@ -1077,7 +1062,7 @@ void FieldEditor::RenderNestedInspector()
 
 	ImGui::TextDisabled("This field points to an instance of:");
 	ImGui::PushStyleColor(ImGuiCol_Text, ImVec4(0.4f, 0.7f, 1.0f, 1.0f));
-	ImGui::Text("%s", state.nestedClass->m_name.c_str());
+	ImGui::Text("%s", state.nestedClass->m_name.data());
 	ImGui::PopStyleColor();
 
 	ImGui::TextDisabled("Address: %p", state.nestedInstance);
@@ -1094,7 +1079,7 @@ void FieldEditor::RenderNestedInspector()
 		ImGui::TableSetupColumn("Value", ImGuiTableColumnFlags_WidthStretch);
 		ImGui::TableSetupColumn("Action", ImGuiTableColumnFlags_WidthFixed, 50.0f);
 
-		for (const auto& field : state.nestedClass->fields)
+		for (const auto& field : state.nestedClass->GetFields())
 		{
 			if (!field) continue;
 
@@ -1106,12 +1091,12 @@ void FieldEditor::RenderNestedInspector()
 			ImGui::TableSetColumnIndex(0);
 			ImVec4 color = field->static_field ? ImVec4(0.4f, 0.7f, 1.0f, 1.0f) : ImVec4(0.8f, 0.8f, 0.8f, 1.0f);
 			ImGui::PushStyleColor(ImGuiCol_Text, color);
-			ImGui::TextUnformatted(field->name.c_str());
+			ImGui::TextUnformatted(field->name.data());
 			ImGui::PopStyleColor();
 
 			ImGui::TableSetColumnIndex(1);
 			ImGui::PushStyleColor(ImGuiCol_Text, ImVec4(0.5f, 0.7f, 0.5f, 1.0f));
-			std::string typeName = field->type ? field->type->name : "unknown";
+			std::string typeName(field->type ? field->type->name : "unknown");
 			if (typeName.length() > 30) typeName = typeName.substr(0, 27) + "...";
 			ImGui::TextUnformatted(typeName.c_str());
 			ImGui::PopStyleColor();
@@ -1125,7 +1110,7 @@ void FieldEditor::RenderNestedInspector()
 				ImGui::PushID(field.get());
 				if (ImGui::SmallButton("Edit"))
 				{
-					std::string title = "Edit " + state.nestedClass->m_name + "." + field->name;
+					std::string title = std::format("Edit {}.{}", state.nestedClass->m_name, field->name);
 					auto editor = std::make_unique<FieldEditor>();
 					editor->OpenFieldEditor(field.get(), state.nestedInstance, title);
 					pendingEditors.push_back(std::move(editor));
@@ -1146,7 +1131,7 @@ void FieldEditor::RenderNestedFieldValue(const UR::Field* field, void* instance)
 		return;
 	}
 
-	const std::string typeName = field->type->name;
+	const std::string typeName(field->type->name);
 	const auto fieldAddr = reinterpret_cast<void*>(
 		reinterpret_cast<uintptr_t>(instance) + field->offset);
 
@@ -4,7 +4,7 @@
 
 EditableType DetermineEditableType(std::string_view typeName, std::string* enumTypeNameOut = nullptr);
 
-std::vector<std::pair<std::string, int>> GetEnumValues(std::string_view enumTypeName);
+const std::vector<std::pair<std::string, int>>& GetEnumValues(std::string_view enumTypeName);
 
 bool IsUInt64WrappingType(std::string_view typeName);
 
@@ -0,0 +1,150 @@
+#include "pch.h"
+#include "inspector.h"
+
+namespace
+{
+	constexpr uint32_t CANCEL_CHECK_INTERVAL = 4096;
+
+	std::shared_ptr<const HierarchySearchMatches> MatchHierarchy(std::shared_ptr<const HierarchySearchIndex> index,
+	                                                             const Helper::SearchNeedle& needle,
+	                                                             const std::atomic<bool>* cancel)
+	{
+		auto matches = std::make_shared<HierarchySearchMatches>();
+		const auto count = static_cast<uint32_t>(index->nodes.size());
+		matches->search = needle.Lower();
+		matches->selfMatches.assign((count + 63) / 64, 0);
+		matches->subtreeMatches.assign((count + 63) / 64, 0);
+
+		for (uint32_t i = 0; i < count; i++)
+		{
+			if (cancel && i % CANCEL_CHECK_INTERVAL == 0 && cancel->load(std::memory_order_relaxed))
+				return nullptr;
+
+			if (needle.FoundIn(index->Name(i)))
+			{
+				matches->selfMatches[i >> 6] |= 1ull << (i & 63);
+				matches->subtreeMatches[i >> 6] |= 1ull << (i & 63);
+			}
+		}
+
+		// Pre-order puts every node before its descendants, so walking backwards settles each subtree
+		// before its parent is reached
+		for (uint32_t i = count; i-- > 0;)
+		{
+			const uint32_t parent = index->parents[i];
+			if (parent != HierarchySearchIndex::NO_PARENT && matches->Subtree(i))
+				matches->subtreeMatches[parent >> 6] |= 1ull << (parent & 63);
+		}
+
+		matches->index = std::move(index);
+		return matches;
+	}
+}
+
+std::shared_ptr<const HierarchySearchIndex> Inspector::BuildHierarchySearchIndex()
+{
+	auto index = std::make_shared<HierarchySearchIndex>();
+	index->version = hierarchySync.version;
+	index->prunes = hierarchySync.prunes;
+
+	const size_t expected = hierarchySync.nodes.size();
+	index->nodes.reserve(expected);
+	index->gameObjects.reserve(expected);
+	index->parents.reserve(expected);
+	index->depths.reserve(expected);
+	index->nameOffsets.reserve(expected + 1);
+
+	const uint32_t stamp = ++hierarchySync.visits;
+	std::vector<std::pair<HierarchyNode*, uint32_t>> stack;
+	for (auto root = rootNodes.rbegin(); root != rootNodes.rend(); ++root)
+		stack.emplace_back(*root, HierarchySearchIndex::NO_PARENT);
+
+	while (!stack.empty())
+	{
+		const auto [node, parent] = stack.back();
+		stack.pop_back();
+		if (node->visitStamp == stamp) continue;
+		node->visitStamp = stamp;
+
+		const auto i = static_cast<uint32_t>(index->nodes.size());
+		const int depth = parent == HierarchySearchIndex::NO_PARENT ? 0 : index->depths[parent] + 1;
+		index->nodes.push_back(node);
+		index->gameObjects.push_back(node->gameObject);
+		index->parents.push_back(parent);
+		index->depths.push_back(static_cast<uint16_t>(std::min(depth, UINT16_MAX)));
+		index->nameOffsets.push_back(static_cast<uint32_t>(index->namePool.size()));
+		index->namePool += node->name;
+
+		for (auto child = node->children.rbegin(); child != node->children.rend(); ++child)
+			stack.emplace_back(*child, i);
+	}
+	index->nameOffsets.push_back(static_cast<uint32_t>(index->namePool.size()));
+
+	const auto count = static_cast<uint32_t>(index->nodes.size());
+	index->subtreeEnds.resize(count);
+	for (uint32_t i = 0; i < count; i++)
+		index->subtreeEnds[i] = i + 1;
+	for (uint32_t i = count; i-- > 0;)
+	{
+		if (const uint32_t parent = index->parents[i]; parent != HierarchySearchIndex::NO_PARENT)
+			index->subtreeEnds[parent] = std::max(index->subtreeEnds[parent], index->subtreeEnds[i]);
+	}
+
+	return index;
+}
+
+// Returns the newest finished match set, which may still be for an older search text or index.
+// Small trees are matched inline; larger ones on a worker that is cancelled when the text changes.
+std::shared_ptr<const HierarchySearchMatches> Inspector::UpdateHierarchySearch(const Helper::SearchNeedle& search)
+{
+	HierarchySearchJob& job = hierarchySearch;
+	if (job.running)
+	{
+		if (job.runningSearch != search.Lower())
+			job.cancel = true;
+
+		std::scoped_lock lock(job.mutex);
+		return job.completed;
+	}
+
+	if (job.thread.joinable())
+		job.thread.join();
+
+	// While a sync pass is still streaming changes in, the previous index is reused instead of copying
+	// the tree every frame; it only becomes unusable once nodes were destroyed after it was taken
+	if (!job.index || job.index->prunes != hierarchySync.prunes ||
+		(job.index->version != hierarchySync.version && !hierarchySync.active))
+	{
+		job.index = BuildHierarchySearchIndex();
+	}
+
+	{
+		std::scoped_lock lock(job.mutex);
+		if (job.completed && job.completed->index == job.index && job.completed->search == search.Lower())
+			return job.completed;
+	}
+
+	if (job.index->nodes.size() < hierarchySearchAsyncNodes)
+	{
+		auto matches = MatchHierarchy(job.index, search, nullptr);
+		std::scoped_lock lock(job.mutex);
+		job.completed = std::move(matches);
+		return job.completed;
+	}
+
+	job.runningSearch = search.Lower();
+	job.cancel = false;
+	job.running = true;
+	job.thread = std::thread([&job, index = job.index, needle = search]
+	{
+		if (auto matches = MatchHierarchy(index, needle, &job.cancel))
+		{
+			std::scoped_lock lock(job.mutex);
+			job.completed = std::move(matches);
+		}
+		job.running = false;
+	});
+
+	std::scoped_lock lock(job.mutex);
+	return job.completed;
+}
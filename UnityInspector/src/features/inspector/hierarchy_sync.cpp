@@ -0,0 +1,210 @@
+#include "pch.h"
+#include "inspector.h"
+#include "helper/helper.h"
+
+namespace
+{
+	void ReadNodeName(UT::GameObject* gameObject, std::string& outName)
+	{
+		if (UT::String* nameStr = nullptr; Helper::SafeGetName(gameObject, nameStr) && nameStr)
+			outName = nameStr->ToString();
+		else
+			outName = "(Unnamed)";
+	}
+}
+
+void Inspector::RefreshHierarchy()
+{
+	if (hierarchySync.active) return;
+
+	const auto assembly = UR::Get("UnityEngine.CoreModule.dll");
+	if (!assembly) return;
+
+	const auto transformClass = assembly->Get("Transform", "UnityEngine");
+	if (!transformClass) return;
+	std::vector<UT::Transform*> transforms = transformClass->FindObjectsByType<UT::Transform*>();
+	if (transforms.empty())
+	{
+		transforms = transformClass->FindObjectsOfType<UT::Transform*>();
+		if (transforms.empty())
+		{
+			rootNodes.clear();
+			hierarchySync.nodes.clear();
+			hierarchySync.version++;
+			hierarchySync.prunes++;
+			return;
+		}
+	}
+
+	HierarchySync& sync = hierarchySync;
+	sync.pass++;
+	sync.pending.clear();
+	sync.orphansChecked = false;
+
+	// Only transforms never seen before and last pass's roots need their parent checked here; every
+	// other known transform is confirmed or dropped when its parent's child list is walked again.
+	std::vector<HierarchyNode*> newRoots;
+	for (UT::Transform* t : transforms)
+	{
+		const auto known = sync.nodes.find(t);
+		if (known != sync.nodes.end() && !known->second->isRoot) continue;
+		if (!Helper::SafeIsAlive(t)) continue;
+
+		UT::Transform* parent = nullptr;
+		if (!Helper::SafeGetParent(t, parent))
+			continue;
+
+		if (known != sync.nodes.end())
+		{
+			known->second->isRoot = !parent;
+			if (!parent) known->second->seenPass = sync.pass;
+			continue;
+		}
+
+		if (!parent)
+		{
+			if (HierarchyNode* node = AcquireHierarchyNode(t))
+			{
+				node->isRoot = true;
+				node->seenPass = sync.pass;
+				newRoots.push_back(node);
+			}
+		}
+	}
+
+	const size_t droppedRoots = std::erase_if(rootNodes, [&](const HierarchyNode* node)
+	{
+		return !node->isRoot || node->seenPass != sync.pass;
+	});
+	rootNodes.insert(rootNodes.end(), newRoots.begin(), newRoots.end());
+	if (droppedRoots || !newRoots.empty())
+		sync.version++;
+
+	sync.pending.assign(rootNodes.rbegin(), rootNodes.rend());
+	sync.active = true;
+}
+
+void Inspector::StepHierarchySync()
+{
+	HierarchySync& sync = hierarchySync;
+	if (!sync.active) return;
+
+	const auto deadline = std::chrono::steady_clock::now() +
+		std::chrono::duration<double, std::milli>(hierarchySyncBudgetMs);
+
+	size_t walked = 0;
+	while (true)
+	{
+		if (sync.pending.empty() && FinishHierarchySync())
+			return;
+
+		HierarchyNode* node = sync.pending.back();
+		sync.pending.pop_back();
+		SyncHierarchyChildren(*node);
+
+		if (++walked % hierarchySyncCheckInterval == 0 && std::chrono::steady_clock::now() >= deadline)
+			return;
+	}
+}
+
+// Returns false when transforms that were moved to the scene root turned up and still need walking
+bool Inspector::FinishHierarchySync()
+{
+	HierarchySync& sync = hierarchySync;
+	if (!sync.orphansChecked)
+	{
+		sync.orphansChecked = true;
+		for (const auto& [transform, node] : sync.nodes)
+		{
+			if (node->seenPass == sync.pass || !Helper::SafeIsAlive(transform)) continue;
+
+			UT::Transform* parent = nullptr;
+			if (!Helper::SafeGetParent(transform, parent) || parent) continue;
+
+			node->isRoot = true;
+			node->seenPass = sync.pass;
+			rootNodes.push_back(node.get());
+			sync.pending.push_back(node.get());
+			sync.version++;
+		}
+		if (!sync.pending.empty()) return false;
+	}
+
+	if (std::erase_if(sync.nodes, [&](const auto& entry) { return entry.second->seenPass != sync.pass; }))
+		sync.prunes++;
+	sync.active = false;
+	return true;
+}
+
+void Inspector::SyncHierarchyChildren(HierarchyNode& node)
+{
+	HierarchySync& sync = hierarchySync;
+
+	int childCount = 0;
+	if (!Helper::SafeIsAlive(node.transform) || !Helper::SafeGetChildCount(node.transform, childCount))
+	{
+		if (!node.children.empty())
+		{
+			node.children.clear();
+			sync.version++;
+		}
+		return;
+	}
+
+	std::vector<HierarchyNode*>& children = sync.scratchChildren;
+	children.clear();
+	for (int i = 0; i < childCount; i++)
+	{
+		if (UT::Transform* child = nullptr; Helper::SafeGetChild(node.transform, i, child) && child)
+		{
+			HierarchyNode* childNode = AcquireHierarchyNode(child);
+			if (!childNode || childNode->seenPass == sync.pass) continue;
+
+			childNode->seenPass = sync.pass;
+			childNode->isRoot = false;
+			children.push_back(childNode);
+		}
+	}
+
+	if (children != node.children)
+	{
+		node.children.assign(children.begin(), children.end());
+		sync.version++;
+	}
+	sync.pending.insert(sync.pending.end(), children.rbegin(), children.rend());
+}
+
+HierarchyNode* Inspector::AcquireHierarchyNode(UT::Transform* transform)
+{
+	if (const auto it = hierarchySync.nodes.find(transform); it != hierarchySync.nodes.end())
+		return it->second.get();
+
+	if (!Helper::SafeIsAlive(transform)) return nullptr;
+
+	UT::GameObject* go = nullptr;
+	if (!Helper::SafeGetGameObject(transform, go) || !go || !Helper::SafeIsAlive(go))
+		return nullptr;
+
+	auto node = std::make_unique<HierarchyNode>();
+	node->transform = transform;
+	node->gameObject = go;
+	node->namedPass = hierarchySync.pass;
+	ReadNodeName(go, node->name);
+	return hierarchySync.nodes.emplace(transform, std::move(node)).first->second.get();
+}
+
+// Names are only resolved when a node is created; visible rows re-read theirs once per sync pass
+void Inspector::RefreshHierarchyNodeName(HierarchyNode& node)
+{
+	node.namedPass = hierarchySync.pass;
+	if (UT::GameObject* go = nullptr; Helper::SafeGetGameObject(node.transform, go) && go)
+		node.gameObject = go;
+
+	std::string name;
+	ReadNodeName(node.gameObject, name);
+	if (name != node.name)
+	{
+		node.name = std::move(name);
+		hierarchySync.version++;
+	}
+}
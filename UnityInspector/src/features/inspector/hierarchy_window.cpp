@@ -15,87 +15,182 @@ static void AppendNodeTree(const HierarchyNode& node, std::string& out, int dept
 	out += "\n";
 
 	int idx = 0;
-	for (const auto& child : node.children)
+	for (const HierarchyNode* child : node.children)
 	{
 		for (int i = 0; i < depth; i++)
 			out += "| ";
 		out += "|   [" + std::to_string(idx) + "]\n";
-		AppendNodeTree(child, out, depth + 1);
+		AppendNodeTree(*child, out, depth + 1);
 		idx++;
 	}
 }
 
-bool Inspector::NodeMatchesSearch(const HierarchyNode& node, std::string_view lowerSearch) const
+// AppendNodeTree over a search index, leaving out every subtree without a match
+static void AppendMatchedTree(const HierarchySearchMatches& matches, const uint32_t i, std::string& out, int depth)
 {
-	if (lowerSearch.empty()) return true;
-	if (Helper::CaseInsensitiveFind(node.name, lowerSearch)) return true;
-	for (const auto& child : node.children)
+	const HierarchySearchIndex& index = *matches.index;
+	for (int d = 0; d < depth; d++)
+		out += (d == depth - 1) ? "  " : "| ";
+
+	bool isActive = true;
+	Helper::SafeGetActiveSelf(index.gameObjects[i], isActive);
+
+	out += "+-- [" + std::to_string(depth) + "] ";
+	out += index.Name(i);
+	if (!isActive) out += " (inactive)";
+	out += "\n";
+
+	int idx = 0;
+	for (uint32_t child = i + 1; child < index.subtreeEnds[i]; child = index.subtreeEnds[child])
 	{
-		if (NodeMatchesSearch(child, lowerSearch)) return true;
+		if (!matches.Subtree(child)) continue;
+		for (int d = 0; d < depth; d++)
+			out += "| ";
+		out += "|   [" + std::to_string(idx) + "]\n";
+		AppendMatchedTree(matches, child, out, depth + 1);
+		idx++;
 	}
-	return false;
 }
 
-void Inspector::SetAllNodesExpanded(std::vector<HierarchyNode>& nodes, bool expanded)
+void Inspector::SetAllNodesExpanded(const std::vector<HierarchyNode*>& nodes, bool expanded)
 {
-	for (auto& node : nodes)
+	for (HierarchyNode* node : nodes)
 	{
-		node.pendingExpand = true;
-		node.pendingExpandValue = expanded;
-		SetAllNodesExpanded(node.children, expanded);
+		node->expanded = expanded;
+		SetAllNodesExpanded(node->children, expanded);
 	}
+	hierarchySync.version++;
 }
 
-void Inspector::RenderHierarchyNode(HierarchyNode& node, std::string_view lowerSearch, const int depth)
+void Inspector::AppendHierarchyRows(HierarchyNode& node, const int depth)
 {
-	if (!Helper::SafeIsAlive(node.gameObject)) return;
+	if (node.visitStamp == hierarchySync.visits) return;
+	node.visitStamp = hierarchySync.visits;
 
-	const bool searching = !lowerSearch.empty();
+	hierarchyView.rows.push_back({&node, static_cast<uint16_t>(std::min(depth, UINT16_MAX))});
+	if (!node.expanded) return;
 
-	if (searching && !NodeMatchesSearch(node, lowerSearch))
+	for (HierarchyNode* child : node.children)
+		AppendHierarchyRows(*child, depth + 1);
+}
+
+// Without a search the rows are walked from the live tree through expanded nodes. With one they come
+// from the latest match set: every ancestor of a match is shown open and subtrees without a match are
+// skipped whole. Rows from an older match set stay up until the worker publishes a newer one.
+void Inspector::RebuildHierarchyRows(const Helper::SearchNeedle& search)
+{
+	HierarchyView& view = hierarchyView;
+	if (search.Empty())
+	{
+		if (!view.matches && view.builtForSearch.empty() && view.builtForVersion == hierarchySync.version &&
+			view.builtForPrunes == hierarchySync.prunes)
+			return;
+
+		view.matches.reset();
+		view.builtForSearch.clear();
+		view.builtForVersion = hierarchySync.version;
+		view.builtForPrunes = hierarchySync.prunes;
+		view.rows.clear();
+
+		++hierarchySync.visits;
+		for (HierarchyNode* node : rootNodes)
+			AppendHierarchyRows(*node, 0);
 		return;
+	}
 
-	if (searching)
+	const auto matches = UpdateHierarchySearch(search);
+	if (matches && matches != view.matches && matches->search == search.Lower() &&
+		matches->index->prunes == hierarchySync.prunes)
 	{
-		ImGui::SetNextItemOpen(true);
+		view.matches = matches;
+		view.builtForSearch = matches->search;
+		view.builtForVersion = matches->index->version;
+		view.builtForPrunes = matches->index->prunes;
+		view.rows.clear();
+
+		const HierarchySearchIndex& index = *matches->index;
+		for (uint32_t i = 0; i < index.nodes.size();)
+		{
+			if (!matches->Subtree(i))
+			{
+				i = index.subtreeEnds[i];
+				continue;
+			}
+			view.rows.push_back({index.nodes[i], index.depths[i], matches->Self(i), i});
+			i++;
+		}
 	}
-	else if (node.pendingExpand)
+	else if (view.builtForPrunes != hierarchySync.prunes)
 	{
-		ImGui::SetNextItemOpen(node.pendingExpandValue);
-		node.pendingExpand = false;
+		view.matches.reset();
+		view.builtForPrunes = hierarchySync.prunes;
+		view.rows.clear();
 	}
+}
 
-	ImGui::PushID(node.gameObject);
+void Inspector::RenderHierarchyRows(const Helper::SearchNeedle& search)
+{
+	RebuildHierarchyRows(search);
+
+	const bool searching = !search.Empty();
+	ImGuiListClipper clipper;
+	clipper.Begin(static_cast<int>(hierarchyView.rows.size()));
+	while (clipper.Step())
+	{
+		for (int row = clipper.DisplayStart; row < clipper.DisplayEnd; row++)
+			RenderHierarchyRow(hierarchyView.rows[row], searching);
+	}
+}
+
+void Inspector::RenderHierarchyRow(const HierarchyRow& row, const bool searching)
+{
+	HierarchyNode& node = *row.node;
+	const float indent = row.depth * ImGui::GetStyle().IndentSpacing;
+	if (indent > 0.0f)
+		ImGui::SetCursorPosX(ImGui::GetCursorPosX() + indent);
+
+	bool isActive = true;
+	if (!Helper::SafeIsAlive(node.gameObject) || !Helper::SafeGetActiveSelf(node.gameObject, isActive))
+	{
+		ImGui::TextDisabled("%s (destroyed)", node.name.c_str());
+		return;
+	}
+
+	if (node.namedPass != hierarchySync.pass)
+		RefreshHierarchyNodeName(node);
 
 	const bool hasChildren = !node.children.empty();
 	const bool isSelected = (FindTabForObject(node.gameObject) >= 0);
 
 	ImGuiTreeNodeFlags flags = ImGuiTreeNodeFlags_OpenOnArrow |
 		ImGuiTreeNodeFlags_SpanAvailWidth |
-		ImGuiTreeNodeFlags_FramePadding;
+		ImGuiTreeNodeFlags_FramePadding |
+		ImGuiTreeNodeFlags_NoTreePushOnOpen;
 
-	if (!hasChildren) flags |= ImGuiTreeNodeFlags_Leaf | ImGuiTreeNodeFlags_NoTreePushOnOpen;
+	if (!hasChildren) flags |= ImGuiTreeNodeFlags_Leaf;
 	if (isSelected) flags |= ImGuiTreeNodeFlags_Selected;
 
-	bool isActive = true;
-	if (!Helper::SafeGetActiveSelf(node.gameObject, isActive))
-	{
-		ImGui::PopID();
-		return;
-	}
-
-	if (!isActive)
+	const bool dimmed = !isActive || (searching && !row.matches);
+	if (dimmed)
 		ImGui::PushStyleColor(ImGuiCol_Text, ImVec4(0.5f, 0.5f, 0.5f, 1.0f));
 
-	std::string label = node.name;
-	if (hasChildren)
-		label += " [" + std::to_string(node.children.size()) + "]";
+	ImGui::SetNextItemOpen(searching ? hasChildren : node.expanded);
+	const bool nodeOpen = hasChildren
+		                      ? ImGui::TreeNodeEx(node.gameObject, flags, "%s [%zu]", node.name.c_str(),
+		                                          node.children.size())
+		                      : ImGui::TreeNodeEx(node.gameObject, flags, "%s", node.name.c_str());
 
-	const bool nodeOpen = ImGui::TreeNodeEx(label.c_str(), flags);
-
-	if (!isActive)
+	if (dimmed)
 		ImGui::PopStyleColor();
 
+	if (!searching && hasChildren && nodeOpen != node.expanded)
+	{
+		node.expanded = nodeOpen;
+		hierarchySync.version++;
+	}
+
+	ImGui::PushID(node.gameObject);
+
 	if (ImGui::IsItemHovered())
 	{
 		ImGui::BeginTooltip();
@@ -137,15 +232,30 @@ void Inspector::RenderHierarchyNode(HierarchyNode& node, std::string_view lowerS
 			}
 		}
 
-		if (ImGui::MenuItem("Copy Hierarchy"))
+		if (ImGui::MenuItem(row.index != HierarchyRow::NO_INDEX ? "Copy Matching Hierarchy" : "Copy Hierarchy"))
 		{
 			std::string tree = node.name + "\n";
 			int idx = 0;
-			for (const auto& child : node.children)
+			if (const auto& matches = hierarchyView.matches; matches && row.index != HierarchyRow::NO_INDEX)
 			{
-				tree += "  [" + std::to_string(idx) + "]\n";
-				AppendNodeTree(child, tree, 1);
-				idx++;
+				const HierarchySearchIndex& index = *matches->index;
+				for (uint32_t child = row.index + 1; child < index.subtreeEnds[row.index];
+				     child = index.subtreeEnds[child])
+				{
+					if (!matches->Subtree(child)) continue;
+					tree += "  [" + std::to_string(idx) + "]\n";
+					AppendMatchedTree(*matches, child, tree, 1);
+					idx++;
+				}
+			}
+			else
+			{
+				for (const HierarchyNode* child : node.children)
+				{
+					tree += "  [" + std::to_string(idx) + "]\n";
+					AppendNodeTree(*child, tree, 1);
+					idx++;
+				}
 			}
 			ImGui::SetClipboardText(tree.c_str());
 		}
@@ -154,7 +264,10 @@ void Inspector::RenderHierarchyNode(HierarchyNode& node, std::string_view lowerS
 		{
 			ImGui::Separator();
 			if (ImGui::MenuItem("Expand Children"))
+			{
+				node.expanded = true;
 				SetAllNodesExpanded(node.children, true);
+			}
 			if (ImGui::MenuItem("Collapse Children"))
 				SetAllNodesExpanded(node.children, false);
 		}
@@ -162,12 +275,5 @@ void Inspector::RenderHierarchyNode(HierarchyNode& node, std::string_view lowerS
 		ImGui::EndPopup();
 	}
 
-	if (hasChildren && nodeOpen)
-	{
-		for (auto& child : node.children)
-			RenderHierarchyNode(child, lowerSearch, depth + 1);
-		ImGui::TreePop();
-	}
-
 	ImGui::PopID();
 }
@@ -4,6 +4,13 @@
 
 REGISTER_FEATURE(Inspector)
 
+Inspector::~Inspector()
+{
+	hierarchySearch.cancel = true;
+	if (hierarchySearch.thread.joinable())
+		hierarchySearch.thread.join();
+}
+
 void Inspector::Update(const float deltaTime)
 {
 	s_Instance = this;
@@ -14,6 +21,8 @@ void Inspector::Update(const float deltaTime)
 
 	UR::ThreadAttach();
 
+	StepHierarchySync();
+
 	static float timer = 0.0f;
 	timer += deltaTime;
 
@@ -26,7 +35,7 @@ void Inspector::Update(const float deltaTime)
 
 		if (AutoUpdateObject && activeTabIndex >= 0 && std::cmp_less(activeTabIndex, openTabs.size()))
 		{
-			RefreshTabData(openTabs[activeTabIndex]);
+			RefreshTabValues(openTabs[activeTabIndex]);
 		}
 	}
 }
@@ -60,7 +69,8 @@ void Inspector::Render()
 					SetAllNodesExpanded(rootNodes, true);
 
 				ImGui::SameLine();
-				ImGui::TextDisabled("| %zu", rootNodes.size());
+				const char* state = hierarchySync.active ? " (syncing)" : hierarchySearch.running ? " (searching)" : "";
+				ImGui::TextDisabled("| %zu%s", rootNodes.size(), state);
 
 				ImGui::SameLine();
 				{
@@ -102,12 +112,8 @@ void Inspector::Render()
 					}
 					else
 					{
-						std::string lowerSearch = searchBuffer;
-						std::ranges::transform(lowerSearch, lowerSearch.begin(), tolower);
-						for (auto& node : rootNodes)
-						{
-							RenderHierarchyNode(node, lowerSearch);
-						}
+						const Helper::SearchNeedle search(searchBuffer);
+						RenderHierarchyRows(search);
 					}
 				}
 				ImGui::EndChild();
@@ -156,16 +162,11 @@ void Inspector::Render()
 					}
 					else
 					{
-						std::string lowerSearch;
-						if (staticSearchBuffer[0] != '\0')
-						{
-							lowerSearch = staticSearchBuffer;
-							std::ranges::transform(lowerSearch, lowerSearch.begin(), tolower);
-						}
+						const Helper::SearchNeedle search(staticSearchBuffer);
 
 						for (const auto& node : staticInstances)
 						{
-							if (!lowerSearch.empty() && !Helper::CaseInsensitiveFind(node.fullName, lowerSearch))
+							if (!search.FoundIn(node.fullName))
 								continue;
 
 							if (ImGui::Selectable(node.fullName.c_str()))
@@ -202,7 +203,7 @@ void Inspector::ScanStaticClasses()
 		{
 			if (!klass) continue;
 
-			for (const auto& field : klass->fields)
+			for (const auto& field : klass->GetFields())
 			{
 				try
 				{
@@ -217,7 +218,7 @@ void Inspector::ScanStaticClasses()
 							klass->m_name.find('$') != std::string::npos)
 							continue;
 
-						std::string typeName = field->type->name;
+						std::string typeName(field->type->name);
 						if (typeName.starts_with("System.") || typeName.starts_with("UnityEngine.") || typeName.
 							starts_with("Unity."))
 							continue;
@@ -254,10 +255,9 @@ void Inspector::ScanStaticClasses()
 							node.instance = instance;
 							node.typeClassHandle = typeClassHandle;
 
-							std::string kName = klass->namespaze.empty()
-								                    ? klass->m_name
-								                    : klass->namespaze + "." + klass->m_name;
-							node.name = kName + "." + field->name;
+							node.name = klass->namespaze.empty()
+								            ? std::format("{}.{}", klass->m_name, field->name)
+								            : std::format("{}.{}.{}", klass->namespaze, klass->m_name, field->name);
 							node.fullName = node.name + " (" + typeName + ")";
 							staticInstances.push_back(std::move(node));
 						}
@@ -296,9 +296,7 @@ void Inspector::OpenStaticInstanceInNewTab(const StaticInstanceNode& node)
 	rootTarget.cachedComponents.push_back(static_cast<UT::Component*>(node.instance));
 	rootTarget.cachedComponentNames.push_back(node.fullName);
 
-	rootTarget.cachedComponentFields.push_back(GetObjectFields(node.instance, node.typeClassHandle));
-	rootTarget.cachedComponentProperties.push_back(GetObjectProperties(node.instance, node.typeClassHandle));
-	rootTarget.cachedComponentMethods.push_back(GetObjectMethods(node.instance, node.typeClassHandle));
+	rootTarget.cachedDescriptors.push_back(GetClassDescriptor(node.instance, node.typeClassHandle));
 
 	newTab.navigationStack.push_back(std::move(rootTarget));
 
@@ -312,8 +310,6 @@ void Inspector::InspectInstance(void* instance, void* classHandle, const std::st
 {
 	if (openTabs.size() >= maxTabs) return;
 
-	const bool mono = Config::state.unityMode == UnityResolve::Mode::Mono;
-
 	InspectedObjectTab newTab;
 	newTab.gameObject = nullptr;
 	newTab.tabName = name;
@@ -328,24 +324,18 @@ void Inspector::InspectInstance(void* instance, void* classHandle, const std::st
 	{
 		rootTarget.cachedComponents.push_back(static_cast<UT::Component*>(instance));
 		std::string className = "(Unknown)";
-		if (const char* cn = UR::Invoke<const char*, void*>(mono ? "mono_class_get_name" : "il2cpp_class_get_name",
-		                                                    classHandle))
+		if (const char* cn = UR::Invoke<const char*, void*>(UR::Export::ClassGetName, classHandle))
 			className = cn;
 		rootTarget.cachedComponentNames.push_back(className);
-		rootTarget.cachedComponentFields.push_back(GetObjectFields(instance, classHandle));
-		rootTarget.cachedComponentProperties.push_back(GetObjectProperties(instance, classHandle));
-		rootTarget.cachedComponentMethods.push_back(GetObjectMethods(instance, classHandle));
+		rootTarget.cachedDescriptors.push_back(GetClassDescriptor(instance, classHandle));
 	}
 	else
 	{
 		std::string className = "(Unknown)";
-		if (const char* cn = UR::Invoke<const char*, void*>(mono ? "mono_class_get_name" : "il2cpp_class_get_name",
-		                                                    classHandle))
+		if (const char* cn = UR::Invoke<const char*, void*>(UR::Export::ClassGetName, classHandle))
 			className = cn;
 		rootTarget.cachedComponentNames.push_back(className + " (static)");
-		rootTarget.cachedComponentFields.push_back(GetObjectFields(nullptr, classHandle));
-		rootTarget.cachedComponentProperties.push_back(GetObjectProperties(nullptr, classHandle));
-		rootTarget.cachedComponentMethods.push_back(GetObjectMethods(nullptr, classHandle));
+		rootTarget.cachedDescriptors.push_back(GetClassDescriptor(nullptr, classHandle));
 	}
 
 	newTab.navigationStack.push_back(std::move(rootTarget));
@@ -1,6 +1,7 @@
 #pragma once
 #include "features/features.h"
 #include "features/inspector/field_editor.h"
+#include "helper/text_search.h"
 
 struct ComponentPropertyInfo final
 {
@@ -25,6 +26,149 @@ struct ComponentMethodInfo final
 	void* methodHandle = nullptr;
 };
 
+// Reflection metadata for one class, built once and shared by every target inspecting that class
+struct ClassDescriptor final
+{
+	std::string name;
+	std::vector<ComponentFieldInfo> fields;
+	std::vector<ComponentPropertyInfo> properties;
+	std::vector<ComponentMethodInfo> methods;
+};
+
+enum class CollectionKind : uint8_t
+{
+	Array,
+	List,
+	Dictionary,
+	HashSet
+};
+
+// How an element is decoded when a collection is filtered or sorted; None for elements that cannot be
+enum class CollectionScalar : uint8_t
+{
+	None,
+	I8,
+	U8,
+	I16,
+	U16,
+	I32,
+	U32,
+	I64,
+	U64,
+	F32,
+	F64,
+	Bool,
+	Enum,
+	String
+};
+
+// Memory layout of one collection type, parsed once per type name. `element` describes the element
+// (the key, for dictionaries) with its offset inside an element/entry/slot; rows add index * stride.
+struct CollectionLayout final
+{
+	CollectionKind kind = CollectionKind::Array;
+	ComponentFieldInfo element;
+	ComponentFieldInfo value;
+	std::string elementTypeName;
+	std::string elementLabel;
+	int stride = 0;
+	bool hasDictionaryTypes = false;
+	bool valueIsReference = true;
+	CollectionScalar scalar = CollectionScalar::None;
+};
+
+// What a collection object currently holds: `count` is its size, `slots` the number of entries rows
+// walk (hash sets have free slots in between), `data` the address of entry 0
+struct CollectionHeader final
+{
+	int count = 0;
+	int slots = 0;
+	uintptr_t data = 0;
+};
+
+// Indices of a collection's entries that pass a filter, in sort order (0 unsorted, 1 ascending, 2 descending)
+struct CollectionOrder final
+{
+	uintptr_t data = 0;
+	int slots = 0;
+	std::string filter;
+	int sort = 0;
+	double builtAt = 0.0;
+	std::vector<uint32_t> indices;
+};
+
+struct CollectionView;
+
+// Row text that only depends on a field's type or current bytes, so it is not rebuilt every frame, and
+// the state of the field's collection view once it has been expanded
+struct FieldDisplayCache final
+{
+	std::string typeLabel;
+	std::string valueText;
+	std::array<uint8_t, 16> valueBytes{};
+	bool hasValueText = false;
+	const CollectionLayout* collectionLayout = nullptr;
+	std::shared_ptr<CollectionView> collection;
+};
+
+// One object's instance fields copied with a single guarded read, retaken every fieldSnapshotIntervalMs.
+// Rows read their values from the copy; fields outside it fall back to reading the object directly.
+struct FieldSnapshot final
+{
+	void* instance = nullptr;
+	const std::vector<ComponentFieldInfo>* fields = nullptr;
+	int begin = 0;
+	std::vector<uint8_t> bytes;
+	std::vector<FieldDisplayCache> display;
+	double takenAt = 0.0;
+	bool valid = false;
+	// Set while a widget is held (and for the frame after) so edits written to the object show up at once
+	bool editing = false;
+
+	template <typename T>
+	[[nodiscard]] bool Read(const void* object, const int offset, T& out) const
+	{
+		if (!valid || object != instance || offset < begin ||
+			static_cast<size_t>(offset - begin) + sizeof(T) > bytes.size())
+			return false;
+		std::memcpy(&out, bytes.data() + (offset - begin), sizeof(T));
+		return true;
+	}
+
+	[[nodiscard]] FieldDisplayCache* Display(const ComponentFieldInfo& field)
+	{
+		if (!fields) return nullptr;
+		const auto first = reinterpret_cast<uintptr_t>(fields->data());
+		const auto address = reinterpret_cast<uintptr_t>(&field);
+		if (address < first || address >= first + fields->size() * sizeof(ComponentFieldInfo)) return nullptr;
+		return &display[(address - first) / sizeof(ComponentFieldInfo)];
+	}
+};
+
+// An expanded collection field: the copy of the rows on screen, and the job that reads the whole
+// collection once to filter or sort it. The job runs on `thread` for large collections.
+struct CollectionView final
+{
+	FieldSnapshot page;
+	char filterBuffer[128] = {};
+	int sort = 0;
+	std::shared_ptr<const CollectionOrder> completed;
+	std::string runningFilter;
+	int runningSort = 0;
+	bool tooLarge = false;
+	std::mutex mutex;
+	std::thread thread;
+	std::atomic<bool> running = false;
+	std::atomic<bool> cancel = false;
+
+	~CollectionView()
+	{
+		cancel = true;
+		if (thread.joinable())
+			thread.join();
+	}
+};
+
 struct MethodInvokeState
 {
 	bool showPopup = false;
@@ -42,9 +186,98 @@ struct HierarchyNode final
 	UT::GameObject* gameObject = nullptr;
 	UT::Transform* transform = nullptr;
 	std::string name;
-	std::vector<HierarchyNode> children;
-	bool pendingExpand = false;
-	bool pendingExpandValue = false;
+	std::vector<HierarchyNode*> children;
+	uint32_t seenPass = 0;
+	uint32_t namedPass = 0;
+	uint32_t visitStamp = 0;
+	bool isRoot = false;
+	bool expanded = false;
+};
+
+struct HierarchyRow final
+{
+	HierarchyNode* node = nullptr;
+	uint16_t depth = 0;
+	bool matches = false;
+	// Position in the search index the row came from, NO_INDEX for rows walked from the live tree
+	uint32_t index = NO_INDEX;
+
+	static constexpr uint32_t NO_INDEX = UINT32_MAX;
+};
+
+// Persistent mirror of the scene's transform tree keyed by transform. Nodes keep their address and
+// expansion state across refreshes; a sync pass re-walks child lists a few milliseconds per frame
+// and only resolves the GameObject and name of transforms it has not seen before.
+struct HierarchySync final
+{
+	std::unordered_map<UT::Transform*, std::unique_ptr<HierarchyNode>> nodes;
+	std::vector<HierarchyNode*> pending;
+	std::vector<HierarchyNode*> scratchChildren;
+	uint32_t pass = 0;
+	// Bumped whenever a child list, the root list or a node's expansion changes
+	uint32_t version = 0;
+	// Bumped whenever nodes are destroyed; pointers taken under an older value may dangle
+	uint32_t prunes = 0;
+	// Marks nodes already emitted by a walk, since child lists of not-yet-synced nodes can be stale
+	uint32_t visits = 0;
+	bool active = false;
+	bool orphansChecked = false;
+};
+
+// Pre-order copy of the hierarchy with names packed into one pool, so matching can run off the main
+// thread. `nodes` is only dereferenced on the main thread while `prunes` equals HierarchySync::prunes.
+struct HierarchySearchIndex final
+{
+	std::vector<HierarchyNode*> nodes;
+	std::vector<UT::GameObject*> gameObjects;
+	std::vector<uint32_t> parents;
+	std::vector<uint32_t> subtreeEnds;
+	std::vector<uint16_t> depths;
+	std::vector<uint32_t> nameOffsets;
+	std::string namePool;
+	uint32_t version = 0;
+	uint32_t prunes = 0;
+
+	static constexpr uint32_t NO_PARENT = UINT32_MAX;
+
+	[[nodiscard]] std::string_view Name(const uint32_t i) const
+	{
+		return std::string_view(namePool).substr(nameOffsets[i], nameOffsets[i + 1] - nameOffsets[i]);
+	}
+};
+
+// Bit i refers to index->nodes[i]: whether that node's name matches, and whether anything in its subtree does
+struct HierarchySearchMatches final
+{
+	std::shared_ptr<const HierarchySearchIndex> index;
+	std::string search;
+	std::vector<uint64_t> selfMatches;
+	std::vector<uint64_t> subtreeMatches;
+
+	[[nodiscard]] bool Self(const uint32_t i) const { return selfMatches[i >> 6] >> (i & 63) & 1; }
+	[[nodiscard]] bool Subtree(const uint32_t i) const { return subtreeMatches[i >> 6] >> (i & 63) & 1; }
+};
+
+// The hierarchy flattened to the rows currently shown, rebuilt only when the tree, expansion or search
+// text changes so a frame only touches the rows the clipper lets through
+struct HierarchyView final
+{
+	std::vector<HierarchyRow> rows;
+	std::string builtForSearch;
+	uint32_t builtForVersion = UINT32_MAX;
+	uint32_t builtForPrunes = 0;
+	std::shared_ptr<const HierarchySearchMatches> matches;
+};
+
+struct HierarchySearchJob final
+{
+	std::shared_ptr<const HierarchySearchIndex> index;
+	std::shared_ptr<const HierarchySearchMatches> completed;
+	std::string runningSearch;
+	std::mutex mutex;
+	std::thread thread;
+	std::atomic<bool> running = false;
+	std::atomic<bool> cancel = false;
 };
 
 struct StaticInstanceNode
@@ -64,14 +297,13 @@ struct InspectionTarget
 
 	std::vector<UT::Component*> cachedComponents;
 	std::vector<std::string> cachedComponentNames;
-	std::vector<std::vector<ComponentFieldInfo>> cachedComponentFields;
-	std::vector<std::vector<ComponentPropertyInfo>> cachedComponentProperties;
-	std::vector<std::vector<ComponentMethodInfo>> cachedComponentMethods;
+	std::vector<std::shared_ptr<const ClassDescriptor>> cachedDescriptors;
 
 	char componentSearchBuffer[256] = {};
 	std::vector<std::array<char, 256>> fieldSearchBuffers;
 	std::vector<std::array<char, 256>> propertySearchBuffers;
 	std::vector<std::array<char, 256>> methodSearchBuffers;
+	std::vector<FieldSnapshot> fieldSnapshots;
 };
 
 struct InspectedObjectTab final
@@ -82,6 +314,8 @@ struct InspectedObjectTab final
 	bool isActive = false;
 
 	std::vector<InspectionTarget> navigationStack;
+	// Reused by every value refresh so an unchanged component list costs no allocation
+	std::vector<UT::Component*> scratchComponents;
 
 	bool filterEditableOnly = false;
 	bool filterStaticOnly = false;
@@ -96,6 +330,7 @@ class Inspector final : public IFeature
 public:
 	void Update(float deltaTime) override;
 	void Render() override;
+	~Inspector() override;
 
 	static Inspector* GetInstance() { return s_Instance; }
 	void InspectInstance(void* instance, void* classHandle, std::string_view name);
@@ -103,7 +338,10 @@ public:
 private:
 	static inline Inspector* s_Instance = nullptr;
 	bool showDetailsWindow = false;
-	std::vector<HierarchyNode> rootNodes;
+	std::vector<HierarchyNode*> rootNodes;
+	HierarchySync hierarchySync;
+	HierarchyView hierarchyView;
+	HierarchySearchJob hierarchySearch;
 	char searchBuffer[256] = {};
 
 	std::vector<StaticInstanceNode> staticInstances;
@@ -114,6 +352,16 @@ private:
 	int activeTabIndex = -1;
 	bool pendingTabSwitch = false;
 	static constexpr int maxTabs = 10;
+	static constexpr double hierarchySyncBudgetMs = 2.0;
+	static constexpr size_t hierarchySyncCheckInterval = 32;
+	static constexpr size_t hierarchySearchAsyncNodes = 20000;
+	static constexpr double fieldSnapshotIntervalMs = 100.0;
+	static constexpr int fieldSnapshotMaxBytes = 64 * 1024;
+	static constexpr int collectionMaxSlots = 1 << 24;
+	static constexpr int collectionToolsMinSlots = 100;
+	static constexpr int collectionOrderAsyncSlots = 20000;
+	static constexpr double collectionOrderRefreshMs = 1000.0;
+	static constexpr size_t collectionMaterializeMaxBytes = 64 * 1024 * 1024;
 
 	std::deque<UT::GameObject*> recentSelections;
 	std::vector<UT::GameObject*> pinnedObjects;
@@ -124,10 +372,18 @@ private:
 	std::unique_ptr<FieldEditor> fieldEditor;
 
 	void RefreshHierarchy();
-	void BuildHierarchyNode(HierarchyNode& node, UT::Transform* transform);
-	void RenderHierarchyNode(HierarchyNode& node, std::string_view lowerSearch = "", int depth = 0);
-	bool NodeMatchesSearch(const HierarchyNode& node, std::string_view lowerSearch) const;
-	void SetAllNodesExpanded(std::vector<HierarchyNode>& nodes, bool expanded);
+	void StepHierarchySync();
+	bool FinishHierarchySync();
+	void SyncHierarchyChildren(HierarchyNode& node);
+	HierarchyNode* AcquireHierarchyNode(UT::Transform* transform);
+	void RefreshHierarchyNodeName(HierarchyNode& node);
+	std::shared_ptr<const HierarchySearchIndex> BuildHierarchySearchIndex();
+	std::shared_ptr<const HierarchySearchMatches> UpdateHierarchySearch(const Helper::SearchNeedle& search);
+	void AppendHierarchyRows(HierarchyNode& node, int depth);
+	void RebuildHierarchyRows(const Helper::SearchNeedle& search);
+	void RenderHierarchyRows(const Helper::SearchNeedle& search);
+	void RenderHierarchyRow(const HierarchyRow& row, bool searching);
+	void SetAllNodesExpanded(const std::vector<HierarchyNode*>& nodes, bool expanded);
 
 	void OpenObjectInNewTab(UT::GameObject* obj);
 	void OpenStaticInstanceInNewTab(const StaticInstanceNode& node);
@@ -142,12 +398,20 @@ private:
 	bool IsObjectPinned(UT::GameObject* obj);
 
 	void RefreshTabData(InspectedObjectTab& tab) const;
+	void RefreshTabValues(InspectedObjectTab& tab) const;
 
 	void RenderDetailsWindow();
 	void RenderTabBar();
 	void RenderTabContent(InspectedObjectTab& tab);
 	void RenderTransformSection(UT::Transform* transform, InspectedObjectTab& tab) const;
 	void RenderComponentsSection(InspectionTarget& target, InspectedObjectTab& tab);
+	void UpdateFieldSnapshot(void* instance, const std::vector<ComponentFieldInfo>& fields,
+	                         FieldSnapshot& snapshot) const;
+	std::shared_ptr<const CollectionOrder> UpdateCollectionOrder(const CollectionLayout& layout,
+	                                                             const CollectionHeader& header,
+	                                                             CollectionView& view) const;
+	void RenderCollectionRows(const ComponentFieldInfo& field, const CollectionLayout& layout,
+	                          const CollectionHeader& header, CollectionView& view) const;
 	void RenderFieldsSection(void* instance, const std::vector<ComponentFieldInfo>& fields, InspectionTarget& target,
 	                         InspectedObjectTab& tab, size_t componentIndex) const;
 	void RenderPropertiesSection(void* instance, const std::vector<ComponentPropertyInfo>& properties,
@@ -158,23 +422,22 @@ private:
 	void DrawSelectedObjectBoundingBox() const;
 	void ProcessObjectPicker();
 
-	bool PassesComponentFilter(const std::string& componentName, std::string_view lowerSearch) const;
-	bool PassesFieldFilter(const ComponentFieldInfo& field, std::string_view lowerSearch, bool editableOnly,
+	bool PassesComponentFilter(const std::string& componentName, const Helper::SearchNeedle& search) const;
+	bool PassesFieldFilter(const ComponentFieldInfo& field, const Helper::SearchNeedle& search, bool editableOnly,
 	                       bool staticOnly, bool instanceOnly) const;
-	bool PassesPropertyFilter(const ComponentPropertyInfo& prop, std::string_view lowerSearch, bool editableOnly) const;
-	bool PassesMethodFilter(const ComponentMethodInfo& method, std::string_view lowerSearch, bool staticOnly,
+	bool PassesPropertyFilter(const ComponentPropertyInfo& prop, const Helper::SearchNeedle& search,
+	                          bool editableOnly) const;
+	bool PassesMethodFilter(const ComponentMethodInfo& method, const Helper::SearchNeedle& search, bool staticOnly,
 	                        bool instanceOnly) const;
 
-	std::string GetComponentTypeName(UT::Component* component) const;
+	std::shared_ptr<const ClassDescriptor> GetClassDescriptor(void* obj, void* klass) const;
 	std::vector<ComponentFieldInfo> GetObjectFields(void* obj, void* klass) const;
-	std::vector<ComponentFieldInfo> GetComponentFields(UT::Component* component) const;
 	std::vector<ComponentPropertyInfo> GetObjectProperties(void* obj, void* klass) const;
-	std::vector<ComponentPropertyInfo> GetComponentProperties(UT::Component* component) const;
 	std::vector<ComponentMethodInfo> GetObjectMethods(void* obj, void* klass) const;
-	std::vector<ComponentMethodInfo> GetComponentMethods(UT::Component* component) const;
 
 	std::string BuildObjectPath(UT::Transform* transform) const;
-	void RenderEditableField(void* instance, const ComponentFieldInfo& field, float itemWidth = -1.0f) const;
+	void RenderEditableField(void* instance, const ComponentFieldInfo& field, float itemWidth = -1.0f,
+	                         FieldSnapshot* snapshot = nullptr) const;
 	void RenderEditableProperty(void* instance, const ComponentPropertyInfo& prop) const;
 	void* InvokeMethod(void* instance, const ComponentMethodInfo& method,
 	                   const std::vector<std::string>& paramValues) const;
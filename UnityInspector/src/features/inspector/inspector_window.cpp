@@ -2,8 +2,6 @@
 #include "inspector.h"
 #include "helper/helper.h"
 
-#define API(fn) (Config::state.unityMode == UnityResolve::Mode::Mono ? "mono_" fn : "il2cpp_" fn)
-
 static void QuaternionToEuler(float x, float y, float z, float w, float outEuler[3])
 {
 	const float sinr = 2.0f * (w * x + y * z);
@@ -217,6 +215,14 @@ static bool SafeReadDecimal(void* addr, double& outValue)
 	}
 }
 
+// Values come from the snapshot when it covers the field, otherwise straight from the object
+template <typename T>
+static bool ReadFieldValue(const FieldSnapshot* snapshot, void* instance, const int offset, T& out)
+{
+	if (snapshot && snapshot->Read(instance, offset, out)) return true;
+	return Helper::SafeReadSpan(instance, offset, sizeof(T), &out);
+}
+
 static int GetTypeAlignment(std::string_view typeName)
 {
 	if (typeName == "System.Boolean" || typeName == "System.Byte" || typeName == "System.SByte") return 1;
@@ -292,7 +298,189 @@ static bool ParseDictionaryTypes(std::string_view typeName, std::string& outKeyT
 	return true;
 }
 
-void Inspector::RenderEditableField(void* instance, const ComponentFieldInfo& field, const float itemWidth) const
+static CollectionScalar GetCollectionScalar(const ComponentFieldInfo& element, const int size)
+{
+	const std::string_view type = element.typeName;
+	switch (element.editableType)
+	{
+	case EditableType::Int:
+		if (size == 1) return type == "System.SByte" ? CollectionScalar::I8 : CollectionScalar::U8;
+		if (size == 2) return type == "System.Int16" ? CollectionScalar::I16 : CollectionScalar::U16;
+		if (size == 8)
+			return type == "System.Int64" || type == "System.IntPtr" ? CollectionScalar::I64 : CollectionScalar::U64;
+		return type == "System.UInt32" ? CollectionScalar::U32 : CollectionScalar::I32;
+	case EditableType::Enum: return CollectionScalar::Enum;
+	case EditableType::Float: return CollectionScalar::F32;
+	case EditableType::Double: return CollectionScalar::F64;
+	case EditableType::Bool: return CollectionScalar::Bool;
+	case EditableType::String: return CollectionScalar::String;
+	default: return CollectionScalar::None;
+	}
+}
+
+static std::unique_ptr<CollectionLayout> ParseCollectionLayout(const std::string& typeName)
+{
+	const bool isArray = typeName.find("[]") != std::string::npos;
+	const bool isList = typeName.find("System.Collections.Generic.List") != std::string::npos;
+	const bool isDictionary = typeName.find("System.Collections.Generic.Dictionary") != std::string::npos;
+	const bool isStack = typeName.find("System.Collections.Generic.Stack") != std::string::npos;
+	const bool isQueue = typeName.find("System.Collections.Generic.Queue") != std::string::npos;
+	const bool isHashSet = typeName.find("System.Collections.Generic.HashSet") != std::string::npos;
+	const bool isArrayList = typeName.find("System.Collections.ArrayList") != std::string::npos;
+	if (!isArray && !isList && !isDictionary && !isStack && !isQueue && !isHashSet && !isArrayList)
+		return nullptr;
+
+	auto layout = std::make_unique<CollectionLayout>();
+	if (isDictionary)
+	{
+		layout->kind = CollectionKind::Dictionary;
+		layout->element.offset = 8;
+		layout->value.offset = 16;
+		layout->stride = 24;
+		layout->elementLabel = "Entry";
+
+		std::string keyType, valueType;
+		if (ParseDictionaryTypes(typeName, keyType, valueType))
+		{
+			const int keySize = GetTypeSize(keyType);
+			const int keyAlign = GetTypeAlignment(keyType);
+			const int valueSize = GetTypeSize(valueType);
+			const int valueAlign = GetTypeAlignment(valueType);
+
+			layout->element.offset = AlignUp(8, keyAlign);
+			layout->value.offset = AlignUp(layout->element.offset + keySize, valueAlign);
+			const int structAlign = std::max({4, keyAlign, valueAlign});
+			layout->stride = AlignUp(layout->value.offset + valueSize, structAlign);
+			layout->valueIsReference = !IsDefinitelyValueType(valueType);
+			layout->hasDictionaryTypes = true;
+
+			layout->element.typeName = keyType;
+			layout->element.editableType = DetermineEditableType(keyType, &layout->element.enumTypeName);
+			layout->value.typeName = valueType;
+			layout->value.editableType = DetermineEditableType(valueType, &layout->value.enumTypeName);
+			layout->elementLabel = SimplifyTypeName(keyType) + " -> " + SimplifyTypeName(valueType);
+		}
+		return layout;
+	}
+
+	std::string elementTypeName = "Element";
+	if (isArray)
+	{
+		elementTypeName = typeName.substr(0, typeName.find("[]"));
+	}
+	else if (isList || isStack || isQueue || isHashSet)
+	{
+		const size_t start = typeName.find('<');
+		if (const size_t end = typeName.rfind('>'); start != std::string::npos && end != std::string::npos && end > start)
+			elementTypeName = typeName.substr(start + 1, end - start - 1);
+	}
+	else if (isArrayList)
+	{
+		elementTypeName = "System.Object";
+	}
+
+	ComponentFieldInfo& element = layout->element;
+	element.typeName = elementTypeName;
+	element.editableType = DetermineEditableType(elementTypeName, &element.enumTypeName);
+
+	int elemSize = sizeof(void*);
+	switch (element.editableType)
+	{
+	case EditableType::Enum:
+	case EditableType::Int:
+		if (elementTypeName == "System.Int64" || elementTypeName == "System.UInt64" ||
+			elementTypeName == "System.IntPtr" || elementTypeName == "System.UIntPtr")
+			elemSize = sizeof(void*);
+		else if (elementTypeName == "System.Int16" || elementTypeName == "System.UInt16" ||
+			elementTypeName == "System.Char")
+			elemSize = 2;
+		else if (elementTypeName == "System.Byte" || elementTypeName == "System.SByte" ||
+			elementTypeName == "System.Boolean")
+			elemSize = 1;
+		else elemSize = 4;
+		element.isValueType = true;
+		break;
+	case EditableType::Float: elemSize = 4; element.isValueType = true; break;
+	case EditableType::Double: elemSize = 8; element.isValueType = true; break;
+	case EditableType::Decimal: elemSize = 16; element.isValueType = true; break;
+	case EditableType::Bool: elemSize = 1; element.isValueType = true; break;
+	case EditableType::Vector2: elemSize = 8; element.isValueType = true; break;
+	case EditableType::Vector3: elemSize = 12; element.isValueType = true; break;
+	case EditableType::Vector4:
+	case EditableType::Quaternion:
+	case EditableType::Color: elemSize = 16; element.isValueType = true; break;
+	default: break;
+	}
+
+	if (isHashSet)
+	{
+		// Slot { int hashCode; int next; T value; }, padded to the value's alignment
+		const int align = (elemSize >= 8 || !element.isValueType) ? 8 : 4;
+		layout->kind = CollectionKind::HashSet;
+		layout->stride = AlignUp(8 + elemSize, align);
+		element.offset = 8;
+	}
+	else
+	{
+		layout->kind = isArray ? CollectionKind::Array : CollectionKind::List;
+		layout->stride = elemSize;
+	}
+
+	layout->elementTypeName = std::move(elementTypeName);
+	layout->elementLabel = SimplifyTypeName(layout->elementTypeName);
+	layout->scalar = GetCollectionScalar(element, elemSize);
+	return layout;
+}
+
+// Null for types that are not collections. Layouts only depend on the type name, so each is parsed once.
+static const CollectionLayout* FindCollectionLayout(const std::string& typeName)
+{
+	static std::unordered_map<std::string, std::unique_ptr<CollectionLayout>> layouts;
+	if (const auto it = layouts.find(typeName); it != layouts.end())
+		return it->second.get();
+
+	return layouts.emplace(typeName, ParseCollectionLayout(typeName)).first->second.get();
+}
+
+static bool ReadCollectionHeader(const CollectionLayout& layout, void* collection, CollectionHeader& out)
+{
+	out = {};
+	void* storage = nullptr;
+	switch (layout.kind)
+	{
+	case CollectionKind::Array:
+		{
+			void* length = nullptr;
+			if (!Helper::SafeReadPointer(collection, 0x18, length)) return false;
+			out.count = static_cast<int>(std::min<uintptr_t>(reinterpret_cast<uintptr_t>(length), INT_MAX));
+			out.slots = out.count;
+			out.data = reinterpret_cast<uintptr_t>(collection) + 0x20;
+			return true;
+		}
+	case CollectionKind::List:
+		if (!Helper::SafeReadPointer(collection, 0x10, storage) || !Helper::SafeReadInt(collection, 0x18, out.count))
+			return false;
+		out.slots = out.count;
+		break;
+	case CollectionKind::Dictionary:
+		if (!Helper::SafeReadInt(collection, 0x20, out.count) || !Helper::SafeReadPointer(collection, 0x18, storage))
+			return false;
+		out.slots = out.count;
+		break;
+	case CollectionKind::HashSet:
+		if (!Helper::SafeReadInt(collection, 0x20, out.count) || !Helper::SafeReadPointer(collection, 0x18, storage))
+			return false;
+		Helper::SafeReadInt(collection, 0x24, out.slots);
+		break;
+	}
+
+	if (storage)
+		out.data = reinterpret_cast<uintptr_t>(storage) + 0x20;
+	return true;
+}
+
+void Inspector::RenderEditableField(void* instance, const ComponentFieldInfo& field, const float itemWidth,
+                                    FieldSnapshot* snapshot) const
 {
 	if (!instance && !field.isStatic) return;
 
@@ -439,13 +627,13 @@ void Inspector::RenderEditableField(void* instance, const ComponentFieldInfo& fi
 				int32_t parts[4] = {};
 				if (Config::state.unityMode == UnityResolve::Mode::Mono)
 				{
-					void* vTable = UR::Invoke<void*, void*, void*>("mono_class_vtable", UR::pDomain,
-						UR::Invoke<void*, void*>("mono_field_get_parent", field.fieldHandle));
-					UR::Invoke<void, void*, void*, void*>("mono_field_static_get_value", vTable, field.fieldHandle, &parts);
+					void* vTable = UR::Invoke<void*, void*, void*>(UR::Export::ClassVTable, UR::pDomain,
+						UR::Invoke<void*, void*>(UR::Export::FieldGetParent, field.fieldHandle));
+					UR::Invoke<void, void*, void*, void*>(UR::Export::FieldStaticGetValue, vTable, field.fieldHandle, &parts);
 				}
 				else
 				{
-					UR::Invoke<void, void*, void*>("il2cpp_field_static_get_value", field.fieldHandle, &parts);
+					UR::Invoke<void, void*, void*>(UR::Export::FieldStaticGetValue, field.fieldHandle, &parts);
 				}
 				const int scale = (parts[0] >> 16) & 0x1F;
 				const bool negative = (parts[0] & 0x80000000) != 0;
@@ -539,7 +727,7 @@ void Inspector::RenderEditableField(void* instance, const ComponentFieldInfo& fi
 			{
 				if (int val; Helper::SafeGetStaticFieldInt(field.fieldHandle, val))
 				{
-					const auto enumVals = GetEnumValues(field.enumTypeName);
+					const auto& enumVals = GetEnumValues(field.enumTypeName);
 					auto currentName = "Unknown";
 					for (const auto& [fst, snd] : enumVals)
 					{
@@ -553,7 +741,7 @@ void Inspector::RenderEditableField(void* instance, const ComponentFieldInfo& fi
 					bool isParentEnum = false;
 					if (field.classHandle)
 					{
-						isParentEnum = UR::Invoke<bool, void*>(API("class_is_enum"), field.classHandle);
+						isParentEnum = UR::Invoke<bool, void*>(UR::Export::ClassIsEnum, field.classHandle);
 					}
 
 					if (isParentEnum)
@@ -637,10 +825,7 @@ void Inspector::RenderEditableField(void* instance, const ComponentFieldInfo& fi
 								nextTarget.cachedComponents.push_back(static_cast<UT::Component*>(instancePtr));
 								nextTarget.cachedComponentNames.push_back(field.typeName);
 
-								nextTarget.cachedComponentFields.push_back(GetObjectFields(instancePtr, nullptr));
-								nextTarget.cachedComponentProperties.push_back(
-									GetObjectProperties(instancePtr, nullptr));
-								nextTarget.cachedComponentMethods.push_back(GetObjectMethods(instancePtr, nullptr));
+								nextTarget.cachedDescriptors.push_back(GetClassDescriptor(instancePtr, nullptr));
 
 								activeTab->navigationStack.push_back(std::move(nextTarget));
 							}
@@ -663,7 +848,7 @@ void Inspector::RenderEditableField(void* instance, const ComponentFieldInfo& fi
 				if (field.typeName == "System.Int64")
 				{
 					int64_t val;
-					if (Helper::SafeReadInt64(instance, field.offset, val))
+					if (ReadFieldValue(snapshot, instance, field.offset, val))
 					{
 						if (ImGui::InputScalar("##val", ImGuiDataType_S64, &val))
 							Helper::SafeWriteInt64(instance, field.offset, val);
@@ -673,7 +858,7 @@ void Inspector::RenderEditableField(void* instance, const ComponentFieldInfo& fi
 				else if (field.typeName == "System.UInt64")
 				{
 					uint64_t val;
-					if (Helper::SafeReadUInt64(instance, field.offset, val))
+					if (ReadFieldValue(snapshot, instance, field.offset, val))
 					{
 						if (ImGui::InputScalar("##val", ImGuiDataType_U64, &val))
 							Helper::SafeWriteUInt64(instance, field.offset, val);
@@ -682,7 +867,7 @@ void Inspector::RenderEditableField(void* instance, const ComponentFieldInfo& fi
 				}
 				else if (field.typeName == "System.Byte")
 				{
-					if (uint8_t val; Helper::SafeReadByte(instance, field.offset, val))
+					if (uint8_t val; ReadFieldValue(snapshot, instance, field.offset, val))
 					{
 						int iv = val;
 						if (ImGui::DragInt("##val", &iv))
@@ -692,7 +877,7 @@ void Inspector::RenderEditableField(void* instance, const ComponentFieldInfo& fi
 				}
 				else if (field.typeName == "System.SByte")
 				{
-					if (int8_t val; Helper::SafeReadSByte(instance, field.offset, val))
+					if (int8_t val; ReadFieldValue(snapshot, instance, field.offset, val))
 					{
 						int iv = val;
 						if (ImGui::DragInt("##val", &iv))
@@ -702,7 +887,7 @@ void Inspector::RenderEditableField(void* instance, const ComponentFieldInfo& fi
 				}
 				else if (field.typeName == "System.Int16" || field.typeName == "System.Short")
 				{
-					if (int16_t val; Helper::SafeReadInt16(instance, field.offset, val))
+					if (int16_t val; ReadFieldValue(snapshot, instance, field.offset, val))
 					{
 						int iv = val;
 						if (ImGui::DragInt("##val", &iv))
@@ -712,7 +897,7 @@ void Inspector::RenderEditableField(void* instance, const ComponentFieldInfo& fi
 				}
 				else if (field.typeName == "System.UInt16" || field.typeName == "System.UShort")
 				{
-					if (uint16_t val; Helper::SafeReadUInt16(instance, field.offset, val))
+					if (uint16_t val; ReadFieldValue(snapshot, instance, field.offset, val))
 					{
 						int iv = val;
 						if (ImGui::DragInt("##val", &iv))
@@ -722,7 +907,7 @@ void Inspector::RenderEditableField(void* instance, const ComponentFieldInfo& fi
 				}
 				else if (field.typeName == "System.Char")
 				{
-					if (char16_t val; Helper::SafeReadChar(instance, field.offset, val))
+					if (char16_t val; ReadFieldValue(snapshot, instance, field.offset, val))
 					{
 						int iv = val;
 						if (ImGui::DragInt("##val", &iv))
@@ -737,7 +922,7 @@ void Inspector::RenderEditableField(void* instance, const ComponentFieldInfo& fi
 				}
 				else if (field.typeName == "System.IntPtr")
 				{
-					if (int64_t val; Helper::SafeReadInt64(instance, field.offset, val))
+					if (int64_t val; ReadFieldValue(snapshot, instance, field.offset, val))
 					{
 						if (ImGui::InputScalar("##val", ImGuiDataType_S64, &val))
 							Helper::SafeWriteInt64(instance, field.offset, val);
@@ -746,7 +931,7 @@ void Inspector::RenderEditableField(void* instance, const ComponentFieldInfo& fi
 				}
 				else if (field.typeName == "System.UIntPtr")
 				{
-					if (uint64_t val; Helper::SafeReadUInt64(instance, field.offset, val))
+					if (uint64_t val; ReadFieldValue(snapshot, instance, field.offset, val))
 					{
 						if (ImGui::InputScalar("##val", ImGuiDataType_U64, &val))
 							Helper::SafeWriteUInt64(instance, field.offset, val);
@@ -755,7 +940,7 @@ void Inspector::RenderEditableField(void* instance, const ComponentFieldInfo& fi
 				}
 				else if (IsUInt64WrappingType(field.typeName))
 				{
-					if (uint64_t val; Helper::SafeReadUInt64(instance, field.offset, val))
+					if (uint64_t val; ReadFieldValue(snapshot, instance, field.offset, val))
 					{
 						if (ImGui::InputScalar("##val", ImGuiDataType_U64, &val))
 							Helper::SafeWriteUInt64(instance, field.offset, val);
@@ -765,7 +950,7 @@ void Inspector::RenderEditableField(void* instance, const ComponentFieldInfo& fi
 				else
 				{
 					int val;
-					if (Helper::SafeReadInt(instance, field.offset, val))
+					if (ReadFieldValue(snapshot, instance, field.offset, val))
 					{
 						if (field.enumTypeName.empty())
 						{
@@ -774,7 +959,7 @@ void Inspector::RenderEditableField(void* instance, const ComponentFieldInfo& fi
 						}
 						else
 						{
-							const auto enumVals = GetEnumValues(field.enumTypeName);
+							const auto& enumVals = GetEnumValues(field.enumTypeName);
 							int currentIdx = 0;
 							for (size_t i = 0; i < enumVals.size(); i++)
 							{
@@ -801,7 +986,7 @@ void Inspector::RenderEditableField(void* instance, const ComponentFieldInfo& fi
 		case EditableType::Float:
 			{
 				float val;
-				if (Helper::SafeReadFloat(instance, field.offset, val))
+				if (ReadFieldValue(snapshot, instance, field.offset, val))
 				{
 					if (ImGui::DragFloat("##val", &val, 0.1f))
 						Helper::SafeWriteFloat(instance, field.offset, val);
@@ -811,7 +996,7 @@ void Inspector::RenderEditableField(void* instance, const ComponentFieldInfo& fi
 			}
 		case EditableType::Double:
 			{
-				if (double val; Helper::SafeReadDouble(instance, field.offset, val))
+				if (double val; ReadFieldValue(snapshot, instance, field.offset, val))
 				{
 					float fVal = static_cast<float>(val);
 					if (ImGui::DragFloat("##val", &fVal, 0.01f))
@@ -822,7 +1007,10 @@ void Inspector::RenderEditableField(void* instance, const ComponentFieldInfo& fi
 			}
 		case EditableType::Decimal:
 			{
-				const auto addr = reinterpret_cast<void*>(reinterpret_cast<uintptr_t>(instance) + field.offset);
+				std::array<int32_t, 4> parts{};
+				auto addr = reinterpret_cast<void*>(reinterpret_cast<uintptr_t>(instance) + field.offset);
+				if (snapshot && snapshot->Read(instance, field.offset, parts))
+					addr = parts.data();
 				if (double value; SafeReadDecimal(addr, value))
 					ImGui::TextDisabled("%.6f", value);
 				else
@@ -832,7 +1020,7 @@ void Inspector::RenderEditableField(void* instance, const ComponentFieldInfo& fi
 		case EditableType::Bool:
 			{
 				bool val;
-				if (Helper::SafeReadBool(instance, field.offset, val))
+				if (ReadFieldValue(snapshot, instance, field.offset, val))
 				{
 					if (ImGui::Checkbox("##val", &val))
 						Helper::SafeWriteBool(instance, field.offset, val);
@@ -842,17 +1030,32 @@ void Inspector::RenderEditableField(void* instance, const ComponentFieldInfo& fi
 			}
 		case EditableType::String:
 			{
-				if (UT::String* strPtr = nullptr; Helper::SafeReadStringPtr(instance, field.offset, strPtr))
+				if (UT::String* strPtr = nullptr; ReadFieldValue(snapshot, instance, field.offset, strPtr))
 				{
-					const std::string currentStr = strPtr ? strPtr->ToString() : "(null)";
-					ImGui::TextDisabled("\"%s\"", currentStr.c_str());
+					// Strings are immutable, so the text only has to be converted again when the reference changes
+					FieldDisplayCache* display = snapshot ? snapshot->Display(field) : nullptr;
+					if (!display)
+					{
+						const std::string currentStr = strPtr ? strPtr->ToString() : "(null)";
+						ImGui::TextDisabled("\"%s\"", currentStr.c_str());
+					}
+					else
+					{
+						if (!display->hasValueText || std::memcmp(display->valueBytes.data(), &strPtr, sizeof(strPtr)) != 0)
+						{
+							display->valueText = strPtr ? strPtr->ToString() : "(null)";
+							std::memcpy(display->valueBytes.data(), &strPtr, sizeof(strPtr));
+							display->hasValueText = true;
+						}
+						ImGui::TextDisabled("\"%s\"", display->valueText.c_str());
+					}
 				}
 				else { ImGui::TextDisabled("ERROR"); }
 				break;
 			}
 		case EditableType::Vector2:
 			{
-				if (UT::Vector2 val; Helper::SafeReadVector2(instance, field.offset, val))
+				if (UT::Vector2 val; ReadFieldValue(snapshot, instance, field.offset, val))
 				{
 					float arr[2] = {val.x, val.y};
 					if (ImGui::DragFloat2("##val", arr, 0.1f))
@@ -867,7 +1070,7 @@ void Inspector::RenderEditableField(void* instance, const ComponentFieldInfo& fi
 			}
 		case EditableType::Vector3:
 			{
-				if (UT::Vector3 val; Helper::SafeReadVector3(instance, field.offset, val))
+				if (UT::Vector3 val; ReadFieldValue(snapshot, instance, field.offset, val))
 				{
 					float arr[3] = {val.x, val.y, val.z};
 					if (DragVector3Compact("##val", arr, 0.1f))
@@ -883,7 +1086,7 @@ void Inspector::RenderEditableField(void* instance, const ComponentFieldInfo& fi
 			}
 		case EditableType::Vector4:
 			{
-				if (UT::Vector4 val; Helper::SafeReadVector4(instance, field.offset, val))
+				if (UT::Vector4 val; ReadFieldValue(snapshot, instance, field.offset, val))
 				{
 					float arr[4] = {val.x, val.y, val.z, val.w};
 					if (ImGui::DragFloat4("##val", arr, 0.1f))
@@ -900,7 +1103,7 @@ void Inspector::RenderEditableField(void* instance, const ComponentFieldInfo& fi
 			}
 		case EditableType::Quaternion:
 			{
-				if (UT::Quaternion val; Helper::SafeReadQuaternion(instance, field.offset, val))
+				if (UT::Quaternion val; ReadFieldValue(snapshot, instance, field.offset, val))
 				{
 					float arr[4] = {val.x, val.y, val.z, val.w};
 					if (DragVector4Compact("##val", arr, 0.01f))
@@ -917,7 +1120,7 @@ void Inspector::RenderEditableField(void* instance, const ComponentFieldInfo& fi
 			}
 		case EditableType::Color:
 			{
-				if (UT::Color val; Helper::SafeReadColor(instance, field.offset, val))
+				if (UT::Color val; ReadFieldValue(snapshot, instance, field.offset, val))
 				{
 					float arr[4] = {val.r, val.g, val.b, val.a};
 					if (ImGui::ColorEdit4("##val", arr, ImGuiColorEditFlags_NoInputs | ImGuiColorEditFlags_AlphaBar))
@@ -934,9 +1137,9 @@ void Inspector::RenderEditableField(void* instance, const ComponentFieldInfo& fi
 			}
 		case EditableType::Enum:
 			{
-				if (int val; Helper::SafeReadInt(instance, field.offset, val))
+				if (int val; ReadFieldValue(snapshot, instance, field.offset, val))
 				{
-					const auto enumVals = GetEnumValues(field.enumTypeName);
+					const auto& enumVals = GetEnumValues(field.enumTypeName);
 
 					int currentIdx = 0;
 					for (size_t i = 0; i < enumVals.size(); i++)
@@ -982,7 +1185,7 @@ void Inspector::RenderEditableField(void* instance, const ComponentFieldInfo& fi
 				{
 					auto nullablePtr = reinterpret_cast<void*>(reinterpret_cast<uintptr_t>(instance) + field.offset);
 					bool hasValue = false;
-					Helper::SafeReadBool(nullablePtr, 0, hasValue);
+					ReadFieldValue(snapshot, instance, field.offset, hasValue);
 					if (!hasValue)
 					{
 						ImGui::TextDisabled("null");
@@ -1001,12 +1204,7 @@ void Inspector::RenderEditableField(void* instance, const ComponentFieldInfo& fi
 								nextTarget.classHandle = field.classHandle;
 								nextTarget.cachedComponents.push_back(static_cast<UT::Component*>(nullablePtr));
 								nextTarget.cachedComponentNames.push_back(field.typeName);
-								nextTarget.cachedComponentFields.push_back(
-									GetObjectFields(nullablePtr, field.typeClassHandle));
-								nextTarget.cachedComponentProperties.push_back(
-									GetObjectProperties(nullablePtr, field.typeClassHandle));
-								nextTarget.cachedComponentMethods.push_back(
-									GetObjectMethods(nullablePtr, field.typeClassHandle));
+								nextTarget.cachedDescriptors.push_back(GetClassDescriptor(nullablePtr, field.typeClassHandle));
 								activeTab->navigationStack.push_back(std::move(nextTarget));
 							}
 						}
@@ -1021,7 +1219,7 @@ void Inspector::RenderEditableField(void* instance, const ComponentFieldInfo& fi
 					}
 					else
 					{
-						Helper::SafeReadPointer(instance, field.offset, instancePtr);
+						ReadFieldValue(snapshot, instance, field.offset, instancePtr);
 					}
 
 					if (!instancePtr)
@@ -1045,10 +1243,7 @@ void Inspector::RenderEditableField(void* instance, const ComponentFieldInfo& fi
 								nextTarget.cachedComponentNames.push_back(field.typeName);
 								void* targetKlass = field.isValueType ? field.typeClassHandle : nullptr;
 
-								nextTarget.cachedComponentFields.push_back(GetObjectFields(instancePtr, targetKlass));
-								nextTarget.cachedComponentProperties.push_back(
-									GetObjectProperties(instancePtr, targetKlass));
-								nextTarget.cachedComponentMethods.push_back(GetObjectMethods(instancePtr, targetKlass));
+								nextTarget.cachedDescriptors.push_back(GetClassDescriptor(instancePtr, targetKlass));
 
 								activeTab->navigationStack.push_back(std::move(nextTarget));
 							}
@@ -1421,9 +1616,7 @@ void Inspector::RenderEditableProperty(void* instance, const ComponentPropertyIn
 							nextTarget.classHandle = klass;
 							nextTarget.cachedComponents.push_back(static_cast<UT::Component*>(result));
 							nextTarget.cachedComponentNames.push_back(prop.typeName);
-							nextTarget.cachedComponentFields.push_back(GetObjectFields(result, klass));
-							nextTarget.cachedComponentProperties.push_back(GetObjectProperties(result, klass));
-							nextTarget.cachedComponentMethods.push_back(GetObjectMethods(result, klass));
+							nextTarget.cachedDescriptors.push_back(GetClassDescriptor(result, klass));
 							activeTab->navigationStack.push_back(std::move(nextTarget));
 						}
 					}
@@ -1535,6 +1728,45 @@ void Inspector::RenderTransformSection(UT::Transform* transform, InspectedObject
 	ImGui::Spacing();
 }
 
+// Retakes the copy once it is older than fieldSnapshotIntervalMs, or at once when the object, its field list or
+// an edit in progress make it stale. Display caches are only reset when the field list changes.
+void Inspector::UpdateFieldSnapshot(void* instance, const std::vector<ComponentFieldInfo>& fields,
+                                    FieldSnapshot& snapshot) const
+{
+	const double now = ImGui::GetTime();
+	if (snapshot.fields != &fields)
+	{
+		int begin = INT_MAX, end = 0;
+		for (const auto& field : fields)
+		{
+			if (field.isStatic) continue;
+			begin = std::min(begin, field.offset);
+			end = std::max(end, field.offset + GetTypeSize(field.typeName));
+		}
+
+		snapshot.fields = &fields;
+		snapshot.display.assign(fields.size(), {});
+		for (size_t i = 0; i < fields.size(); i++)
+		{
+			snapshot.display[i].typeLabel = SimplifyTypeName(fields[i].typeName);
+			snapshot.display[i].collectionLayout = FindCollectionLayout(fields[i].typeName);
+		}
+		snapshot.begin = begin < end ? begin : 0;
+		snapshot.bytes.assign(begin < end && end - begin <= fieldSnapshotMaxBytes ? end - begin : 0, 0);
+		snapshot.valid = false;
+	}
+	else if (snapshot.instance == instance && !snapshot.editing &&
+		(now - snapshot.takenAt) * 1000.0 < fieldSnapshotIntervalMs)
+	{
+		return;
+	}
+
+	snapshot.instance = instance;
+	snapshot.takenAt = now;
+	snapshot.valid = instance && !snapshot.bytes.empty() &&
+		Helper::SafeReadSpan(instance, snapshot.begin, snapshot.bytes.size(), snapshot.bytes.data());
+}
+
 void Inspector::RenderFieldsSection(void* instance, const std::vector<ComponentFieldInfo>& fields,
                                     InspectionTarget& target, InspectedObjectTab& tab, const size_t componentIndex) const
 {
@@ -1558,13 +1790,12 @@ void Inspector::RenderFieldsSection(void* instance, const std::vector<ComponentF
 
 	ImGui::Spacing();
 
-	std::string lowerSearch = lSearchBuffer;
-	std::ranges::transform(lowerSearch, lowerSearch.begin(), tolower);
+	const Helper::SearchNeedle search(lSearchBuffer);
 
 	std::vector<const ComponentFieldInfo*> filteredFields;
 	for (const auto& field : fields)
 	{
-		if (PassesFieldFilter(field, lowerSearch, tab.filterEditableOnly, tab.filterStaticOnly,
+		if (PassesFieldFilter(field, search, tab.filterEditableOnly, tab.filterStaticOnly,
 		                      tab.filterInstanceOnly))
 			filteredFields.push_back(&field);
 	}
@@ -1584,6 +1815,13 @@ void Inspector::RenderFieldsSection(void* instance, const std::vector<ComponentF
 	SectionLabel("Fields", filteredFields.size());
 	ImGui::Spacing();
 
+	if (componentIndex >= target.fieldSnapshots.size())
+		target.fieldSnapshots.resize(componentIndex + 1);
+	FieldSnapshot& snapshot = target.fieldSnapshots[componentIndex];
+	const bool editingAtStart = ImGui::IsAnyItemActive();
+	snapshot.editing |= editingAtStart;
+	UpdateFieldSnapshot(instance, fields, snapshot);
+
 	if (ImGui::BeginTable("FieldsTable", 4,
 	                      ImGuiTableFlags_Resizable |
 	                      ImGuiTableFlags_BordersInnerV |
@@ -1601,23 +1839,16 @@ void Inspector::RenderFieldsSection(void* instance, const std::vector<ComponentF
 		{
 			ImGui::TableNextRow();
 
-			bool isArray = field->typeName.find("[]") != std::string::npos;
-			bool isList = field->typeName.find("System.Collections.Generic.List") != std::string::npos;
-			bool isDictionary = field->typeName.find("System.Collections.Generic.Dictionary") != std::string::npos;
-			bool isStack = field->typeName.find("System.Collections.Generic.Stack") != std::string::npos;
-			bool isQueue = field->typeName.find("System.Collections.Generic.Queue") != std::string::npos;
-			bool isHashSet = field->typeName.find("System.Collections.Generic.HashSet") != std::string::npos;
-			bool isArrayList = field->typeName.find("System.Collections.ArrayList") != std::string::npos;
-			bool isCollection = isArray || isList || isDictionary || isStack || isQueue || isHashSet || isArrayList;
+			FieldDisplayCache* display = snapshot.Display(*field);
+			const CollectionLayout* layout = display ? display->collectionLayout : FindCollectionLayout(field->typeName);
 
 			bool isExpanded = false;
-			int collectionCount = 0;
-			void* arrayDataStart = nullptr;
-			void* collectionPtr = nullptr;
+			CollectionHeader header;
 
 			ImGui::TableSetColumnIndex(0);
-			if (isCollection)
+			if (layout)
 			{
+				void* collectionPtr = nullptr;
 				bool gotCollection = false;
 				if (field->isStatic)
 				{
@@ -1625,49 +1856,18 @@ void Inspector::RenderFieldsSection(void* instance, const std::vector<ComponentF
 				}
 				else if (instance)
 				{
-					gotCollection = Helper::SafeReadPointer(instance, field->offset, collectionPtr) && collectionPtr;
+					gotCollection = ReadFieldValue(&snapshot, instance, field->offset, collectionPtr) && collectionPtr;
 				}
 
-				if (gotCollection)
+				if (gotCollection && ReadCollectionHeader(*layout, collectionPtr, header))
 				{
-					if (isArray)
-					{
-						auto arr = static_cast<UT::Array<uintptr_t>*>(collectionPtr);
-						collectionCount = static_cast<int>(arr->max_length);
-						arrayDataStart = reinterpret_cast<void*>(reinterpret_cast<uintptr_t>(arr) + 0x20);
-					}
-					else if (isList || isStack || isQueue || isArrayList)
-					{
-						auto container = static_cast<UT::List<uintptr_t>*>(collectionPtr);
-						collectionCount = container->size;
-						if (container->array)
-						{
-							arrayDataStart = reinterpret_cast<void*>(reinterpret_cast<uintptr_t>(container->array) + 0x20);
-						}
-					}
-					else if (isDictionary)
-					{
-						Helper::SafeReadInt(collectionPtr, 0x20, collectionCount);
-						void* pEntries = nullptr;
-						Helper::SafeReadPointer(collectionPtr, 0x18, pEntries);
-						if (pEntries)
-							arrayDataStart = reinterpret_cast<void*>(reinterpret_cast<uintptr_t>(pEntries) + 0x20);
-					}
-					else if (isHashSet)
-					{
-						Helper::SafeReadInt(collectionPtr, 0x20, collectionCount);
-						void* pSlots = nullptr;
-						Helper::SafeReadPointer(collectionPtr, 0x18, pSlots);
-						if (pSlots)
-							arrayDataStart = pSlots;
-					}
-
-					collectionCount = std::max(0, std::min(collectionCount, 1000));
+					header.count = std::clamp(header.count, 0, collectionMaxSlots);
+					header.slots = std::clamp(header.slots, 0, collectionMaxSlots);
 
 					ImGui::PushID(field->fieldHandle);
 					ImGui::PushStyleColor(ImGuiCol_Text, ImVec4(0.5f, 0.8f, 1.0f, 1.0f));
 					isExpanded = ImGui::TreeNodeEx(field->name.c_str(), ImGuiTreeNodeFlags_SpanFullWidth, "%s [%d]",
-					                               field->name.c_str(), collectionCount);
+					                               field->name.c_str(), header.count);
 					ImGui::PopStyleColor();
 					ImGui::PopID();
 				}
@@ -1706,8 +1906,10 @@ void Inspector::RenderFieldsSection(void* instance, const std::vector<ComponentF
 
 			ImGui::TableSetColumnIndex(1);
 			{
-				std::string shortType = SimplifyTypeName(field->typeName);
-				ImGui::TextUnformatted(shortType.c_str());
+				if (display)
+					ImGui::TextUnformatted(display->typeLabel.c_str());
+				else
+					ImGui::TextUnformatted(SimplifyTypeName(field->typeName).c_str());
 				if (ImGui::IsItemHovered())
 				{
 					ImGui::BeginTooltip();
@@ -1717,7 +1919,7 @@ void Inspector::RenderFieldsSection(void* instance, const std::vector<ComponentF
 			}
 
 			ImGui::TableSetColumnIndex(2);
-			RenderEditableField(instance, *field);
+			RenderEditableField(instance, *field, -1.0f, &snapshot);
 
 			ImGui::TableSetColumnIndex(3);
 
@@ -1765,10 +1967,7 @@ void Inspector::RenderFieldsSection(void* instance, const std::vector<ComponentF
 								nextTarget.cachedComponentNames.push_back(field->typeName);
 							}
 							void* targetKlass = field->typeClassHandle;
-							nextTarget.cachedComponentFields.push_back(GetObjectFields(instancePtr, targetKlass));
-							nextTarget.cachedComponentProperties.push_back(
-								GetObjectProperties(instancePtr, targetKlass));
-							nextTarget.cachedComponentMethods.push_back(GetObjectMethods(instancePtr, targetKlass));
+							nextTarget.cachedDescriptors.push_back(GetClassDescriptor(instancePtr, targetKlass));
 							activeTab->navigationStack.push_back(std::move(nextTarget));
 						}
 					}
@@ -1778,372 +1977,208 @@ void Inspector::RenderFieldsSection(void* instance, const std::vector<ComponentF
 
 			if (isExpanded)
 			{
-				if (arrayDataStart)
+				if (header.data && display)
 				{
-					if (isDictionary)
-					{
-						std::string dictKeyType, dictValueType;
-						bool hasDictTypes = ParseDictionaryTypes(field->typeName, dictKeyType, dictValueType);
-
-						int keyOffset = 8, valueOffset = 16, entryStride = 24;
-						bool valueIsReference = true;
-
-						if (hasDictTypes)
-						{
-							int keySize = GetTypeSize(dictKeyType);
-							int keyAlign = GetTypeAlignment(dictKeyType);
-							int valueSize = GetTypeSize(dictValueType);
-							int valueAlign = GetTypeAlignment(dictValueType);
-
-							keyOffset = AlignUp(8, keyAlign);
-							valueOffset = AlignUp(keyOffset + keySize, valueAlign);
-							int structAlign = std::max({4, keyAlign, valueAlign});
-							entryStride = AlignUp(valueOffset + valueSize, structAlign);
-							valueIsReference = !IsDefinitelyValueType(dictValueType);
-						}
-
-						for (int i = 0; i < collectionCount; ++i)
-						{
-							ImGui::TableNextRow();
-
-							void* entryAddr = nullptr;
-							if (hasDictTypes)
-							{
-								entryAddr = reinterpret_cast<void*>(
-									reinterpret_cast<uintptr_t>(arrayDataStart) + i * entryStride);
-							}
-
-							ImGui::TableSetColumnIndex(0);
-							ImGui::Indent(15.0f);
-							ImGui::Text("[%d]", i);
-							ImGui::Unindent(15.0f);
+					if (!display->collection)
+						display->collection = std::make_shared<CollectionView>();
+					RenderCollectionRows(*field, *layout, header, *display->collection);
+				}
+				ImGui::TreePop();
+			}
+		}
 
-							ImGui::TableSetColumnIndex(1);
-							if (hasDictTypes)
-							{
-								std::string keyShort = SimplifyTypeName(dictKeyType);
-								std::string valueShort = SimplifyTypeName(dictValueType);
-								ImGui::TextDisabled("%s -> %s", keyShort.c_str(), valueShort.c_str());
-							}
-							else
-							{
-								ImGui::TextDisabled("Entry");
-							}
+		ImGui::EndTable();
+	}
 
-							ImGui::TableSetColumnIndex(2);
-							if (hasDictTypes)
-							{
-								float availW = ImGui::GetContentRegionAvail().x;
-								float editorW = (availW - 30.0f) * 0.45f;
-
-								ComponentFieldInfo keyInfo;
-								keyInfo.typeName = dictKeyType;
-								keyInfo.offset = keyOffset;
-								keyInfo.isStatic = false;
-								keyInfo.editableType = DetermineEditableType(dictKeyType, &keyInfo.enumTypeName);
-
-								ComponentFieldInfo valueInfo;
-								valueInfo.typeName = dictValueType;
-								valueInfo.offset = valueOffset;
-								valueInfo.isStatic = false;
-								valueInfo.editableType = DetermineEditableType(dictValueType, &valueInfo.enumTypeName);
-
-								ImGui::PushID(i * 2);
-								RenderEditableField(entryAddr, keyInfo, editorW);
-								ImGui::PopID();
+	// A write lands on the object, not the copy; keep retaking it until the frame after the widget lets go
+	snapshot.editing = editingAtStart || ImGui::IsAnyItemActive();
+}
 
-								ImGui::SameLine();
-								ImGui::Text("->");
-								ImGui::SameLine();
+// Rows are clipped to the visible ones, and each clipper step copies the entries behind them with one read.
+// Filtering and sorting need every entry, so they are only offered for scalar and string elements.
+void Inspector::RenderCollectionRows(const ComponentFieldInfo& field, const CollectionLayout& layout,
+                                     const CollectionHeader& header, CollectionView& view) const
+{
+	static constexpr const char* sortLabels[] = {"Unsorted", "Ascending", "Descending"};
 
-								ImGui::PushID(i * 2 + 1);
-								RenderEditableField(entryAddr, valueInfo, editorW);
-								ImGui::PopID();
-							}
-							else
-							{
-								void* entryKey = nullptr;
-								void* entryValue = nullptr;
-								Helper::SafeReadPointer(arrayDataStart, i * 24 + 8, entryKey);
-								Helper::SafeReadPointer(arrayDataStart, i * 24 + 16, entryValue);
-								ImGui::Text("%p -> %p", entryKey, entryValue);
-							}
+	const bool tools = layout.scalar != CollectionScalar::None && header.slots >= collectionToolsMinSlots;
+	if (tools)
+	{
+		ImGui::TableNextRow();
+		ImGui::TableSetColumnIndex(0);
+		ImGui::Indent(15.0f);
+		ImGui::PushID(&view);
+		if (ImGui::SmallButton(sortLabels[view.sort]))
+			view.sort = (view.sort + 1) % 3;
+		ImGui::Unindent(15.0f);
+
+		ImGui::TableSetColumnIndex(2);
+		ImGui::SetNextItemWidth(ImGui::GetContentRegionAvail().x);
+		ImGui::InputTextWithHint("##CollectionFilter", "Filter elements...", view.filterBuffer,
+		                         sizeof(view.filterBuffer), ImGuiInputTextFlags_EscapeClearsAll);
+		ImGui::PopID();
+	}
+	else
+	{
+		view.filterBuffer[0] = '\0';
+		view.sort = 0;
+	}
 
-							ImGui::TableSetColumnIndex(3);
-							void* valuePtr = nullptr;
-							if (hasDictTypes)
-							{
-								if (valueIsReference)
-								{
-									Helper::SafeReadPointer(entryAddr, valueOffset, valuePtr);
-								}
-							}
-							else
-							{
-								Helper::SafeReadPointer(arrayDataStart, i * 24 + 16, valuePtr);
-							}
-							if (valuePtr)
-							{
-								ImGui::PushID(reinterpret_cast<intptr_t>(arrayDataStart) + i);
-								if (ImGui::SmallButton("Enter"))
-								{
-									if (auto activeTab = GetActiveTab())
-									{
-										InspectionTarget nextTarget;
-										nextTarget.instance = valuePtr;
-										nextTarget.name = field->name + "[" + std::to_string(i) + "].Value";
-										nextTarget.classHandle = nullptr;
-
-										nextTarget.cachedComponents.push_back(
-											static_cast<UT::Component*>(valuePtr));
-										nextTarget.cachedComponentNames.push_back("DictionaryValue");
-
-										nextTarget.cachedComponentFields.
-										           push_back(GetObjectFields(valuePtr, nullptr));
-										nextTarget.cachedComponentProperties.push_back(
-											GetObjectProperties(valuePtr, nullptr));
-										nextTarget.cachedComponentMethods.push_back(
-											GetObjectMethods(valuePtr, nullptr));
-
-										activeTab->navigationStack.push_back(std::move(nextTarget));
-									}
-								}
-								ImGui::PopID();
-							}
-						}
-					}
-					else if (isHashSet)
-					{
-						std::string elementTypeName = "Element";
-						size_t start = field->typeName.find("<");
-						if (size_t end = field->typeName.rfind(">"); start != std::string::npos && end !=
-							std::string::npos && end > start)
-						{
-							elementTypeName = field->typeName.substr(start + 1, end - start - 1);
-						}
+	std::shared_ptr<const CollectionOrder> order;
+	if (layout.kind == CollectionKind::HashSet || view.filterBuffer[0] || view.sort != 0)
+		order = UpdateCollectionOrder(layout, header, view);
 
-						std::string shortElemType = SimplifyTypeName(elementTypeName);
-						ComponentFieldInfo elemInfo;
-						elemInfo.typeName = elementTypeName;
-						elemInfo.isStatic = false;
-						elemInfo.editableType = DetermineEditableType(elementTypeName, &elemInfo.enumTypeName);
+	if (tools)
+	{
+		ImGui::TableSetColumnIndex(1);
+		if (view.tooLarge)
+			ImGui::TextDisabled("Too large to sort");
+		else if (view.running)
+			ImGui::TextDisabled("Sorting...");
+		else if (order && view.filterBuffer[0])
+			ImGui::TextDisabled("%zu matches", order->indices.size());
+	}
 
-						int elemSize = sizeof(void*);
-						elemInfo.isValueType = false;
+	const auto stride = static_cast<uint32_t>(layout.stride);
+	const auto slots = static_cast<uint32_t>(header.slots);
+	const int rowCount = order ? static_cast<int>(order->indices.size()) : header.slots;
 
-						if (elemInfo.editableType == EditableType::Enum || elemInfo.editableType == EditableType::Int)
-						{
-							if (elementTypeName == "System.Int64" || elementTypeName == "System.UInt64" ||
-								elementTypeName == "System.IntPtr" || elementTypeName == "System.UIntPtr")
-								elemSize = sizeof(void*);
-							else if (elementTypeName == "System.Int16" || elementTypeName == "System.UInt16" ||
-								elementTypeName == "System.Char")
-								elemSize = 2;
-							else if (elementTypeName == "System.Byte" || elementTypeName == "System.SByte" ||
-								elementTypeName == "System.Boolean")
-								elemSize = 1;
-							else elemSize = 4;
-							elemInfo.isValueType = true;
-						}
-						else if (elemInfo.editableType == EditableType::Float)
-						{
-							elemSize = 4;
-							elemInfo.isValueType = true;
-						}
-						else if (elemInfo.editableType == EditableType::Double)
-						{
-							elemSize = 8;
-							elemInfo.isValueType = true;
-						}
-						else if (elemInfo.editableType == EditableType::Decimal)
-						{
-							elemSize = 16;
-							elemInfo.isValueType = true;
-						}
-						else if (elemInfo.editableType == EditableType::Bool)
-						{
-							elemSize = 1;
-							elemInfo.isValueType = true;
-						}
-						else if (elemInfo.editableType == EditableType::Vector2)
-						{
-							elemSize = 8;
-							elemInfo.isValueType = true;
-						}
-						else if (elemInfo.editableType == EditableType::Vector3)
-						{
-							elemSize = 12;
-							elemInfo.isValueType = true;
-						}
-						else if (elemInfo.editableType == EditableType::Vector4 || elemInfo.editableType ==
-							EditableType::Quaternion || elemInfo.editableType == EditableType::Color)
-						{
-							elemSize = 16;
-							elemInfo.isValueType = true;
-						}
+	ComponentFieldInfo element = layout.element;
+	ComponentFieldInfo value = layout.value;
+	FieldSnapshot& page = view.page;
 
-						int slotStride = 8 + elemSize;
-						int align = (elemSize >= 8 || !elemInfo.isValueType) ? 8 : 4;
-						slotStride = ((slotStride + align - 1) / align) * align;
+	ImGuiListClipper clipper;
+	clipper.Begin(rowCount);
+	while (clipper.Step())
+	{
+		// An order may still be for an earlier, larger collection; its stale indices are skipped
+		uint32_t lo = UINT32_MAX, hi = 0;
+		for (int row = clipper.DisplayStart; row < clipper.DisplayEnd; row++)
+		{
+			const uint32_t index = order ? order->indices[row] : static_cast<uint32_t>(row);
+			if (index >= slots) continue;
+			lo = std::min(lo, index);
+			hi = std::max(hi, index + 1);
+		}
 
-						int lastIndex = 0;
-						Helper::SafeReadInt(collectionPtr, 0x24, lastIndex);
+		const size_t pageBytes = lo < hi ? static_cast<size_t>(hi - lo) * stride : 0;
+		page.instance = reinterpret_cast<void*>(header.data + static_cast<uintptr_t>(lo) * stride);
+		page.begin = 0;
+		page.valid = false;
+		if (pageBytes && pageBytes <= static_cast<size_t>(fieldSnapshotMaxBytes))
+		{
+			page.bytes.resize(pageBytes);
+			page.valid = Helper::SafeReadSpan(page.instance, 0, pageBytes, page.bytes.data());
+		}
 
-						int displayIndex = 0;
-						for (int i = 0; i < lastIndex && displayIndex < collectionCount; ++i)
-						{
-							int hashCode = 0;
-							Helper::SafeReadInt(arrayDataStart, 0x20 + i * slotStride, hashCode);
-							if (hashCode < 0) continue;
+		for (int row = clipper.DisplayStart; row < clipper.DisplayEnd; row++)
+		{
+			const uint32_t index = order ? order->indices[row] : static_cast<uint32_t>(row);
+			if (index >= slots) continue;
 
-							auto slotValueAddr = reinterpret_cast<void*>(
-								reinterpret_cast<uintptr_t>(arrayDataStart) + 0x20 + i * slotStride + 8);
+			// Rows read from the page when it was taken, and from their own entry when it was too wide
+			void* base = page.valid ? page.instance : reinterpret_cast<void*>(header.data + static_cast<uintptr_t>(index) * stride);
+			const int entryOffset = page.valid ? static_cast<int>((index - lo) * stride) : 0;
 
-							ImGui::TableNextRow();
+			ImGui::TableNextRow();
+			ImGui::PushID(static_cast<int>(index));
 
-							ImGui::TableSetColumnIndex(0);
-							ImGui::Indent(15.0f);
-							ImGui::Text("[%d]", displayIndex);
-							ImGui::Unindent(15.0f);
+			if (layout.kind == CollectionKind::HashSet && !order)
+			{
+				if (int hashCode = 0; ReadFieldValue(&page, base, entryOffset, hashCode) && hashCode < 0)
+				{
+					ImGui::TableSetColumnIndex(0);
+					ImGui::Indent(15.0f);
+					ImGui::TextDisabled("[%u]", index);
+					ImGui::Unindent(15.0f);
+					ImGui::TableSetColumnIndex(2);
+					ImGui::TextDisabled("(free)");
+					ImGui::PopID();
+					continue;
+				}
+			}
 
-							ImGui::TableSetColumnIndex(1);
-							ImGui::TextUnformatted(shortElemType.c_str());
-							if (ImGui::IsItemHovered())
-							{
-								ImGui::BeginTooltip();
-								ImGui::Text("%s", elementTypeName.c_str());
-								ImGui::EndTooltip();
-							}
+			ImGui::TableSetColumnIndex(0);
+			ImGui::Indent(15.0f);
+			ImGui::Text("[%u]", layout.kind == CollectionKind::HashSet && order ? static_cast<uint32_t>(row) : index);
+			ImGui::Unindent(15.0f);
 
-							ImGui::TableSetColumnIndex(2);
-							ImGui::PushID(reinterpret_cast<intptr_t>(slotValueAddr) + displayIndex);
-							elemInfo.name = "[" + std::to_string(displayIndex) + "]";
-							elemInfo.offset = 0;
-							RenderEditableField(slotValueAddr, elemInfo);
-							ImGui::PopID();
+			ImGui::TableSetColumnIndex(1);
+			if (layout.kind == CollectionKind::Dictionary)
+			{
+				ImGui::TextDisabled("%s", layout.elementLabel.c_str());
+			}
+			else
+			{
+				ImGui::TextUnformatted(layout.elementLabel.c_str());
+				if (ImGui::IsItemHovered())
+				{
+					ImGui::BeginTooltip();
+					ImGui::Text("%s", layout.elementTypeName.c_str());
+					ImGui::EndTooltip();
+				}
+			}
 
-							ImGui::TableSetColumnIndex(3);
+			ImGui::TableSetColumnIndex(2);
+			element.offset = entryOffset + layout.element.offset;
+			if (layout.kind != CollectionKind::Dictionary)
+			{
+				element.name = "[" + std::to_string(index) + "]";
+				RenderEditableField(base, element, -1.0f, &page);
+				ImGui::TableSetColumnIndex(3);
+				ImGui::PopID();
+				continue;
+			}
 
-							displayIndex++;
-						}
-					}
-					else
-					{
-						std::string elementTypeName = "Element";
-						if (isArray)
-						{
-							if (size_t pos = field->typeName.find("[]"); pos != std::string::npos)
-								elementTypeName =
-									field->typeName.substr(0, pos);
-						}
-						else if (isList || isStack || isQueue || isHashSet)
-						{
-							size_t start = field->typeName.find("<");
-							if (size_t end = field->typeName.rfind(">"); start != std::string::npos && end !=
-								std::string::npos && end > start)
-							{
-								elementTypeName = field->typeName.substr(start + 1, end - start - 1);
-							}
-						}
-						else if (isArrayList)
-						{
-							elementTypeName = "System.Object";
-						}
+			value.offset = entryOffset + layout.value.offset;
+			void* valuePtr = nullptr;
+			if (layout.hasDictionaryTypes)
+			{
+				const float editorW = (ImGui::GetContentRegionAvail().x - 30.0f) * 0.45f;
 
-						std::string shortElemType = SimplifyTypeName(elementTypeName);
-						ComponentFieldInfo elemInfo;
-						elemInfo.typeName = elementTypeName;
-						elemInfo.isStatic = false;
-						elemInfo.editableType = DetermineEditableType(elementTypeName, &elemInfo.enumTypeName);
+				ImGui::PushID(0);
+				RenderEditableField(base, element, editorW, &page);
+				ImGui::PopID();
 
-						int elemSize = sizeof(void*);
-						elemInfo.isValueType = false;
+				ImGui::SameLine();
+				ImGui::Text("->");
+				ImGui::SameLine();
 
-						if (elemInfo.editableType == EditableType::Enum || elemInfo.editableType == EditableType::Int)
-						{
-							if (elementTypeName == "System.Int64" || elementTypeName == "System.UInt64" ||
-								elementTypeName == "System.IntPtr" || elementTypeName == "System.UIntPtr")
-								elemSize = sizeof(void*);
-							else if (elementTypeName == "System.Int16" || elementTypeName == "System.UInt16" ||
-								elementTypeName == "System.Char")
-								elemSize = 2;
-							else if (elementTypeName == "System.Byte" || elementTypeName == "System.SByte" ||
-								elementTypeName == "System.Boolean")
-								elemSize = 1;
-							else elemSize = 4;
-							elemInfo.isValueType = true;
-						}
-						else if (elemInfo.editableType == EditableType::Float)
-						{
-							elemSize = 4;
-							elemInfo.isValueType = true;
-						}
-						else if (elemInfo.editableType == EditableType::Double)
-						{
-							elemSize = 8;
-							elemInfo.isValueType = true;
-						}
-						else if (elemInfo.editableType == EditableType::Decimal)
-						{
-							elemSize = 16;
-							elemInfo.isValueType = true;
-						}
-						else if (elemInfo.editableType == EditableType::Bool)
-						{
-							elemSize = 1;
-							elemInfo.isValueType = true;
-						}
-						else if (elemInfo.editableType == EditableType::Vector2)
-						{
-							elemSize = 8;
-							elemInfo.isValueType = true;
-						}
-						else if (elemInfo.editableType == EditableType::Vector3)
-						{
-							elemSize = 12;
-							elemInfo.isValueType = true;
-						}
-						else if (elemInfo.editableType == EditableType::Vector4 || elemInfo.editableType ==
-							EditableType::Quaternion || elemInfo.editableType == EditableType::Color)
-						{
-							elemSize = 16;
-							elemInfo.isValueType = true;
-						}
+				ImGui::PushID(1);
+				RenderEditableField(base, value, editorW, &page);
+				ImGui::PopID();
 
-						for (int i = 0; i < collectionCount; ++i)
-						{
-							ImGui::TableNextRow();
+				if (layout.valueIsReference)
+					ReadFieldValue(&page, base, value.offset, valuePtr);
+			}
+			else
+			{
+				void* entryKey = nullptr;
+				ReadFieldValue(&page, base, element.offset, entryKey);
+				ReadFieldValue(&page, base, value.offset, valuePtr);
+				ImGui::Text("%p -> %p", entryKey, valuePtr);
+			}
 
-							ImGui::TableSetColumnIndex(0);
-							ImGui::Indent(15.0f);
-							ImGui::Text("[%d]", i);
-							ImGui::Unindent(15.0f);
+			ImGui::TableSetColumnIndex(3);
+			if (valuePtr && ImGui::SmallButton("Enter"))
+			{
+				if (auto activeTab = GetActiveTab())
+				{
+					InspectionTarget nextTarget;
+					nextTarget.instance = valuePtr;
+					nextTarget.name = field.name + "[" + std::to_string(index) + "].Value";
+					nextTarget.classHandle = nullptr;
 
-							ImGui::TableSetColumnIndex(1);
-							ImGui::TextUnformatted(shortElemType.c_str());
-							if (ImGui::IsItemHovered())
-							{
-								ImGui::BeginTooltip();
-								ImGui::Text("%s", elementTypeName.c_str());
-								ImGui::EndTooltip();
-							}
+					nextTarget.cachedComponents.push_back(static_cast<UT::Component*>(valuePtr));
+					nextTarget.cachedComponentNames.push_back("DictionaryValue");
 
-							ImGui::TableSetColumnIndex(2);
-							ImGui::PushID(reinterpret_cast<intptr_t>(arrayDataStart) + i);
-							elemInfo.name = "[" + std::to_string(i) + "]";
-							elemInfo.offset = i * elemSize;
-							RenderEditableField(arrayDataStart, elemInfo);
-							ImGui::PopID();
+					nextTarget.cachedDescriptors.push_back(GetClassDescriptor(valuePtr, nullptr));
 
-							ImGui::TableSetColumnIndex(3);
-						}
-					}
+					activeTab->navigationStack.push_back(std::move(nextTarget));
 				}
-				ImGui::TreePop();
 			}
+			ImGui::PopID();
 		}
-
-		ImGui::EndTable();
 	}
 }
 
@@ -2170,13 +2205,12 @@ void Inspector::RenderPropertiesSection(void* instance, const std::vector<Compon
 
 	ImGui::Spacing();
 
-	std::string lowerSearch = lSearchBuffer;
-	std::ranges::transform(lowerSearch, lowerSearch.begin(), tolower);
+	const Helper::SearchNeedle search(lSearchBuffer);
 
 	std::vector<const ComponentPropertyInfo*> filteredProps;
 	for (const auto& prop : properties)
 	{
-		if (PassesPropertyFilter(prop, lowerSearch, tab.filterEditableOnly))
+		if (PassesPropertyFilter(prop, search, tab.filterEditableOnly))
 			filteredProps.push_back(&prop);
 	}
 
@@ -2257,13 +2291,12 @@ void Inspector::RenderMethodsSection(void* instance, const std::vector<Component
 
 	ImGui::Spacing();
 
-	std::string lowerSearch = lSearchBuffer;
-	std::ranges::transform(lowerSearch, lowerSearch.begin(), tolower);
+	const Helper::SearchNeedle search(lSearchBuffer);
 
 	std::vector<const ComponentMethodInfo*> filteredMethods;
 	for (const auto& method : methods)
 	{
-		if (PassesMethodFilter(method, lowerSearch, tab.filterStaticOnly, tab.filterInstanceOnly))
+		if (PassesMethodFilter(method, search, tab.filterStaticOnly, tab.filterInstanceOnly))
 			filteredMethods.push_back(&method);
 	}
 
@@ -2381,8 +2414,7 @@ void Inspector::RenderComponentsSection(InspectionTarget& target, InspectedObjec
 
 	ImGui::Spacing();
 
-	std::string lowerSearch = target.componentSearchBuffer;
-	std::ranges::transform(lowerSearch, lowerSearch.begin(), tolower);
+	const Helper::SearchNeedle search(target.componentSearchBuffer);
 
 	std::vector<size_t> filteredComponentIndices;
 	for (size_t i = 0; i < target.cachedComponents.size(); i++)
@@ -2390,7 +2422,7 @@ void Inspector::RenderComponentsSection(InspectionTarget& target, InspectedObjec
 		if (i >= target.cachedComponentNames.size())
 			continue;
 		if (const std::string& compName = target.cachedComponentNames[i]; PassesComponentFilter(
-			compName, lowerSearch))
+			compName, search))
 			filteredComponentIndices.push_back(i);
 	}
 
@@ -2407,18 +2439,15 @@ void Inspector::RenderComponentsSection(InspectionTarget& target, InspectedObjec
 	{
 		if (idx >= target.cachedComponents.size() ||
 			idx >= target.cachedComponentNames.size() ||
-			idx >= target.cachedComponentFields.size())
+			idx >= target.cachedDescriptors.size())
 			continue;
 
 		const auto comp = target.cachedComponents[idx];
 		const std::string& compName = target.cachedComponentNames[idx];
-		const auto& fields = target.cachedComponentFields[idx];
-		const auto& properties = target.cachedComponentProperties.size() > idx
-			                         ? target.cachedComponentProperties[idx]
-			                         : std::vector<ComponentPropertyInfo>{};
-		const auto& methods = target.cachedComponentMethods.size() > idx
-			                      ? target.cachedComponentMethods[idx]
-			                      : std::vector<ComponentMethodInfo>{};
+		const ClassDescriptor& descriptor = *target.cachedDescriptors[idx];
+		const auto& fields = descriptor.fields;
+		const auto& properties = descriptor.properties;
+		const auto& methods = descriptor.methods;
 
 		ImGui::PushID(static_cast<int>(idx));
 
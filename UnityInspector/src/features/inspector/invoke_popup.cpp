@@ -74,7 +74,7 @@ void Inspector::RenderMethodInvokePopup()
 				case EditableType::Enum:
 				{
 					const std::string enumTypeName = invokeState.method.parameters[i].second;
-					if (const auto enumVals = GetEnumValues(enumTypeName); !enumVals.empty())
+					if (const auto& enumVals = GetEnumValues(enumTypeName); !enumVals.empty())
 					{
 						int currentVal = 0;
 						try { currentVal = std::stoi(buf); } catch (...) {}
@@ -149,9 +149,7 @@ void Inspector::RenderMethodInvokePopup()
 					const std::string returnTypeName = invokeState.method.returnTypeName;
 					const EditableType retType = DetermineEditableType(returnTypeName);
 
-					if (void* unboxed = UR::Invoke<void*, void*>(
-						Config::state.unityMode == UnityResolve::Mode::Mono ? "mono_object_unbox" : "il2cpp_object_unbox",
-						result))
+					if (void* unboxed = UR::Invoke<void*, void*>(UR::Export::ObjectUnbox, result))
 					{
 						switch (retType)
 						{
@@ -263,9 +261,7 @@ void Inspector::RenderMethodInvokePopup()
 						nextTarget.cachedComponents.push_back(static_cast<UT::Component*>(invokeState.resultPointer));
 						nextTarget.cachedComponentNames.push_back(invokeState.method.returnTypeName);
 
-						nextTarget.cachedComponentFields.push_back(GetObjectFields(invokeState.resultPointer, klass));
-						nextTarget.cachedComponentProperties.push_back(GetObjectProperties(invokeState.resultPointer, klass));
-						nextTarget.cachedComponentMethods.push_back(GetObjectMethods(invokeState.resultPointer, klass));
+						nextTarget.cachedDescriptors.push_back(GetClassDescriptor(invokeState.resultPointer, klass));
 
 						activeTab->navigationStack.push_back(std::move(nextTarget));
 					}
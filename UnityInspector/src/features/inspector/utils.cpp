@@ -2,22 +2,35 @@
 #include "inspector.h"
 #include "helper/helper.h"
 
-#define API(fn) (mono ? "mono_" fn : "il2cpp_" fn)
-
+namespace
+{
+	// Reflection metadata never changes for a loaded class, so descriptors are built once per class handle
+	// and shared by every tab and navigation level that inspects an instance of it
+	std::unordered_map<void*, std::shared_ptr<const ClassDescriptor>> classDescriptors;
+}
 
-std::string Inspector::GetComponentTypeName(UT::Component* component) const
+std::shared_ptr<const ClassDescriptor> Inspector::GetClassDescriptor(void* obj, void* klass) const
 {
-	if (!component) return "Unknown";
+	static const auto empty = std::make_shared<const ClassDescriptor>();
 
-	const bool mono = Config::state.unityMode == UnityResolve::Mode::Mono;
+	if (!klass && obj)
+		klass = Helper::SafeGetObjectClass(obj);
 
-	if (void* klass = Helper::SafeGetObjectClass(component))
-	{
-		if (const char* className = UR::Invoke<const char*, void*>(API("class_get_name"), klass))
-			return {className};
-	}
+	if (!klass) return empty;
+
+	if (const auto it = classDescriptors.find(klass); it != classDescriptors.end())
+		return it->second;
+
+	auto descriptor = std::make_shared<ClassDescriptor>();
+	if (const char* className = UR::Invoke<const char*, void*>(UR::Export::ClassGetName, klass))
+		descriptor->name = className;
+	else
+		descriptor->name = "Component";
+	descriptor->fields = GetObjectFields(nullptr, klass);
+	descriptor->properties = GetObjectProperties(nullptr, klass);
+	descriptor->methods = GetObjectMethods(nullptr, klass);
 
-	return "Component";
+	return classDescriptors.emplace(klass, std::move(descriptor)).first->second;
 }
 
 std::vector<ComponentFieldInfo> Inspector::GetObjectFields(void* obj, void* klass) const
@@ -36,44 +49,37 @@ std::vector<ComponentFieldInfo> Inspector::GetObjectFields(void* obj, void* klas
 		void* iter = nullptr;
 		void* field;
 
-		while ((field = UR::Invoke<void*, void*, void*>(API("class_get_fields"), currentClass, &iter)))
+		while ((field = UR::Invoke<void*, void*, void*>(UR::Export::ClassGetFields, currentClass, &iter)))
 		{
 			ComponentFieldInfo info;
 			info.fieldHandle = field;
 			info.classHandle = currentClass;
 
-			const char* fieldName = UR::Invoke<const char*, void*>(API("field_get_name"), field);
+			const char* fieldName = UR::Invoke<const char*, void*>(UR::Export::FieldGetName, field);
 			info.name = fieldName && fieldName[0] ? fieldName : "(unnamed)";
 
-			info.offset = UR::Invoke<int, void*>(API("field_get_offset"), field);
+			info.offset = UR::Invoke<int, void*>(UR::Export::FieldGetOffset, field);
 
-			const int flags = UR::Invoke<int, void*>(API("field_get_flags"), field);
+			const int flags = UR::Invoke<int, void*>(UR::Export::FieldGetFlags, field);
 			info.isStatic = (flags & 0x10) != 0;
 
-			if (!info.isStatic && UR::Invoke<bool, void*>(API("class_is_valuetype"), currentClass))
+			if (!info.isStatic && UR::Invoke<bool, void*>(UR::Export::ClassIsValueType, currentClass))
 			{
 				info.offset -= 0x10; // sizeof(Object) header
 			}
 
-			if (void* fieldType = UR::Invoke<void*, void*>(API("field_get_type"), field))
+			if (void* fieldType = UR::Invoke<void*, void*>(UR::Export::FieldGetType, field))
 			{
-				const char* typeName = UR::Invoke<const char*, void*>(API("type_get_name"), fieldType);
+				const char* typeName = UR::Invoke<const char*, void*>(UR::Export::TypeGetName, fieldType);
 				info.typeName = typeName ? typeName : "unknown";
 
-				if (mono)
-				{
-					info.typeClassHandle = UR::Invoke<void*, void*>("mono_class_from_mono_type", fieldType);
-					if (!info.typeClassHandle) // fallback
-						info.typeClassHandle = UR::Invoke<void*, void*>("mono_type_get_class", fieldType);
-				}
-				else
-				{
-					info.typeClassHandle = UR::Invoke<void*, void*>("il2cpp_class_from_type", fieldType);
-				}
+				info.typeClassHandle = UR::Invoke<void*, void*>(UR::Export::ClassFromType, fieldType);
+				if (!info.typeClassHandle && mono) // fallback
+					info.typeClassHandle = UR::Invoke<void*, void*>(UR::Export::TypeGetClass, fieldType);
 
 				if (info.typeClassHandle)
 				{
-					info.isValueType = UR::Invoke<bool, void*>(API("class_is_valuetype"), info.typeClassHandle);
+					info.isValueType = UR::Invoke<bool, void*>(UR::Export::ClassIsValueType, info.typeClassHandle);
 				}
 			}
 			else
@@ -85,17 +91,12 @@ std::vector<ComponentFieldInfo> Inspector::GetObjectFields(void* obj, void* klas
 			fields.push_back(info);
 		}
 
-		currentClass = UR::Invoke<void*, void*>(API("class_get_parent"), currentClass);
+		currentClass = UR::Invoke<void*, void*>(UR::Export::ClassGetParent, currentClass);
 	}
 
 	return fields;
 }
 
-std::vector<ComponentFieldInfo> Inspector::GetComponentFields(UT::Component* component) const
-{
-	return GetObjectFields(component, nullptr);
-}
-
 std::vector<ComponentPropertyInfo> Inspector::GetObjectProperties(void* obj, void* klass) const
 {
 	std::vector<ComponentPropertyInfo> properties;
@@ -112,34 +113,34 @@ std::vector<ComponentPropertyInfo> Inspector::GetObjectProperties(void* obj, voi
 		void* iter = nullptr;
 		void* prop;
 
-		while ((prop = UR::Invoke<void*, void*, void*>(API("class_get_properties"), currentClass, &iter)))
+		while ((prop = UR::Invoke<void*, void*, void*>(UR::Export::ClassGetProperties, currentClass, &iter)))
 		{
 			ComponentPropertyInfo info;
 
-			const char* propName = UR::Invoke<const char*, void*>(API("property_get_name"), prop);
+			const char* propName = UR::Invoke<const char*, void*>(UR::Export::PropertyGetName, prop);
 			info.name = propName && propName[0] ? propName : "(unnamed)";
 
-			info.getterHandle = UR::Invoke<void*, void*>(API("property_get_get_method"), prop);
-			info.setterHandle = UR::Invoke<void*, void*>(API("property_get_set_method"), prop);
+			info.getterHandle = UR::Invoke<void*, void*>(UR::Export::PropertyGetGetMethod, prop);
+			info.setterHandle = UR::Invoke<void*, void*>(UR::Export::PropertyGetSetMethod, prop);
 			info.canRead = info.getterHandle != nullptr;
 			info.canWrite = info.setterHandle != nullptr;
 
 			if (mono && info.getterHandle)
 			{
-				if (void* sig = UR::Invoke<void*, void*>("mono_method_signature", info.getterHandle))
+				if (void* sig = UR::Invoke<void*, void*>(UR::Export::MethodSignature, info.getterHandle))
 				{
-					if (void* retType = UR::Invoke<void*, void*>("mono_signature_get_return_type", sig))
+					if (void* retType = UR::Invoke<void*, void*>(UR::Export::SignatureGetReturnType, sig))
 					{
-						const char* typeName = UR::Invoke<const char*, void*>("mono_type_get_name", retType);
+						const char* typeName = UR::Invoke<const char*, void*>(UR::Export::TypeGetName, retType);
 						info.typeName = typeName ? typeName : "unknown";
 					}
 				}
 			}
 			else if (info.getterHandle)
 			{
-				if (void* retType = UR::Invoke<void*, void*>("il2cpp_method_get_return_type", info.getterHandle))
+				if (void* retType = UR::Invoke<void*, void*>(UR::Export::MethodGetReturnType, info.getterHandle))
 				{
-					const char* typeName = UR::Invoke<const char*, void*>("il2cpp_type_get_name", retType);
+					const char* typeName = UR::Invoke<const char*, void*>(UR::Export::TypeGetName, retType);
 					info.typeName = typeName ? typeName : "unknown";
 				}
 			}
@@ -148,17 +149,12 @@ std::vector<ComponentPropertyInfo> Inspector::GetObjectProperties(void* obj, voi
 			properties.push_back(info);
 		}
 
-		currentClass = UR::Invoke<void*, void*>(API("class_get_parent"), currentClass);
+		currentClass = UR::Invoke<void*, void*>(UR::Export::ClassGetParent, currentClass);
 	}
 
 	return properties;
 }
 
-std::vector<ComponentPropertyInfo> Inspector::GetComponentProperties(UT::Component* component) const
-{
-	return GetObjectProperties(component, nullptr);
-}
-
 std::vector<ComponentMethodInfo> Inspector::GetObjectMethods(void* obj, void* klass) const
 {
 	std::vector<ComponentMethodInfo> methods;
@@ -175,27 +171,27 @@ std::vector<ComponentMethodInfo> Inspector::GetObjectMethods(void* obj, void* kl
 		void* iter = nullptr;
 		void* method;
 
-		while ((method = UR::Invoke<void*, void*, void*>(API("class_get_methods"), currentClass, &iter)))
+		while ((method = UR::Invoke<void*, void*, void*>(UR::Export::ClassGetMethods, currentClass, &iter)))
 		{
 			ComponentMethodInfo info;
 			info.methodHandle = method;
 
-			const char* methodName = UR::Invoke<const char*, void*>(API("method_get_name"), method);
+			const char* methodName = UR::Invoke<const char*, void*>(UR::Export::MethodGetName, method);
 			info.name = methodName && methodName[0] ? methodName : "(unnamed)";
 
 			int fFlags = 0;
-			info.flags = UR::Invoke<int, void*, int*>(API("method_get_flags"), method, &fFlags);
+			info.flags = UR::Invoke<int, void*, int*>(UR::Export::MethodGetFlags, method, &fFlags);
 			info.isStatic = (info.flags & 0x10) != 0;
 			info.isVirtual = (info.flags & 0x40) != 0;
 
 			if (mono)
 			{
-				const auto signature = UR::Invoke<void*, void*>("mono_method_signature", method);
+				const auto signature = UR::Invoke<void*, void*>(UR::Export::MethodSignature, method);
 				if (!signature) continue;
 
-				if (void* returnType = UR::Invoke<void*, void*>("mono_signature_get_return_type", signature))
+				if (void* returnType = UR::Invoke<void*, void*>(UR::Export::SignatureGetReturnType, signature))
 				{
-					const char* typeName = UR::Invoke<const char*, void*>("mono_type_get_name", returnType);
+					const char* typeName = UR::Invoke<const char*, void*>(UR::Export::TypeGetName, returnType);
 					info.returnTypeName = typeName ? typeName : "void";
 				}
 				else
@@ -203,19 +199,19 @@ std::vector<ComponentMethodInfo> Inspector::GetObjectMethods(void* obj, void* kl
 					info.returnTypeName = "void";
 				}
 
-				if (int paramCount = UR::Invoke<int, void*>("mono_signature_get_param_count", signature); paramCount >
+				if (int paramCount = UR::Invoke<int, void*>(UR::Export::SignatureGetParamCount, signature); paramCount >
 					0)
 				{
 					std::vector<char*> paramNames(paramCount);
-					UR::Invoke<void, void*, char**>("mono_method_get_param_names", method, paramNames.data());
+					UR::Invoke<void, void*, char**>(UR::Export::MethodGetParamNames, method, paramNames.data());
 
 					void* mIter = nullptr;
 					void* mType;
 					int paramIndex = 0;
-					while (((mType = UR::Invoke<void*, void*, void*>("mono_signature_get_params", signature, &mIter)))
+					while (((mType = UR::Invoke<void*, void*, void*>(UR::Export::SignatureGetParams, signature, &mIter)))
 						&& paramIndex < paramCount)
 					{
-						const char* paramTypeName = UR::Invoke<const char*, void*>("mono_type_get_name", mType);
+						const char* paramTypeName = UR::Invoke<const char*, void*>(UR::Export::TypeGetName, mType);
 						std::string pName = (std::cmp_less(paramIndex, static_cast<int>(paramNames.size())) &&
 							                    paramNames[paramIndex])
 							                    ? paramNames[paramIndex]
@@ -229,9 +225,9 @@ std::vector<ComponentMethodInfo> Inspector::GetObjectMethods(void* obj, void* kl
 			}
 			else
 			{
-				if (void* returnType = UR::Invoke<void*, void*>("il2cpp_method_get_return_type", method))
+				if (void* returnType = UR::Invoke<void*, void*>(UR::Export::MethodGetReturnType, method))
 				{
-					const char* typeName = UR::Invoke<const char*, void*>("il2cpp_type_get_name", returnType);
+					const char* typeName = UR::Invoke<const char*, void*>(UR::Export::TypeGetName, returnType);
 					info.returnTypeName = typeName ? typeName : "void";
 				}
 				else
@@ -239,13 +235,13 @@ std::vector<ComponentMethodInfo> Inspector::GetObjectMethods(void* obj, void* kl
 					info.returnTypeName = "void";
 				}
 
-				int paramCount = UR::Invoke<int, void*>("il2cpp_method_get_param_count", method);
+				int paramCount = UR::Invoke<int, void*>(UR::Export::MethodGetParamCount, method);
 				for (int i = 0; i < paramCount; i++)
 				{
-					const char* pName = UR::Invoke<const char*, void*, int>("il2cpp_method_get_param_name", method, i);
-					void* pType = UR::Invoke<void*, void*, int>("il2cpp_method_get_param", method, i);
+					const char* pName = UR::Invoke<const char*, void*, int>(UR::Export::MethodGetParamName, method, i);
+					void* pType = UR::Invoke<void*, void*, int>(UR::Export::MethodGetParam, method, i);
 					const char* pTypeName = pType
-						                        ? UR::Invoke<const char*, void*>("il2cpp_type_get_name", pType)
+						                        ? UR::Invoke<const char*, void*>(UR::Export::TypeGetName, pType)
 						                        : nullptr;
 
 					std::string typeName = pTypeName ? pTypeName : "unknown";
@@ -260,19 +256,12 @@ std::vector<ComponentMethodInfo> Inspector::GetObjectMethods(void* obj, void* kl
 			methods.push_back(std::move(info));
 		}
 
-		currentClass = UR::Invoke<void*, void*>(API("class_get_parent"), currentClass);
+		currentClass = UR::Invoke<void*, void*>(UR::Export::ClassGetParent, currentClass);
 	}
 
 	return methods;
 }
 
-std::vector<ComponentMethodInfo> Inspector::GetComponentMethods(UT::Component* component) const
-{
-	return GetObjectMethods(component, nullptr);
-}
-
-#undef API
-
 void* Inspector::InvokeMethod(void* instance, const ComponentMethodInfo& method,
                               const std::vector<std::string>& paramValues) const
 {
@@ -325,90 +314,6 @@ std::string Inspector::BuildObjectPath(UT::Transform* transform) const
 	return path;
 }
 
-void Inspector::BuildHierarchyNode(HierarchyNode& node, UT::Transform* transform)
-{
-	if (!Helper::SafeIsAlive(transform)) return;
-
-	node.transform = transform;
-
-	UT::GameObject* go = nullptr;
-	if (!Helper::SafeGetGameObject(transform, go) || !go)
-	{
-		node.gameObject = nullptr;
-		return;
-	}
-
-	if (!Helper::SafeIsAlive(go))
-	{
-		node.gameObject = nullptr;
-		return;
-	}
-
-	node.gameObject = go;
-
-	if (UT::String* nameStr = nullptr; Helper::SafeGetName(go, nameStr) && nameStr)
-	{
-		node.name = nameStr->ToString();
-	}
-	else
-	{
-		node.name = "(Unnamed)";
-	}
-
-	int childCount = 0;
-	if (!Helper::SafeGetChildCount(transform, childCount))
-		return;
-
-	for (int i = 0; i < childCount; i++)
-	{
-		if (UT::Transform* child = nullptr; Helper::SafeGetChild(transform, i, child) && child)
-		{
-			HierarchyNode childNode;
-			BuildHierarchyNode(childNode, child);
-			if (childNode.gameObject)
-			{
-				node.children.push_back(std::move(childNode));
-			}
-		}
-	}
-}
-
-void Inspector::RefreshHierarchy()
-{
-	rootNodes.clear();
-
-	const auto assembly = UR::Get("UnityEngine.CoreModule.dll");
-	if (!assembly) return;
-
-	const auto transformClass = assembly->Get("Transform", "UnityEngine");
-	if (!transformClass) return;
-	std::vector<UT::Transform*> transforms = transformClass->FindObjectsByType<UT::Transform*>();
-	if (transforms.empty())
-	{
-		transforms = transformClass->FindObjectsOfType<UT::Transform*>();
-		if (transforms.empty()) return;
-	}
-
-	for (const auto& t : transforms)
-	{
-		if (!Helper::SafeIsAlive(t)) continue;
-
-		UT::Transform* parent = nullptr;
-		if (!Helper::SafeGetParent(t, parent))
-			continue;
-
-		if (!parent)
-		{
-			HierarchyNode node;
-			BuildHierarchyNode(node, t);
-			if (node.gameObject)
-			{
-				rootNodes.push_back(std::move(node));
-			}
-		}
-	}
-}
-
 void Inspector::RefreshTabData(InspectedObjectTab& tab) const
 {
 	if (!tab.gameObject || !Helper::SafeIsAlive(tab.gameObject)) return;
@@ -444,10 +349,9 @@ void Inspector::RefreshTabData(InspectedObjectTab& tab) const
 			if (comp && Helper::SafeIsAlive(comp))
 			{
 				rootTarget.cachedComponents.push_back(comp);
-				rootTarget.cachedComponentNames.push_back(GetComponentTypeName(comp));
-				rootTarget.cachedComponentFields.push_back(GetComponentFields(comp));
-				rootTarget.cachedComponentProperties.push_back(GetComponentProperties(comp));
-				rootTarget.cachedComponentMethods.push_back(GetComponentMethods(comp));
+				auto descriptor = GetClassDescriptor(comp, nullptr);
+				rootTarget.cachedComponentNames.push_back(descriptor->name);
+				rootTarget.cachedDescriptors.push_back(std::move(descriptor));
 			}
 		}
 
@@ -455,16 +359,97 @@ void Inspector::RefreshTabData(InspectedObjectTab& tab) const
 	}
 }
 
-bool Inspector::PassesComponentFilter(const std::string& componentName, std::string_view lowerSearch) const
+// Auto-refresh path. Components are diffed by pointer against the root target so the navigation stack,
+// search buffers and descriptors survive; when nothing was added or removed no heap allocation is made.
+void Inspector::RefreshTabValues(InspectedObjectTab& tab) const
+{
+	if (!tab.gameObject || !Helper::SafeIsAlive(tab.gameObject)) return;
+	if (tab.navigationStack.empty())
+	{
+		RefreshTabData(tab);
+		return;
+	}
+
+#ifdef _DEBUG
+	const size_t allocationsBefore = Helper::AllocationCount();
+#endif
+
+	static UR::Class* componentClass = nullptr;
+	if (!componentClass)
+	{
+		const auto assembly = UR::Get("UnityEngine.CoreModule.dll");
+		if (!assembly) return;
+		componentClass = assembly->Get("Component", "UnityEngine");
+		if (!componentClass) return;
+	}
+
+	std::vector<UT::Component*>& components = tab.scratchComponents;
+	if (!Helper::SafeGetComponents(tab.gameObject, componentClass, components)) return;
+	std::erase_if(components, [](UT::Component* comp) { return !comp || !Helper::SafeIsAlive(comp); });
+
+	InspectionTarget& root = tab.navigationStack.front();
+	if (components == root.cachedComponents)
+	{
+#ifdef _DEBUG
+		if (const size_t allocations = Helper::AllocationCount() - allocationsBefore)
+			LOG_DEBUG("[Inspector] Value refresh of {} made {} allocations", tab.tabName, allocations);
+#endif
+		return;
+	}
+
+	// Entries of components that are still attached move to their new position; search buffers are
+	// indexed by component, so they travel with them
+	std::vector<std::string> names;
+	std::vector<std::shared_ptr<const ClassDescriptor>> descriptors;
+	std::vector<std::array<char, 256>> fieldSearch(components.size());
+	std::vector<std::array<char, 256>> propertySearch(components.size());
+	std::vector<std::array<char, 256>> methodSearch(components.size());
+	names.reserve(components.size());
+	descriptors.reserve(components.size());
+
+	size_t kept = 0;
+	for (size_t i = 0; i < components.size(); i++)
+	{
+		const auto old = std::ranges::find(root.cachedComponents, components[i]);
+		if (old == root.cachedComponents.end())
+		{
+			auto descriptor = GetClassDescriptor(components[i], nullptr);
+			names.push_back(descriptor->name);
+			descriptors.push_back(std::move(descriptor));
+			continue;
+		}
+
+		const auto j = static_cast<size_t>(old - root.cachedComponents.begin());
+		names.push_back(std::move(root.cachedComponentNames[j]));
+		descriptors.push_back(std::move(root.cachedDescriptors[j]));
+		if (j < root.fieldSearchBuffers.size()) fieldSearch[i] = root.fieldSearchBuffers[j];
+		if (j < root.propertySearchBuffers.size()) propertySearch[i] = root.propertySearchBuffers[j];
+		if (j < root.methodSearchBuffers.size()) methodSearch[i] = root.methodSearchBuffers[j];
+		kept++;
+	}
+
+	// Objects drilled into may have been reached through a component that is gone
+	if (kept != root.cachedComponents.size())
+		tab.navigationStack.resize(1);
+
+	root.cachedComponents.assign(components.begin(), components.end());
+	root.cachedComponentNames = std::move(names);
+	root.cachedDescriptors = std::move(descriptors);
+	root.fieldSearchBuffers = std::move(fieldSearch);
+	root.propertySearchBuffers = std::move(propertySearch);
+	root.methodSearchBuffers = std::move(methodSearch);
+	root.fieldSnapshots.clear();
+}
+
+bool Inspector::PassesComponentFilter(const std::string& componentName, const Helper::SearchNeedle& search) const
 {
-	if (lowerSearch.empty()) return true;
-	return Helper::CaseInsensitiveFind(componentName, lowerSearch);
+	return search.FoundIn(componentName);
 }
 
-bool Inspector::PassesFieldFilter(const ComponentFieldInfo& field, std::string_view lowerSearch, const bool editableOnly,
-                                  const bool staticOnly, const bool instanceOnly) const
+bool Inspector::PassesFieldFilter(const ComponentFieldInfo& field, const Helper::SearchNeedle& search,
+                                  const bool editableOnly, const bool staticOnly, const bool instanceOnly) const
 {
-	if (!lowerSearch.empty() && !Helper::CaseInsensitiveFind(field.name, lowerSearch))
+	if (!search.FoundIn(field.name))
 		return false;
 
 	if (editableOnly && field.editableType == EditableType::None)
@@ -479,10 +464,10 @@ bool Inspector::PassesFieldFilter(const ComponentFieldInfo& field, std::string_v
 	return true;
 }
 
-bool Inspector::PassesPropertyFilter(const ComponentPropertyInfo& prop, std::string_view lowerSearch,
+bool Inspector::PassesPropertyFilter(const ComponentPropertyInfo& prop, const Helper::SearchNeedle& search,
                                      const bool editableOnly) const
 {
-	if (!lowerSearch.empty() && !Helper::CaseInsensitiveFind(prop.name, lowerSearch))
+	if (!search.FoundIn(prop.name))
 		return false;
 
 	if (editableOnly && !prop.canWrite)
@@ -491,10 +476,10 @@ bool Inspector::PassesPropertyFilter(const ComponentPropertyInfo& prop, std::str
 	return true;
 }
 
-bool Inspector::PassesMethodFilter(const ComponentMethodInfo& method, std::string_view lowerSearch, const bool staticOnly,
-                                   const bool instanceOnly) const
+bool Inspector::PassesMethodFilter(const ComponentMethodInfo& method, const Helper::SearchNeedle& search,
+                                   const bool staticOnly, const bool instanceOnly) const
 {
-	if (!lowerSearch.empty() && !Helper::CaseInsensitiveFind(method.name, lowerSearch))
+	if (!search.FoundIn(method.name))
 		return false;
 
 	if (staticOnly && !method.isStatic)
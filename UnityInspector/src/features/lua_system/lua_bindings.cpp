@@ -1550,28 +1550,35 @@ namespace LuaBindings
 		input_ns["GetMouseWheel"] = []() -> float { return ImGui::GetIO().MouseWheel; };
 	}
 
+	// Metadata names are interned views; Lua gets an owned copy and can never assign one
+	template <typename T, std::string_view T::* Member>
+	static auto NameProperty()
+	{
+		return sol::readonly_property([](const T& self) { return std::string(self.*Member); });
+	}
+
 	static void RegisterReflection(sol::state& lua)
 	{
 		auto unity = lua["Unity"].get_or_create<sol::table>();
 
 		lua.new_usertype<UR::Field>("Field",
-		                            "name", &UR::Field::name,
+		                            "name", NameProperty<UR::Field, &UR::Field::name>(),
 		                            "offset", &UR::Field::offset,
 		                            "static", &UR::Field::static_field,
 		                            "typeName", [](const UR::Field* self) -> std::string
 		                            {
 			                            if (!self || !self->type) return "";
-			                            return self->type->name;
+			                            return std::string(self->type->name);
 		                            }
 		);
 
 		lua.new_usertype<UR::Method>("Method",
-		                             "name", &UR::Method::name,
+		                             "name", NameProperty<UR::Method, &UR::Method::name>(),
 		                             "static", &UR::Method::static_function,
 		                             "returnType", [](const UR::Method* self) -> std::string
 		                             {
 			                             if (!self || !self->return_type) return "";
-			                             return self->return_type->name;
+			                             return std::string(self->return_type->name);
 		                             },
 		                             "argCount", [](const UR::Method* self) -> int
 		                             {
@@ -1581,25 +1588,25 @@ namespace LuaBindings
 		);
 
 		lua.new_usertype<UR::Class>("Class",
-		                            "name", &UR::Class::m_name,
-		                            "namespaze", &UR::Class::namespaze,
-		                            "parent", &UR::Class::parent,
-		                            "GetName", &UR::Class::m_name,
-		                            "GetNamespace", &UR::Class::namespaze,
-		                            "GetParent", &UR::Class::parent,
-		                            "GetFields", [](const UR::Class* klass) -> sol::as_table_t<std::vector<UR::Field*>>
+		                            "name", NameProperty<UR::Class, &UR::Class::m_name>(),
+		                            "namespaze", NameProperty<UR::Class, &UR::Class::namespaze>(),
+		                            "parent", NameProperty<UR::Class, &UR::Class::parent>(),
+		                            "GetName", NameProperty<UR::Class, &UR::Class::m_name>(),
+		                            "GetNamespace", NameProperty<UR::Class, &UR::Class::namespaze>(),
+		                            "GetParent", NameProperty<UR::Class, &UR::Class::parent>(),
+		                            "GetFields", [](UR::Class* klass) -> sol::as_table_t<std::vector<UR::Field*>>
 		                            {
 			                            if (!klass) return sol::as_table(std::vector<UR::Field*>{});
 			                            std::vector<UR::Field*> result;
-			                            for (auto& f : klass->fields) result.push_back(f.get());
+			                            for (auto& f : klass->GetFields()) result.push_back(f.get());
 			                            return sol::as_table(result);
 		                            },
 		                            "GetMethods",
-		                            [](const UR::Class* klass) -> sol::as_table_t<std::vector<UR::Method*>>
+		                            [](UR::Class* klass) -> sol::as_table_t<std::vector<UR::Method*>>
 		                            {
 			                            if (!klass) return sol::as_table(std::vector<UR::Method*>{});
 			                            std::vector<UR::Method*> result;
-			                            for (auto& m : klass->methods) result.push_back(m.get());
+			                            for (auto& m : klass->GetMethods()) result.push_back(m.get());
 			                            return sol::as_table(result);
 		                            },
 		                            "FindObjectsOfType",
@@ -1630,7 +1637,7 @@ namespace LuaBindings
 			                            auto* field = klass->Get<UR::Field>(fieldName);
 			                            if (!field) return sol::nil;
 
-			                            std::string typeName = field->type->name;
+			                            const std::string_view typeName = field->type->name;
 			                            if (typeName == "System.Single" || typeName == "float")
 				                            return sol::make_object(lua.lua_state(),
 				                                                    klass->GetValue<float>(obj, fieldName));
@@ -1671,7 +1678,7 @@ namespace LuaBindings
 			                            auto* field = klass->Get<UR::Field>(fieldName);
 			                            if (!field) return;
 
-			                            if (std::string typeName = field->type->name; typeName == "System.Single" ||
+			                            if (const std::string_view typeName = field->type->name; typeName == "System.Single" ||
 				                            typeName == "float")
 				                            klass->SetValue(obj, fieldName, value.as<float>());
 			                            else if (typeName == "System.Int32" || typeName == "int")
@@ -1696,7 +1703,7 @@ namespace LuaBindings
 			                            auto* method = klass->Get<UR::Method>(methodName);
 			                            if (!method) return sol::nil;
 
-			                            std::string retType = method->return_type->name;
+			                            const std::string_view retType = method->return_type->name;
 			                            auto result = method->RuntimeInvoke<void*>(obj);
 
 			                            if (retType == "System.Void" || retType == "void")
@@ -0,0 +1,275 @@
+#include "pch.h"
+#include "heap_snapshot.h"
+
+namespace
+{
+	constexpr size_t PAGE_WORDS = SnapshotSegment::PAGE_SIZE / sizeof(uint64_t);
+	constexpr uint16_t REPEAT_TOKEN = 0x8000;
+
+	// Tokens are a uint16 header (high bit set for a repeat, low bits the word count) followed by
+	// either one word to repeat or that many literal words. Heap pages are mostly zero runs.
+	size_t EncodePage(const uint8_t* page, uint8_t* out)
+	{
+		const auto* words = reinterpret_cast<const uint64_t*>(page);
+		size_t size = 0;
+		size_t i = 0;
+
+		while (i < PAGE_WORDS)
+		{
+			size_t run = 1;
+			while (i + run < PAGE_WORDS && words[i + run] == words[i])
+				run++;
+
+			if (run >= 2)
+			{
+				const auto header = static_cast<uint16_t>(REPEAT_TOKEN | run);
+				memcpy(out + size, &header, sizeof(header));
+				memcpy(out + size + sizeof(header), &words[i], sizeof(uint64_t));
+				size += sizeof(header) + sizeof(uint64_t);
+				i += run;
+				continue;
+			}
+
+			size_t literal = 1;
+			while (i + literal < PAGE_WORDS &&
+				!(i + literal + 1 < PAGE_WORDS && words[i + literal] == words[i + literal + 1]))
+				literal++;
+
+			// Not worth encoding; the caller stores the page as is
+			if (size + sizeof(uint16_t) + literal * sizeof(uint64_t) >= SnapshotSegment::PAGE_SIZE)
+				return SnapshotSegment::PAGE_SIZE;
+
+			const auto header = static_cast<uint16_t>(literal);
+			memcpy(out + size, &header, sizeof(header));
+			memcpy(out + size + sizeof(header), &words[i], literal * sizeof(uint64_t));
+			size += sizeof(header) + literal * sizeof(uint64_t);
+			i += literal;
+		}
+
+		if (size >= SnapshotSegment::PAGE_SIZE)
+			return SnapshotSegment::PAGE_SIZE;
+
+		return size;
+	}
+
+	void DecodePage(const uint8_t* data, const size_t encodedSize, uint8_t* page)
+	{
+		if (encodedSize == SnapshotSegment::PAGE_SIZE)
+		{
+			memcpy(page, data, SnapshotSegment::PAGE_SIZE);
+			return;
+		}
+
+		auto* words = reinterpret_cast<uint64_t*>(page);
+		size_t pos = 0;
+		size_t i = 0;
+		while (pos < encodedSize && i < PAGE_WORDS)
+		{
+			uint16_t header;
+			memcpy(&header, data + pos, sizeof(header));
+			pos += sizeof(header);
+
+			const size_t count = std::min<size_t>(header & ~REPEAT_TOKEN, PAGE_WORDS - i);
+			if (header & REPEAT_TOKEN)
+			{
+				uint64_t word;
+				memcpy(&word, data + pos, sizeof(word));
+				pos += sizeof(word);
+				std::fill_n(words + i, count, word);
+			}
+			else
+			{
+				memcpy(words + i, data + pos, count * sizeof(uint64_t));
+				pos += count * sizeof(uint64_t);
+			}
+			i += count;
+		}
+	}
+}
+
+SnapshotSegment::SnapshotSegment(std::atomic<size_t>& memoryUsed, const size_t memoryBudget)
+	: memoryUsed(memoryUsed), memoryBudget(memoryBudget)
+{
+}
+
+SnapshotSegment::~SnapshotSegment()
+{
+	memoryUsed.fetch_sub(memoryBytes, std::memory_order_relaxed);
+	if (spillView)
+		UnmapViewOfFile(spillView);
+	if (spillMapping)
+		CloseHandle(spillMapping);
+	if (spillFile != INVALID_HANDLE_VALUE)
+		CloseHandle(spillFile);
+}
+
+bool SnapshotSegment::ReadLive(const uint8_t* address, uint8_t* out)
+{
+	__try
+	{
+		memcpy(out, address, PAGE_SIZE);
+		return true;
+	}
+	__except (EXCEPTION_EXECUTE_HANDLER) { return false; }
+}
+
+void SnapshotSegment::AddPage(uint8_t* address, const uint8_t* page, const uint64_t* mask, const size_t maskWords,
+                              const uint32_t candidateCount)
+{
+	alignas(8) uint8_t encoded[PAGE_SIZE + MAX_MASK_WORDS * sizeof(uint64_t) + 16];
+	size_t size = EncodePage(page, encoded);
+	if (size == PAGE_SIZE)
+		memcpy(encoded, page, PAGE_SIZE);
+
+	Page entry;
+	entry.address = address;
+	entry.encodedSize = static_cast<uint32_t>(size);
+	entry.candidates = candidateCount;
+	entry.hasMask = mask != nullptr;
+	if (mask)
+	{
+		memcpy(encoded + size, mask, maskWords * sizeof(uint64_t));
+		size += maskWords * sizeof(uint64_t);
+	}
+
+	if (memoryUsed.fetch_add(size, std::memory_order_relaxed) + size <= memoryBudget)
+	{
+		entry.data = Store(encoded, size);
+		memoryBytes += size;
+	}
+	else
+	{
+		memoryUsed.fetch_sub(size, std::memory_order_relaxed);
+		if (!Spill(encoded, size, entry.fileOffset))
+			return;
+		entry.spilled = true;
+		spilledBytes += size;
+	}
+
+	candidates += candidateCount;
+	pages.push_back(entry);
+}
+
+const uint8_t* SnapshotSegment::Store(const uint8_t* bytes, const size_t size)
+{
+	if (arenaUsed + size > ARENA_BLOCK_SIZE)
+	{
+		arena.push_back(std::make_unique<uint8_t[]>(ARENA_BLOCK_SIZE));
+		arenaUsed = 0;
+	}
+
+	uint8_t* dest = arena.back().get() + arenaUsed;
+	memcpy(dest, bytes, size);
+	arenaUsed += size;
+	return dest;
+}
+
+bool SnapshotSegment::Spill(const uint8_t* bytes, const size_t size, uint64_t& fileOffset)
+{
+	if (spillFailed)
+		return false;
+
+	if (spillFile == INVALID_HANDLE_VALUE)
+	{
+		wchar_t tempDir[MAX_PATH];
+		wchar_t tempPath[MAX_PATH];
+		if (!GetTempPathW(MAX_PATH, tempDir) || !GetTempFileNameW(tempDir, L"uis", 0, tempPath))
+		{
+			spillFailed = true;
+			return false;
+		}
+
+		spillFile = CreateFileW(tempPath, GENERIC_READ | GENERIC_WRITE, 0, nullptr, CREATE_ALWAYS,
+		                        FILE_ATTRIBUTE_TEMPORARY | FILE_FLAG_DELETE_ON_CLOSE, nullptr);
+		if (spillFile == INVALID_HANDLE_VALUE)
+		{
+			spillFailed = true;
+			return false;
+		}
+		spillBuffer.reserve(SPILL_BUFFER_SIZE);
+	}
+
+	if (spillBuffer.size() + size > SPILL_BUFFER_SIZE && !FlushSpill())
+		return false;
+
+	fileOffset = spillSize;
+	spillBuffer.insert(spillBuffer.end(), bytes, bytes + size);
+	spillSize += size;
+	return true;
+}
+
+bool SnapshotSegment::FlushSpill()
+{
+	if (spillBuffer.empty())
+		return true;
+
+	DWORD written = 0;
+	const bool ok = WriteFile(spillFile, spillBuffer.data(), static_cast<DWORD>(spillBuffer.size()), &written, nullptr) &&
+		written == spillBuffer.size();
+	spillBuffer.clear();
+	if (!ok)
+		spillFailed = true;
+	return ok;
+}
+
+bool SnapshotSegment::Finish()
+{
+	// Without a file nothing was spilled, but pages may have been dropped when creating it failed
+	if (spillFile == INVALID_HANDLE_VALUE)
+		return !spillFailed;
+
+	bool ok = !spillFailed && FlushSpill();
+	std::vector<uint8_t>().swap(spillBuffer);
+
+	if (ok)
+		spillMapping = CreateFileMappingW(spillFile, nullptr, PAGE_READONLY, 0, 0, nullptr);
+	if (spillMapping)
+		spillView = static_cast<const uint8_t*>(MapViewOfFile(spillMapping, FILE_MAP_READ, 0, 0, 0));
+	ok = spillView != nullptr;
+
+	for (auto& page : pages)
+	{
+		if (page.spilled)
+			page.data = ok ? spillView + page.fileOffset : nullptr;
+	}
+
+	// Without the mapping the spilled pages are unreadable, so they stop being candidates
+	if (!ok)
+	{
+		std::erase_if(pages, [this](const Page& page)
+		{
+			if (!page.spilled)
+				return false;
+			candidates -= page.candidates;
+			return true;
+		});
+		spilledBytes = 0;
+	}
+	return ok;
+}
+
+void SnapshotSegment::ReadPage(const Page& page, uint8_t* out, uint64_t* mask, const size_t maskWords) const
+{
+	DecodePage(page.data, page.encodedSize, out);
+	if (page.hasMask)
+		memcpy(mask, page.data + page.encodedSize, maskWords * sizeof(uint64_t));
+	else
+		std::fill_n(mask, maskWords, ~0ull);
+}
+
+bool HeapSnapshot::Finish()
+{
+	bool ok = true;
+	candidates = 0;
+	memoryBytes = 0;
+	spilledBytes = 0;
+	for (const auto& segment : segments)
+	{
+		if (!segment->Finish())
+			ok = false;
+		candidates += segment->Candidates();
+		memoryBytes += segment->MemoryBytes();
+		spilledBytes += segment->SpilledBytes();
+	}
+	return ok;
+}
@@ -0,0 +1,84 @@
+#pragma once
+#include "memory_scanner.h"
+
+// Compressed copy of scanned memory pages for unknown-initial-value scans. Pages are stored as
+// run-length encoded 8-byte words followed by an optional survivor mask. Each scan worker owns a
+// segment, and a segment spills to a memory-mapped temp file once the shared budget is used up.
+class SnapshotSegment
+{
+public:
+	static constexpr size_t PAGE_SIZE = 4096;
+	static constexpr size_t MAX_MASK_WORDS = PAGE_SIZE / 4 / 64;
+
+	struct Page
+	{
+		uint8_t* address = nullptr; // live address the page was copied from
+		const uint8_t* data = nullptr; // encoded page, then mask words if hasMask
+		uint64_t fileOffset = 0;
+		uint32_t encodedSize = 0;
+		uint32_t candidates = 0;
+		bool spilled = false;
+		bool hasMask = false; // without a mask every element of the page is a candidate
+	};
+
+	SnapshotSegment(std::atomic<size_t>& memoryUsed, size_t memoryBudget);
+	~SnapshotSegment();
+
+	SnapshotSegment(const SnapshotSegment&) = delete;
+	SnapshotSegment& operator=(const SnapshotSegment&) = delete;
+
+	// `mask` may be null when every element survives
+	void AddPage(uint8_t* address, const uint8_t* page, const uint64_t* mask, size_t maskWords, uint32_t candidates);
+	bool Finish();
+
+	void ReadPage(const Page& page, uint8_t* out, uint64_t* mask, size_t maskWords) const;
+	const std::vector<Page>& Pages() const { return pages; }
+
+	uint64_t Candidates() const { return candidates; }
+	size_t MemoryBytes() const { return memoryBytes; }
+	size_t SpilledBytes() const { return spilledBytes; }
+
+	// Copies a live page, returning false if it is no longer readable
+	static bool ReadLive(const uint8_t* address, uint8_t* out);
+
+private:
+	static constexpr size_t ARENA_BLOCK_SIZE = 1 << 20;
+	static constexpr size_t SPILL_BUFFER_SIZE = 1 << 20;
+
+	const uint8_t* Store(const uint8_t* bytes, size_t size);
+	bool Spill(const uint8_t* bytes, size_t size, uint64_t& fileOffset);
+	bool FlushSpill();
+
+	std::atomic<size_t>& memoryUsed;
+	size_t memoryBudget;
+
+	std::vector<Page> pages;
+	std::vector<std::unique_ptr<uint8_t[]>> arena;
+	size_t arenaUsed = ARENA_BLOCK_SIZE;
+
+	HANDLE spillFile = INVALID_HANDLE_VALUE;
+	HANDLE spillMapping = nullptr;
+	const uint8_t* spillView = nullptr;
+	std::vector<uint8_t> spillBuffer;
+	uint64_t spillSize = 0;
+	bool spillFailed = false; // the spill file could not be created or a flush was lost
+
+	uint64_t candidates = 0;
+	size_t memoryBytes = 0;
+	size_t spilledBytes = 0;
+};
+
+struct HeapSnapshot
+{
+	ScanValueType type = ScanValueType::Int;
+	std::atomic<size_t> memoryUsed{0};
+	std::vector<std::unique_ptr<SnapshotSegment>> segments;
+
+	uint64_t candidates = 0;
+	size_t memoryBytes = 0;
+	size_t spilledBytes = 0;
+
+	size_t ElementSize() const { return type == ScanValueType::Long || type == ScanValueType::Double ? 8 : 4; }
+	// Returns false if any segment lost its spilled pages
+	bool Finish();
+};
@@ -1,5 +1,7 @@
 #include "pch.h"
 #include "memory_scanner.h"
+#include "scan_kernels.h"
+#include "heap_snapshot.h"
 #include "features/inspector/inspector.h"
 #include "helper/helper.h"
 
@@ -7,29 +9,97 @@ REGISTER_FEATURE(MemoryScanner)
 
 namespace
 {
-	template <typename T>
-	bool SafeRead(void* ptr, int offset, T& outValue)
+	// Reads a block of instance fields under a single SEH frame, normalizing each value the same
+	// way ReadInstanceFieldValue does. Returns false if anything in the block faulted.
+	bool GatherInstanceBlock(void* const* objects, const int32_t* offsets, const ActualFieldType* types,
+	                         const uint8_t* flags, ScanField::ValUnion* out, size_t count, uint64_t& valid)
 	{
-		if (!ptr || offset < 0) return false;
 		__try
 		{
-			outValue = *reinterpret_cast<T*>(reinterpret_cast<uintptr_t>(ptr) + offset);
+			for (size_t i = 0; i < count; i++)
+			{
+				out[i].u64 = 0;
+				if ((flags[i] & ScanResultStore::Static) || !objects[i] || offsets[i] < 0)
+					continue;
+
+				out[i] = ScanKernels::DecodeField(static_cast<const uint8_t*>(objects[i]) + offsets[i], types[i]);
+				valid |= 1ull << i;
+			}
 			return true;
 		}
 		__except (EXCEPTION_EXECUTE_HANDLER) { return false; }
 	}
 
-	bool SafeReadBool(void* ptr, int offset, bool& outValue)
+	// Runs the region kernel over one chunk; a region released mid-scan just ends that chunk early
+	bool ScanHeapChunk(const uint8_t* base, size_t size, ScanValueType type, const ScanField::ValUnion& target,
+	                   std::vector<uint32_t>& offsets)
+	{
+		__try
+		{
+			ScanKernels::FindEqual(type, base, size, target, offsets);
+			return true;
+		}
+		__except (EXCEPTION_EXECUTE_HANDLER) { return false; }
+	}
+
+	bool SafeReadWord(const void* address, void*& outValue)
 	{
-		if (!ptr || offset < 0) return false;
 		__try
 		{
-			outValue = *reinterpret_cast<bool*>(reinterpret_cast<uintptr_t>(ptr) + offset);
+			outValue = *static_cast<void* const*>(address);
 			return true;
 		}
 		__except (EXCEPTION_EXECUTE_HANDLER) { return false; }
 	}
 
+	bool LooksLikePointer(const void* ptr)
+	{
+		const auto value = reinterpret_cast<uintptr_t>(ptr);
+		return value >= 0x10000 && value < 0x7FFFFFFFFFFF && (value & (sizeof(void*) - 1)) == 0;
+	}
+
+	// Walks back from a heap hit to the nearest object header whose class is in the metadata index.
+	// Il2Cpp objects start with their class pointer, Mono objects with a vtable whose first member is the class.
+	uint8_t* FindOwningObject(uint8_t* address, size_t maxBack, void*& klass)
+	{
+		const bool mono = Config::state.unityMode == UnityResolve::Mode::Mono;
+		constexpr uintptr_t headerSize = 2 * sizeof(void*);
+		const auto hit = reinterpret_cast<uintptr_t>(address);
+		if (hit < headerSize)
+			return nullptr;
+
+		// Copy the whole window below the hit at once; if it reaches into an unreadable page,
+		// settle for the part on the hit's own page
+		constexpr size_t windowWords = 513;
+		void* window[windowWords];
+		const uintptr_t top = (hit - headerSize) & ~(sizeof(void*) - 1);
+		uintptr_t bottom = top - std::min<uintptr_t>(top, std::min(maxBack, (windowWords - 1) * sizeof(void*)));
+		if (!Helper::SafeReadSpan(reinterpret_cast<void*>(bottom), 0, top - bottom + sizeof(void*), window))
+		{
+			bottom = std::max(bottom, top & ~uintptr_t{0xFFF});
+			if (!Helper::SafeReadSpan(reinterpret_cast<void*>(bottom), 0, top - bottom + sizeof(void*), window))
+				return nullptr;
+		}
+
+		for (uintptr_t cursor = top; cursor >= bottom && cursor > 0; cursor -= sizeof(void*))
+		{
+			void* header = window[(cursor - bottom) / sizeof(void*)];
+			if (!LooksLikePointer(header))
+				continue;
+
+			void* candidate = header;
+			if (mono && (!SafeReadWord(header, candidate) || !LooksLikePointer(candidate)))
+				continue;
+
+			if (UR::GetClassByHandle(candidate))
+			{
+				klass = candidate;
+				return reinterpret_cast<uint8_t*>(cursor);
+			}
+		}
+		return nullptr;
+	}
+
 	template <typename T>
 	bool SafeWrite(void* ptr, int offset, const T& value)
 	{
@@ -43,6 +113,125 @@ namespace
 	}
 }
 
+size_t ScanResultStore::MemoryBytes() const
+{
+	return objects.capacity() * sizeof(void*) + fieldHandles.capacity() * sizeof(void*) +
+		classHandles.capacity() * sizeof(void*) + offsets.capacity() * sizeof(int32_t) +
+		types.capacity() * sizeof(ActualFieldType) + flags.capacity() * sizeof(uint8_t) +
+		lastValues.capacity() * sizeof(ScanField::ValUnion) + prevValues.capacity() * sizeof(ScanField::ValUnion) +
+		(classNameIds.capacity() + namespaceIds.capacity() + fieldNameIds.capacity() + objectNameIds.capacity()) *
+		sizeof(uint32_t);
+}
+
+void ScanResultStore::Reserve(const size_t count)
+{
+	objects.reserve(count);
+	fieldHandles.reserve(count);
+	classHandles.reserve(count);
+	offsets.reserve(count);
+	types.reserve(count);
+	flags.reserve(count);
+	lastValues.reserve(count);
+	prevValues.reserve(count);
+	classNameIds.reserve(count);
+	namespaceIds.reserve(count);
+	fieldNameIds.reserve(count);
+	objectNameIds.reserve(count);
+}
+
+void ScanResultStore::Push(const ScanField& row)
+{
+	objects.push_back(row.object);
+	fieldHandles.push_back(row.fieldHandle);
+	classHandles.push_back(row.classHandle);
+	offsets.push_back(row.offset);
+	types.push_back(row.actualType);
+	flags.push_back(static_cast<uint8_t>((row.isStatic ? Static : 0) | (row.hasPrevValue ? HasPrevValue : 0)));
+	lastValues.push_back(row.lastValue);
+	prevValues.push_back(row.prevValue);
+	classNameIds.push_back(row.classNameId);
+	namespaceIds.push_back(row.namespaceId);
+	fieldNameIds.push_back(row.fieldNameId);
+	objectNameIds.push_back(row.objectNameId);
+}
+
+void ScanResultStore::Append(const ScanResultStore& other, const size_t index)
+{
+	objects.push_back(other.objects[index]);
+	fieldHandles.push_back(other.fieldHandles[index]);
+	classHandles.push_back(other.classHandles[index]);
+	offsets.push_back(other.offsets[index]);
+	types.push_back(other.types[index]);
+	flags.push_back(other.flags[index]);
+	lastValues.push_back(other.lastValues[index]);
+	prevValues.push_back(other.prevValues[index]);
+	classNameIds.push_back(other.classNameIds[index]);
+	namespaceIds.push_back(other.namespaceIds[index]);
+	fieldNameIds.push_back(other.fieldNameIds[index]);
+	objectNameIds.push_back(other.objectNameIds[index]);
+}
+
+ScanField ScanResultStore::Row(const size_t index) const
+{
+	ScanField row;
+	row.object = objects[index];
+	row.fieldHandle = fieldHandles[index];
+	row.classHandle = classHandles[index];
+	row.offset = offsets[index];
+	row.actualType = types[index];
+	row.isStatic = (flags[index] & Static) != 0;
+	row.hasPrevValue = (flags[index] & HasPrevValue) != 0;
+	row.lastValue = lastValues[index];
+	row.prevValue = prevValues[index];
+	row.classNameId = classNameIds[index];
+	row.namespaceId = namespaceIds[index];
+	row.fieldNameId = fieldNameIds[index];
+	row.objectNameId = objectNameIds[index];
+	return row;
+}
+
+void ScanResultStore::Compact(const std::vector<uint64_t>& keepMask, const std::vector<ScanField::ValUnion>& values)
+{
+	size_t write = 0;
+	for (size_t read = 0; read < Size(); read++)
+	{
+		if (!(keepMask[read >> 6] >> (read & 63) & 1))
+			continue;
+
+		objects[write] = objects[read];
+		fieldHandles[write] = fieldHandles[read];
+		classHandles[write] = classHandles[read];
+		offsets[write] = offsets[read];
+		types[write] = types[read];
+		flags[write] = static_cast<uint8_t>(flags[read] | HasPrevValue);
+		prevValues[write] = lastValues[read];
+		lastValues[write] = values[read];
+		classNameIds[write] = classNameIds[read];
+		namespaceIds[write] = namespaceIds[read];
+		fieldNameIds[write] = fieldNameIds[read];
+		objectNameIds[write] = objectNameIds[read];
+		write++;
+	}
+
+	objects.resize(write);
+	fieldHandles.resize(write);
+	classHandles.resize(write);
+	offsets.resize(write);
+	types.resize(write);
+	flags.resize(write);
+	lastValues.resize(write);
+	prevValues.resize(write);
+	classNameIds.resize(write);
+	namespaceIds.resize(write);
+	fieldNameIds.resize(write);
+	objectNameIds.resize(write);
+}
+
+void ScanResultStore::Clear()
+{
+	*this = ScanResultStore();
+}
+
 MemoryScanner::~MemoryScanner()
 {
 	stopRequested = true;
@@ -52,7 +241,15 @@ MemoryScanner::~MemoryScanner()
 
 void MemoryScanner::Update(float deltaTime)
 {
-	(void)deltaTime;
+	std::vector<ScanField> resolvedPaths;
+	{
+		std::scoped_lock lock(resultsMutex);
+		resolvedPaths.swap(resolvedPathWatches);
+	}
+	for (const ScanField& result : resolvedPaths)
+		AddWatch(result, false);
+
+	UpdateWatches(deltaTime);
 
 	if (pendingOperation != ScanOperation::None && !scanInProgress)
 	{
@@ -72,10 +269,28 @@ void MemoryScanner::Update(float deltaTime)
 			const ScanOperation op = pendingOperation;
 			pendingOperation = ScanOperation::None;
 
-			if (op == ScanOperation::FirstScan)
+			if ((op == ScanOperation::FirstScan && !rawHeapScan) || op == ScanOperation::PointerScan)
 			{
 				statusText = "Gathering Unity objects...";
-				objectsGathered = GatherUnityObjects();
+				UpdateObjectRegistry();
+			}
+			else if (op == ScanOperation::WatchPaths)
+			{
+				// Paths without a live root object are looked up by name among the gathered objects
+				std::unique_lock lock(resultsMutex);
+				const size_t end = std::min(watchPathsEnd, pointerPaths.size());
+				const bool needsObjects = watchPathsBegin < end &&
+					std::any_of(pointerPaths.begin() + watchPathsBegin, pointerPaths.begin() + end,
+					            [](const PointerPath& path)
+					            {
+						            return path.rootKind == PointerRootKind::UnityObject && !PointerRootAlive(path);
+					            });
+				lock.unlock();
+				if (needsObjects)
+				{
+					statusText = "Gathering Unity objects...";
+					UpdateObjectRegistry();
+				}
 			}
 
 			scanThread = std::thread([this, op]
@@ -92,6 +307,14 @@ void MemoryScanner::Update(float deltaTime)
 					{
 						PerformNextScan();
 					}
+					else if (op == ScanOperation::PointerScan)
+					{
+						FindPointerPaths();
+					}
+					else if (op == ScanOperation::WatchPaths)
+					{
+						WatchPointerPaths();
+					}
 				}
 				catch (const std::exception& e)
 				{
@@ -169,7 +392,17 @@ void MemoryScanner::Render()
 			ImGui::Spacing();
 
 			ImGui::Checkbox("Include System/Unity Classes", &includeSystemNamespaces);
+			if (locked) ImGui::BeginDisabled();
+			ImGui::Checkbox("Raw Heap Regions", &rawHeapScan);
+			if (locked) ImGui::EndDisabled();
+			if (ImGui::IsItemHovered(ImGuiHoveredFlags_AllowWhenDisabled))
+				ImGui::SetTooltip("Scan all committed private memory instead of walking fields.\nHits are mapped back to a managed object and field where possible.");
 			ImGui::Checkbox("Console Debug Logging", &debugLogging);
+			if (ImGui::SmallButton("Load Pointer Paths") && !scanInProgress)
+			{
+				if (!LoadPointerPaths())
+					statusText = "No saved pointer paths to load";
+			}
 
 			ImGui::Spacing();
 
@@ -207,7 +440,16 @@ void MemoryScanner::Render()
 		ImGui::Spacing();
 
 		std::unique_lock resultsLock(resultsMutex);
-		ImGui::TextDisabled("Matches Found: %zu / %zu", currentResults.size(), MAX_RESULTS);
+		ImGui::TextDisabled("Matches Found: %zu / %zu (%.1f MB)", currentResults.Size(), MAX_RESULTS,
+		                    static_cast<double>(currentResults.MemoryBytes()) / (1024.0 * 1024.0));
+		const bool hasPointerPaths = !pointerPaths.empty();
+		if (snapshot)
+		{
+			ImGui::SameLine();
+			ImGui::TextDisabled("|  Snapshot: %llu candidates (%.1f MB in memory, %.1f MB spilled)", snapshot->candidates,
+			                    static_cast<double>(snapshot->memoryBytes) / (1024.0 * 1024.0),
+			                    static_cast<double>(snapshot->spilledBytes) / (1024.0 * 1024.0));
+		}
 		resultsLock.unlock();
 
 		if (!statusText.empty() && !scanInProgress)
@@ -223,7 +465,7 @@ void MemoryScanner::Render()
 
 		if (ImGui::BeginTable("Results", 7,
 		                      ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_ScrollY |
-		                      ImGuiTableFlags_Sortable, ImVec2(0, -120)))
+		                      ImGuiTableFlags_Sortable, ImVec2(0, -120.0f - (watches.empty() ? 0.0f : 220.0f) - (hasPointerPaths ? 150.0f : 0.0f))))
 		{
 			ImGui::TableSetupColumn("Live Value", ImGuiTableColumnFlags_WidthStretch, 0.15f);
 			ImGui::TableSetupColumn("Previous", ImGuiTableColumnFlags_WidthStretch, 0.12f);
@@ -237,129 +479,150 @@ void MemoryScanner::Render()
 			std::string filterLower = resultFilterBuffer;
 			std::ranges::transform(filterLower, filterLower.begin(), tolower);
 
-			for (size_t i = 0; i < currentResults.size(); ++i)
-			{
-				const auto& result = currentResults[i];
+			resultsLock.lock();
+			UpdateFilteredRows(filterLower);
 
-				char liveValueBytes[sizeof(double)] = {};
-				bool readSuccess = ReadFieldValue(result, liveValueBytes);
-				std::string liveValStr = "??";
-				bool isChanged = false;
-				if (readSuccess)
-				{
-					ScanField::ValUnion liveUnion;
-					memcpy(&liveUnion, liveValueBytes, sizeof(double));
-					liveValStr = FormatValue(liveUnion, result.actualType);
-					isChanged = (CompareValueWithPrevious(liveValueBytes, result) != 0);
-				}
+			const bool filtered = !filterLower.empty();
+			const size_t rowCount = filtered ? filteredRows.size() : currentResults.Size();
 
-				if (!filterLower.empty())
+			ImGuiListClipper clipper;
+			clipper.Begin(static_cast<int>(rowCount));
+			while (clipper.Step())
+			{
+				for (int row = clipper.DisplayStart; row < clipper.DisplayEnd; ++row)
 				{
-					if (!Helper::CaseInsensitiveFind(result.className, filterLower) &&
-						!Helper::CaseInsensitiveFind(result.namespaze, filterLower) &&
-						!Helper::CaseInsensitiveFind(result.fieldName, filterLower) &&
-						!Helper::CaseInsensitiveFind(result.objectName, filterLower) &&
-						!Helper::CaseInsensitiveFind(liveValStr, filterLower))
+					const size_t i = filtered ? filteredRows[row] : static_cast<size_t>(row);
+					const ScanField result = currentResults.Row(i);
+
+					char liveValueBytes[sizeof(double)] = {};
+					bool readSuccess = ReadFieldValue(result, liveValueBytes);
+					std::string liveValStr = "??";
+					bool isChanged = false;
+					if (readSuccess)
 					{
-						continue;
+						ScanField::ValUnion liveUnion;
+						memcpy(&liveUnion, liveValueBytes, sizeof(double));
+						liveValStr = FormatValue(liveUnion, result.actualType);
+						isChanged = (CompareValueWithPrevious(liveValueBytes, result) != 0);
 					}
-				}
 
-				ImGui::TableNextRow();
-				ImGui::PushID(static_cast<int>(i));
+					ImGui::TableNextRow();
+					ImGui::PushID(static_cast<int>(i));
 
-				ImGui::TableNextColumn();
-				bool isSelected = (selectedResultIndex == static_cast<int>(i));
+					ImGui::TableNextColumn();
+					bool isSelected = (selectedResultIndex == static_cast<int>(i));
 
-				if (isChanged)
-				{
-					ImGui::PushStyleColor(ImGuiCol_Text, ImVec4(1.0f, 0.3f, 0.3f, 1.0f));
-				}
-				if (ImGui::Selectable(liveValStr.c_str(), isSelected, ImGuiSelectableFlags_SpanAllColumns))
-				{
-					selectedResultIndex = static_cast<int>(i);
-					if (readSuccess)
+					if (isChanged)
 					{
-						memcpy(&editValue, liveValueBytes, sizeof(double));
+						ImGui::PushStyleColor(ImGuiCol_Text, ImVec4(1.0f, 0.3f, 0.3f, 1.0f));
 					}
-					else
+					if (ImGui::Selectable(liveValStr.c_str(), isSelected, ImGuiSelectableFlags_SpanAllColumns))
+					{
+						selectedResultIndex = static_cast<int>(i);
+						if (readSuccess)
+						{
+							memcpy(&editValue, liveValueBytes, sizeof(double));
+						}
+						else
+						{
+							memset(&editValue, 0, sizeof(double));
+						}
+					}
+					if (isChanged)
 					{
-						memset(&editValue, 0, sizeof(double));
+						ImGui::PopStyleColor();
 					}
-				}
-				if (isChanged)
-				{
-					ImGui::PopStyleColor();
-				}
-
-				if (ImGui::IsItemHovered() && ImGui::IsMouseDoubleClicked(ImGuiMouseButton_Left))
-				{
-					OpenResultInInspector(result);
-				}
 
-				std::string popupName = "ResultContext_" + std::to_string(i);
-				if (ImGui::IsItemClicked(ImGuiMouseButton_Right))
-				{
-					ImGui::OpenPopup(popupName.c_str());
-				}
-				if (ImGui::BeginPopup(popupName.c_str()))
-				{
-					if (ImGui::MenuItem("Inspect in Hierarchy"))
+					if (ImGui::IsItemHovered() && ImGui::IsMouseDoubleClicked(ImGuiMouseButton_Left))
 					{
 						OpenResultInInspector(result);
 					}
-					if (ImGui::MenuItem("Copy Address"))
+
+					std::string popupName = "ResultContext_" + std::to_string(i);
+					if (ImGui::IsItemClicked(ImGuiMouseButton_Right))
 					{
-						char addrStr[32];
-						snprintf(addrStr, sizeof(addrStr), "%p", result.object);
-						ImGui::SetClipboardText(addrStr);
+						ImGui::OpenPopup(popupName.c_str());
+					}
+					if (ImGui::BeginPopup(popupName.c_str()))
+					{
+						if (ImGui::MenuItem("Inspect in Hierarchy"))
+						{
+							OpenResultInInspector(result);
+						}
+						if (ImGui::MenuItem("Find Pointer Paths", nullptr, false, !result.isStatic && !scanInProgress))
+						{
+							pointerTarget = result;
+							pendingOperation = ScanOperation::PointerScan;
+						}
+						if (ImGui::MenuItem("Add to Watch List"))
+						{
+							AddWatch(result, false);
+						}
+						if (ImGui::MenuItem("Freeze Value"))
+						{
+							AddWatch(result, true);
+						}
+						if (ImGui::MenuItem("Copy Address"))
+						{
+							char addrStr[32];
+							snprintf(addrStr, sizeof(addrStr), "%p", result.object);
+							ImGui::SetClipboardText(addrStr);
+						}
+						ImGui::EndPopup();
 					}
-					ImGui::EndPopup();
-				}
 
-				ImGui::TableNextColumn();
-				if (result.hasPrevValue)
-				{
-					ImGui::Text("%s", FormatValue(result.prevValue, result.actualType).c_str());
-				}
-				else
-				{
-					ImGui::TextDisabled("-");
-				}
+					const std::string_view className = ResultName(result.classNameId);
+					const std::string_view namespaze = ResultName(result.namespaceId);
+					const std::string_view fieldName = ResultName(result.fieldNameId);
+
+					ImGui::TableNextColumn();
+					if (result.hasPrevValue)
+					{
+						ImGui::Text("%s", FormatValue(result.prevValue, result.actualType).c_str());
+					}
+					else
+					{
+						ImGui::TextDisabled("-");
+					}
 
-				ImGui::TableNextColumn();
-				ImGui::Text("%s", GetActualFieldTypeName(result.actualType));
+					ImGui::TableNextColumn();
+					ImGui::Text("%s", GetActualFieldTypeName(result.actualType));
 
-				ImGui::TableNextColumn();
-				ImGui::Text("%s", result.className.c_str());
+					ImGui::TableNextColumn();
+					ImGui::TextUnformatted(className.data(), className.data() + className.size());
 
-				ImGui::TableNextColumn();
-				ImGui::Text("%s", result.namespaze.c_str());
+					ImGui::TableNextColumn();
+					ImGui::TextUnformatted(namespaze.data(), namespaze.data() + namespaze.size());
 
-				ImGui::TableNextColumn();
-				ImGui::Text("%s", result.fieldName.c_str());
+					ImGui::TableNextColumn();
+					ImGui::TextUnformatted(fieldName.data(), fieldName.data() + fieldName.size());
 
-				ImGui::TableNextColumn();
-				if (result.isStatic)
-					ImGui::TextDisabled("(static)");
-				else
-					ImGui::Text("%s (%p)", result.objectName.c_str(), result.object);
+					ImGui::TableNextColumn();
+					if (result.isStatic)
+						ImGui::TextDisabled("(static)");
+					else
+						ImGui::Text("%s (%p)", ResultName(result.objectNameId).data(), result.object);
 
-				ImGui::PopID();
+					ImGui::PopID();
+				}
 			}
+			resultsLock.unlock();
 
 			ImGui::EndTable();
 		}
 
-		if (selectedResultIndex >= 0 && selectedResultIndex < static_cast<int>(currentResults.size()))
+		resultsLock.lock();
+		if (selectedResultIndex >= 0 && selectedResultIndex < static_cast<int>(currentResults.Size()))
 		{
 			ImGui::Separator();
-			auto& result = currentResults[selectedResultIndex];
-			ImGui::Text("Selected: %s::%s (%s)", result.className.c_str(), result.fieldName.c_str(), GetActualFieldTypeName(result.actualType));
+			const ScanField result = currentResults.Row(selectedResultIndex);
+			ImGui::Text("Selected: %s::%s (%s)", ResultName(result.classNameId).data(), ResultName(result.fieldNameId).data(),
+			            GetActualFieldTypeName(result.actualType));
 			if (result.isStatic)
 				ImGui::TextDisabled("Location: Static Field");
 			else
-				ImGui::TextDisabled("Location: Object %s (%p), Offset: 0x%X", result.objectName.c_str(), result.object, result.offset);
+				ImGui::TextDisabled("Location: Object %s (%p), Offset: 0x%X", ResultName(result.objectNameId).data(),
+				                    result.object, result.offset);
 
 			ImGui::SetNextItemWidth(300.0f);
 			
@@ -388,10 +651,22 @@ void MemoryScanner::Render()
 			ImGui::SameLine();
 			if (ImGui::Button("Write Value", ImVec2(100, 0)) || valueChanged)
 			{
-				if (WriteFieldValue(result, &editValue))
-					memcpy(&currentResults[selectedResultIndex].lastValue, &editValue, sizeof(double));
+				// A running next scan reads the store unlocked and refreshes every kept row's value when it
+				// compacts, so the field is written but the stored value is left to it
+				if (WriteFieldValue(result, &editValue) && !scanInProgress)
+					memcpy(&currentResults.lastValues[selectedResultIndex], &editValue, sizeof(double));
 			}
+			ImGui::SameLine();
+			if (ImGui::Button("Watch", ImVec2(80, 0)))
+				AddWatch(result, false);
+			ImGui::SameLine();
+			if (ImGui::Button("Freeze", ImVec2(80, 0)))
+				AddWatch(result, true);
 		}
+		resultsLock.unlock();
+
+		RenderWatchList();
+		RenderPointerPaths();
 	}
 	ImGui::End();
 }
@@ -475,7 +750,7 @@ void MemoryScanner::SyncValueToBuffer()
 
 void MemoryScanner::PerformFirstScan()
 {
-	std::vector<ScanField> tempResults;
+	ScanResultStore tempResults;
 
 	if (comparison == ScanComparison::Exact)
 	{
@@ -513,27 +788,54 @@ void MemoryScanner::PerformFirstScan()
 		}
 	}
 
+	if (rawHeapScan && selectedType == ScanValueType::Bool)
+	{
+		statusText = "Raw heap scan needs an Int, Long, Float or Double value";
+		scanInProgress = false;
+		return;
+	}
+
 	if (debugLogging)
 		printf("[MemoryScanner] First scan: %s = %s\n", GetValueTypeName(selectedType), m_valueBuffer);
 
-	statusText = "Scanning static fields...";
-	ScanStaticFields(tempResults);
-	if (debugLogging)
-		printf("[MemoryScanner] Static matches: %zu\n", tempResults.size());
+	if (rawHeapScan && comparison != ScanComparison::Exact)
+	{
+		// Unknown initial value: keep a copy of the heap and let next scans narrow it down
+		CaptureHeapSnapshot();
+		scanInProgress = false;
+		selectedResultIndex = -1;
+		return;
+	}
 
-	if (!stopRequested && tempResults.size() < MAX_RESULTS)
+	if (rawHeapScan)
+	{
+		scanMatchCount = 0;
+		statusText = "Scanning heap regions...";
+		ScanHeapRegions(tempResults);
+	}
+	else
 	{
-		statusText = "Scanning objects...";
-		ScanUnityObjectFields(tempResults);
+		statusText = "Scanning static fields...";
+		ScanStaticFields(tempResults);
+		scanMatchCount = tempResults.Size();
+		if (debugLogging)
+			printf("[MemoryScanner] Static matches: %zu\n", tempResults.Size());
+
+		if (!stopRequested && tempResults.Size() < MAX_RESULTS)
+		{
+			statusText = "Scanning objects...";
+			ScanUnityObjectFields(tempResults);
+		}
 	}
 
 	if (!stopRequested)
 	{
 		std::scoped_lock lock(resultsMutex);
 		currentResults = std::move(tempResults);
-		statusText = "Scan complete. " + std::to_string(currentResults.size()) + " matches.";
+		resultsGeneration++;
+		statusText = "Scan complete. " + std::to_string(currentResults.Size()) + " matches.";
 		if (debugLogging)
-			printf("[MemoryScanner] Total matches: %zu\n", currentResults.size());
+			printf("[MemoryScanner] Total matches: %zu (%zu name bytes)\n", currentResults.Size(), namePool->Bytes());
 		hasDoneFirstScan = true;
 	}
 	scanInProgress = false;
@@ -542,80 +844,153 @@ void MemoryScanner::PerformFirstScan()
 
 void MemoryScanner::PerformNextScan()
 {
-	std::vector<ScanField> localResults;
+	if (snapshot)
+	{
+		PerformSnapshotScan();
+		return;
+	}
+
+	// Nothing else writes the store while a scan is in progress (Render's value write skips it), so
+	// the filter pass reads it unlocked; the lock is held just for the in-place compaction so Render
+	// never sees a half-moved column.
+	size_t count;
 	{
 		std::scoped_lock lock(resultsMutex);
-		localResults = currentResults;
+		count = currentResults.Size();
 	}
 
-	std::vector<ScanField> newResults;
-	newResults.reserve(localResults.size());
+	constexpr size_t block = ScanKernels::BLOCK_SIZE;
+	std::vector<uint64_t> keepMask((count + block - 1) / block, 0);
+	std::vector<ScanField::ValUnion> values(count);
+	const ScanField::ValUnion target = GetComparisonTarget();
+	const ActualFieldType* types = currentResults.types.data();
+	const ScanField::ValUnion* lastValues = currentResults.lastValues.data();
+	size_t matches = 0;
 
-	for (auto& field : localResults)
+	for (size_t begin = 0; begin < count; begin += block)
 	{
 		if (stopRequested)
 			break;
 
-		char currentValue[sizeof(double)] = {};
-		if (!ReadFieldValue(field, currentValue))
-			continue;
-
-		bool match = false;
+		const size_t n = std::min(block, count - begin);
+		const uint64_t valid = GatherValues(begin, n, values.data() + begin);
 
-		switch (comparison)
+		// Results are grouped by type more often than not, so compare runs of the same lane at once
+		uint64_t keep = 0;
+		for (size_t run = 0; run < n;)
 		{
-		case ScanComparison::Exact:
-			match = CompareValueWithTarget(currentValue, field.actualType);
-			break;
-		case ScanComparison::Increased:
-			match = CompareValueWithPrevious(currentValue, field) > 0;
-			break;
-		case ScanComparison::Decreased:
-			match = CompareValueWithPrevious(currentValue, field) < 0;
-			break;
-		case ScanComparison::Changed:
-			match = CompareValueWithPrevious(currentValue, field) != 0;
-			break;
-		case ScanComparison::Unchanged:
-			match = CompareValueWithPrevious(currentValue, field) == 0;
-			break;
+			const ScanKernels::Lane lane = ScanKernels::LaneFor(types[begin + run]);
+			size_t runEnd = run + 1;
+			while (runEnd < n && ScanKernels::LaneFor(types[begin + runEnd]) == lane)
+				runEnd++;
+
+			keep |= ScanKernels::CompareBlock(lane, comparison, values.data() + begin + run, lastValues + begin + run,
+			                                  target, runEnd - run) << run;
+			run = runEnd;
 		}
 
-		if (match)
-		{
-			ScanField updated = field;
-			updated.prevValue = field.lastValue;
-			updated.hasPrevValue = true;
-			memcpy(&updated.lastValue, currentValue, sizeof(double));
-			newResults.push_back(updated);
-		}
+		keepMask[begin / block] = keep & valid;
+		matches += std::popcount(keep & valid);
 	}
 
 	if (!stopRequested)
 	{
 		std::scoped_lock lock(resultsMutex);
-		currentResults = std::move(newResults);
-		statusText = "Next scan complete. " + std::to_string(currentResults.size()) + " matches.";
+		currentResults.Compact(keepMask, values);
+		resultsGeneration++;
+		statusText = "Next scan complete. " + std::to_string(currentResults.Size()) + " matches.";
+		if (debugLogging)
+			printf("[MemoryScanner] Next scan kept %zu of %zu (%s kernels)\n", matches, count,
+			       ScanKernels::HasAvx2() ? "AVX2" : "scalar");
 	}
 	scanInProgress = false;
 	selectedResultIndex = -1;
 }
 
+uint64_t MemoryScanner::GatherValues(const size_t begin, const size_t count, ScanField::ValUnion* out) const
+{
+	uint64_t valid = 0;
+	if (!GatherInstanceBlock(currentResults.objects.data() + begin, currentResults.offsets.data() + begin,
+	                         currentResults.types.data() + begin, currentResults.flags.data() + begin, out, count, valid))
+	{
+		// A stale object in this block faulted; redo it row by row so the rest still survive
+		valid = 0;
+		for (size_t i = 0; i < count; i++)
+		{
+			out[i].u64 = 0;
+			if (currentResults.flags[begin + i] & ScanResultStore::Static)
+				continue;
+			if (ReadInstanceFieldValue(currentResults.objects[begin + i], currentResults.offsets[begin + i],
+			                           currentResults.types[begin + i], &out[i]))
+				valid |= 1ull << i;
+		}
+	}
+
+	for (size_t i = 0; i < count; i++)
+	{
+		if (!(currentResults.flags[begin + i] & ScanResultStore::Static))
+			continue;
+		out[i].u64 = 0;
+		if (ReadFieldValue(currentResults.Row(begin + i), &out[i]))
+			valid |= 1ull << i;
+	}
+
+	return valid;
+}
+
+ScanField::ValUnion MemoryScanner::GetComparisonTarget() const
+{
+	ScanField::ValUnion target{};
+	switch (selectedType)
+	{
+	case ScanValueType::Int:
+	case ScanValueType::Long:
+		target.i64 = typedValue.i64;
+		break;
+	case ScanValueType::Float:
+		target.f32 = typedValue.f32;
+		break;
+	case ScanValueType::Double:
+		target.f64 = typedValue.f64;
+		break;
+	case ScanValueType::Bool:
+		target.i64 = typedValue.b ? 1 : 0;
+		break;
+	}
+	return target;
+}
+
 void MemoryScanner::ResetScan()
 {
 	std::scoped_lock lock(resultsMutex);
-	currentResults.clear();
+	currentResults.Clear();
+	snapshot.reset();
+	resultsGeneration++;
+	filteredRows.clear();
+	filteredRows.shrink_to_fit();
 	hasDoneFirstScan = false;
+	{
+		std::unique_lock layoutLock(layoutMutex);
+		layoutCache.clear();
+	}
+	namePool = std::make_unique<UR::StringPool>();
 	statusText.clear();
 	selectedResultIndex = -1;
 	scanInProgress = false;
 }
 
-void MemoryScanner::ScanStaticFields(std::vector<ScanField>& out) const
+void MemoryScanner::ScanStaticFields(ScanResultStore& out) const
 {
-	if (out.size() >= MAX_RESULTS)
+	if (out.Size() >= MAX_RESULTS)
 		return;
 
+	const uint32_t staticNameId = [this]
+	{
+		uint32_t id = 0;
+		namePool->Intern("(static)", &id);
+		return id;
+	}();
+
 	for (const auto& assembly : UR::assembly)
 	{
 		if (stopRequested)
@@ -640,20 +1015,23 @@ void MemoryScanner::ScanStaticFields(std::vector<ScanField>& out) const
 					klass->namespaze.starts_with("Unity.")))
 				continue;
 
-			for (const auto& field : klass->fields)
+			uint32_t classNameId = 0, namespaceId = 0;
+			namePool->Intern(klass->m_name, &classNameId);
+			namePool->Intern(klass->namespaze, &namespaceId);
+
+			for (const auto& field : klass->GetFields())
 			{
 				if (stopRequested)
 					return;
-				if (out.size() >= MAX_RESULTS)
+				if (out.Size() >= MAX_RESULTS)
 					return;
 				if (!field || !field->static_field || !field->type)
 					continue;
 
-				std::string typeName = field->type->name;
-				if (!TypeNameMatchesSearchType(typeName))
+				ActualFieldType actualType;
+				if (!TypeIdMatchesSearchType(field->type->id, actualType))
 					continue;
 
-				ActualFieldType actualType = DetermineActualFieldType(typeName);
 				char rawBytes[8] = {};
 				if (!ReadStaticFieldValue(field->address, rawBytes))
 					continue;
@@ -704,244 +1082,942 @@ void MemoryScanner::ScanStaticFields(std::vector<ScanField>& out) const
 				scanField.classHandle = klass->address;
 				scanField.object = nullptr;
 				scanField.isStatic = true;
-				scanField.valueType = selectedType;
 				scanField.actualType = actualType;
-				scanField.fieldName = field->name;
-				scanField.className = klass->m_name;
-				scanField.namespaze = klass->namespaze;
-				scanField.objectName = "(static)";
+				namePool->Intern(field->name, &scanField.fieldNameId);
+				scanField.classNameId = classNameId;
+				scanField.namespaceId = namespaceId;
+				scanField.objectNameId = staticNameId;
 				memcpy(&scanField.lastValue, value, sizeof(double));
 
-				out.push_back(scanField);
+				out.Push(scanField);
 			}
 		}
 	}
 }
 
-void MemoryScanner::ScanUnityObjectFields(std::vector<ScanField>& out)
+void MemoryScanner::ScanUnityObjectFields(ScanResultStore& out)
 {
-	if (out.size() >= MAX_RESULTS)
+	if (ResultLimitReached())
 		return;
 
-	if (objectsGathered.empty())
+	std::vector<RegisteredObject>& roots = objectRegistry.objects;
+	if (roots.empty())
 	{
 		if (debugLogging)
 			printf("[MemoryScanner] No Unity objects found to scan\n");
 		return;
 	}
 
-	if (debugLogging)
-		printf("[MemoryScanner] Scanning %zu Unity objects...\n", objectsGathered.size());
+	const size_t total = roots.size();
+	const size_t workerCount = std::min<size_t>({
+		std::max(1u, std::thread::hardware_concurrency()), MAX_SCAN_WORKERS,
+		(total + SCAN_CHUNK_SIZE - 1) / SCAN_CHUNK_SIZE
+	});
 
-	std::unordered_set<VisitedKey, VisitedKeyHash> visited;
-	int processed = 0;
+	if (debugLogging)
+		printf("[MemoryScanner] Scanning %zu Unity objects on %zu workers...\n", total, workerCount);
 
-	for (void* obj : objectsGathered)
+	// Each worker starts with a contiguous slice of the gathered objects and steals half of
+	// another worker's remaining slice once its own runs dry, so deep hierarchies don't stall the scan.
+	std::vector<ScanWorkQueue> queues(workerCount);
+	for (size_t w = 0; w < workerCount; w++)
 	{
-		if (stopRequested)
-			break;
-		if (!obj)
-			continue;
-		if (out.size() >= MAX_RESULTS)
-			break;
+		queues[w].begin = total * w / workerCount;
+		queues[w].end = total * (w + 1) / workerCount;
+	}
 
-		void* klass = Helper::SafeGetObjectClass(obj);
-		if (!klass)
-			continue;
+	std::vector<ScanResultStore> workerResults(workerCount);
+	std::atomic<size_t> workersRunning{workerCount};
+	objectsScanned = 0;
+	objectsWalked = 0;
+	objectsReused = 0;
+	objectsDeferred = 0;
 
-		std::string objName = "(unknown)";
-		if (UT::String* nameStr = nullptr;
-			Helper::SafeGetName(static_cast<UnityObject*>(obj), nameStr) && nameStr)
+	std::vector<std::thread> workers;
+	workers.reserve(workerCount);
+	for (size_t w = 0; w < workerCount; w++)
+	{
+		workers.emplace_back([this, w, &roots, &queues, &workerResults, &workersRunning]
 		{
-			objName = nameStr->ToString();
-		}
+			void* thread = nullptr;
+			try
+			{
+				thread = UR::Invoke<void*>(UR::Export::ThreadAttach, UR::pDomain);
+
+				VisitedWalks visited;
+				size_t begin = 0, end = 0;
+				while (!stopRequested && !ResultLimitReached() && TakeScanWork(queues, w, begin, end))
+				{
+					for (size_t i = begin; i < end && !stopRequested; i++)
+						ScanObjectRoot(roots[i], workerResults[w], visited);
+					objectsScanned.fetch_add(end - begin, std::memory_order_relaxed);
+				}
+			}
+			catch (...)
+			{
+			}
 
-		ScanObjectInstance(obj, klass, out, visited, 0, objName);
+			if (thread)
+				UR::Invoke<void>(UR::Export::ThreadDetach, thread);
+			workersRunning.fetch_sub(1, std::memory_order_release);
+		});
+	}
 
-		processed++;
-		if (processed % 500 == 0)
-		{
-			statusText = "Scanning objects... " + std::to_string(processed) + "/" + std::to_string(objectsGathered.size());
-		}
+	while (workersRunning.load(std::memory_order_acquire) > 0)
+	{
+		statusText = "Scanning objects... " + std::to_string(std::min(objectsScanned.load(), total)) + "/" +
+			std::to_string(total) + " (" + std::to_string(objectsReused.load()) + " unchanged, " +
+			std::to_string(workerCount) + " threads)";
+		std::this_thread::sleep_for(std::chrono::milliseconds(50));
 	}
 
-	objectsGathered.clear();
+	for (auto& worker : workers)
+		worker.join();
+
+	MergeScanResults(out, workerResults);
 
 	if (debugLogging)
-		printf("[MemoryScanner] Scanned %d objects, found %zu matches\n", processed, out.size());
+		printf("[MemoryScanner] Generation %llu: %zu walked, %zu unchanged, %zu deferred, %zu matches\n",
+		       objectRegistry.generation, objectsWalked.load(), objectsReused.load(), objectsDeferred.load(),
+		       out.Size());
 }
 
-void MemoryScanner::ScanObjectInstance(void* obj, void* klass, std::vector<ScanField>& out,
-                                       std::unordered_set<VisitedKey, VisitedKeyHash>& visited, int depth,
-                                       const std::string& objName)
+void MemoryScanner::ScanHeapRegions(ScanResultStore& out)
 {
-	if (stopRequested)
-		return;
-	if (!obj || !klass)
-		return;
-	if (depth > MAX_SCAN_DEPTH)
+	const std::vector<HeapChunk> chunks = CollectHeapChunks();
+	if (chunks.empty())
 		return;
 
-	VisitedKey key{obj, klass};
-	if (visited.contains(key))
-		return;
-	visited.insert(key);
-
-	if (out.size() >= MAX_RESULTS)
-		return;
+	size_t totalBytes = 0;
+	for (const auto& chunk : chunks)
+		totalBytes += chunk.size;
 
-	const bool mono = Config::state.unityMode == UnityResolve::Mode::Mono;
+	const size_t workerCount = std::min<size_t>({
+		std::max(1u, std::thread::hardware_concurrency()), MAX_SCAN_WORKERS, chunks.size()
+	});
 
-	void* currentClass = klass;
-	while (currentClass)
+	if (debugLogging)
+		printf("[MemoryScanner] Scanning %zu MB of heap in %zu chunks on %zu workers...\n", totalBytes >> 20,
+		       chunks.size(), workerCount);
+
+	const ScanField::ValUnion target = GetComparisonTarget();
+	const auto* selfBegin = reinterpret_cast<const uint8_t*>(this);
+	const auto* selfEnd = selfBegin + sizeof(*this);
+	const auto* targetCopy = reinterpret_cast<const uint8_t*>(&target);
+
+	// The first pass only records addresses, so nothing holding the target value is allocated
+	// (and then found by another worker) until every chunk has been scanned.
+	std::vector<std::vector<uint8_t*>> hits(workerCount);
+	std::atomic<size_t> nextChunk{0};
+	std::atomic<size_t> bytesScanned{0};
+	std::atomic<size_t> workersRunning{workerCount};
+
+	std::vector<std::thread> workers;
+	workers.reserve(workerCount);
+	for (size_t w = 0; w < workerCount; w++)
 	{
-		if (stopRequested)
-			return;
-
-		if (!includeSystemNamespaces)
+		workers.emplace_back([&, w]
 		{
-			const char* ns = UR::Invoke<const char*, void*>(
-				mono ? "mono_class_get_namespace" : "il2cpp_class_get_namespace", currentClass);
-			if (ns && (std::string_view(ns).starts_with("System.") ||
-				std::string_view(ns).starts_with("UnityEngine.") ||
-				std::string_view(ns).starts_with("Unity.")))
+			std::vector<uint32_t> offsets;
+			for (size_t i; !stopRequested && !ResultLimitReached() &&
+			     (i = nextChunk.fetch_add(1, std::memory_order_relaxed)) < chunks.size();)
 			{
-				currentClass = UR::Invoke<void*, void*>(
-					mono ? "mono_class_get_parent" : "il2cpp_class_get_parent", currentClass);
-				continue;
+				offsets.clear();
+				ScanHeapChunk(chunks[i].base, chunks[i].size, selectedType, target, offsets);
+
+				for (const uint32_t offset : offsets)
+				{
+					uint8_t* address = chunks[i].base + offset;
+					if ((address >= selfBegin && address < selfEnd) || address == targetCopy)
+						continue;
+					hits[w].push_back(address);
+				}
+				scanMatchCount.fetch_add(offsets.size(), std::memory_order_relaxed);
+				bytesScanned.fetch_add(chunks[i].size, std::memory_order_relaxed);
 			}
-		}
+			workersRunning.fetch_sub(1, std::memory_order_release);
+		});
+	}
 
-		void* iter = nullptr;
-		void* field;
+	while (workersRunning.load(std::memory_order_acquire) > 0)
+	{
+		statusText = "Scanning heap regions... " + std::to_string(bytesScanned.load() >> 20) + "/" +
+			std::to_string(totalBytes >> 20) + " MB (" + std::to_string(workerCount) + " threads)";
+		std::this_thread::sleep_for(std::chrono::milliseconds(50));
+	}
+	for (auto& worker : workers)
+		worker.join();
 
-		while ((field = UR::Invoke<void*, void*, void*>(
-			mono ? "mono_class_get_fields" : "il2cpp_class_get_fields", currentClass, &iter)))
-		{
-			if (stopRequested)
-				return;
-			if (out.size() >= MAX_RESULTS)
-				break;
+	if (stopRequested)
+		return;
 
-			const char* fieldName = UR::Invoke<const char*, void*>(
-				mono ? "mono_field_get_name" : "il2cpp_field_get_name", field);
-			int offset = UR::Invoke<int, void*>(
-				mono ? "mono_field_get_offset" : "il2cpp_field_get_offset", field);
-			int flags = UR::Invoke<int, void*>(
-				mono ? "mono_field_get_flags" : "il2cpp_field_get_flags", field);
+	ResolveHeapHits(hits, out);
+}
 
-			if ((flags & 0x10) != 0)
-				continue;
+void MemoryScanner::ResolveHeapHits(const std::vector<std::vector<uint8_t*>>& hits, ScanResultStore& out)
+{
+	const size_t workerCount = hits.size();
+	size_t hitCount = 0;
+	for (const auto& workerHits : hits)
+		hitCount += workerHits.size();
+
+	HeapNameIds names;
+	namePool->Intern("(heap)", &names.heapObject);
+	namePool->Intern("(raw)", &names.raw);
+	namePool->Intern("(unmanaged)", &names.unmanaged);
+	namePool->Intern("", &names.empty);
+
+	// Second pass maps each hit to its owning object and field, which needs the runtime
+	std::vector<ScanResultStore> resolved(workerCount);
+	std::atomic<size_t> workersRunning{workerCount};
+	objectsScanned = 0;
+
+	std::vector<std::thread> workers;
+	workers.reserve(workerCount);
+	for (size_t w = 0; w < workerCount; w++)
+	{
+		workers.emplace_back([&, w]
+		{
+			void* thread = nullptr;
+			try
+			{
+				thread = UR::Invoke<void*>(UR::Export::ThreadAttach, UR::pDomain);
+				for (uint8_t* address : hits[w])
+				{
+					if (stopRequested || resolved[w].Size() >= MAX_RESULTS)
+						break;
+					ResolveHeapHit(address, names, resolved[w]);
+					objectsScanned.fetch_add(1, std::memory_order_relaxed);
+				}
+			}
+			catch (...)
+			{
+			}
 
-			void* fieldType = UR::Invoke<void*, void*>(
-				mono ? "mono_field_get_type" : "il2cpp_field_get_type", field);
-			if (!fieldType)
-				continue;
+			if (thread)
+				UR::Invoke<void>(UR::Export::ThreadDetach, thread);
+			workersRunning.fetch_sub(1, std::memory_order_release);
+		});
+	}
 
-			const char* typeName = UR::Invoke<const char*, void*>(
-				mono ? "mono_type_get_name" : "il2cpp_type_get_name", fieldType);
+	while (workersRunning.load(std::memory_order_acquire) > 0)
+	{
+		statusText = "Resolving heap hits... " + std::to_string(std::min(objectsScanned.load(), hitCount)) + "/" +
+			std::to_string(hitCount);
+		std::this_thread::sleep_for(std::chrono::milliseconds(50));
+	}
+	for (auto& worker : workers)
+		worker.join();
 
-			if (std::string typeNameStr = typeName ? typeName : "unknown"; TypeNameMatchesSearchType(typeNameStr))
+	MergeScanResults(out, resolved);
+
+	if (debugLogging)
+		printf("[MemoryScanner] Heap scan: %zu hits, %zu results\n", hitCount, out.Size());
+}
+
+void MemoryScanner::ResolveHeapHit(uint8_t* address, const HeapNameIds& names, ScanResultStore& out)
+{
+	ScanField hit;
+	hit.object = address;
+	hit.offset = 0;
+	hit.actualType = GetRawFieldType(selectedType);
+
+	// Read back rather than trusting the scanned value, snapshot candidates may have moved on since
+	if (!ReadInstanceFieldValue(address, 0, hit.actualType, &hit.lastValue))
+		return;
+
+	void* klass = nullptr;
+	if (uint8_t* owner = FindOwningObject(address, OWNER_SEARCH_BYTES, klass))
+	{
+		const ClassLayout& layout = GetClassLayout(klass);
+		if (const int offset = static_cast<int>(address - owner); offset < layout.instanceEnd)
+		{
+			hit.object = owner;
+			hit.offset = offset;
+			hit.classHandle = klass;
+			hit.objectNameId = names.heapObject;
+
+			const auto field = std::ranges::find_if(layout.fields, [&](const FieldLayout& f)
 			{
-				ActualFieldType actualType = DetermineActualFieldType(typeNameStr);
-				char value[sizeof(double)] = {};
-				if (ReadInstanceFieldValue(obj, offset, actualType, value))
+				return f.kind == FieldLayoutKind::Primitive && f.offset == offset && f.actualType == hit.actualType;
+			});
+
+			if (field != layout.fields.end())
+			{
+				hit.fieldHandle = field->fieldHandle;
+				hit.classHandle = field->declaringClass;
+				hit.fieldNameId = field->fieldNameId;
+				hit.classNameId = field->classNameId;
+				hit.namespaceId = field->namespaceId;
+			}
+			else
+			{
+				// Inside the object but not on a field of the scanned width, e.g. within an embedded struct
+				const UR::Class* ownerClass = UR::GetClassByHandle(klass);
+				namePool->Intern(ownerClass->m_name, &hit.classNameId);
+				namePool->Intern(ownerClass->namespaze, &hit.namespaceId);
+				char offsetName[16];
+				snprintf(offsetName, sizeof(offsetName), "+0x%X", offset);
+				namePool->Intern(offsetName, &hit.fieldNameId);
+			}
+
+			out.Push(hit);
+			return;
+		}
+	}
+
+	hit.classNameId = names.unmanaged;
+	hit.namespaceId = names.empty;
+	hit.fieldNameId = names.raw;
+	hit.objectNameId = names.raw;
+	out.Push(hit);
+}
+
+void MemoryScanner::CaptureHeapSnapshot()
+{
+	const std::vector<HeapChunk> chunks = CollectHeapChunks();
+
+	size_t totalBytes = 0;
+	for (const auto& chunk : chunks)
+		totalBytes += chunk.size;
+
+	const size_t workerCount = std::min<size_t>({
+		std::max(1u, std::thread::hardware_concurrency()), MAX_SCAN_WORKERS, std::max<size_t>(1, chunks.size())
+	});
+
+	auto captured = std::make_unique<HeapSnapshot>();
+	captured->type = selectedType;
+	for (size_t w = 0; w < workerCount; w++)
+		captured->segments.push_back(std::make_unique<SnapshotSegment>(captured->memoryUsed, SNAPSHOT_MEMORY_BUDGET));
+
+	const auto elements = static_cast<uint32_t>(SnapshotSegment::PAGE_SIZE / captured->ElementSize());
+
+	if (debugLogging)
+		printf("[MemoryScanner] Capturing %zu MB of heap on %zu workers...\n", totalBytes >> 20, workerCount);
+
+	std::atomic<size_t> nextChunk{0};
+	std::atomic<size_t> bytesScanned{0};
+	std::atomic<size_t> workersRunning{workerCount};
+
+	std::vector<std::thread> workers;
+	workers.reserve(workerCount);
+	for (size_t w = 0; w < workerCount; w++)
+	{
+		workers.emplace_back([&, w]
+		{
+			alignas(32) uint8_t page[SnapshotSegment::PAGE_SIZE];
+			SnapshotSegment& segment = *captured->segments[w];
+
+			for (size_t i; !stopRequested && (i = nextChunk.fetch_add(1, std::memory_order_relaxed)) < chunks.size();)
+			{
+				for (size_t offset = 0; offset < chunks[i].size; offset += SnapshotSegment::PAGE_SIZE)
 				{
-					if (CompareValueWithTarget(value, actualType))
-					{
-						ScanField scanField;
-						scanField.fieldHandle = field;
-						scanField.classHandle = currentClass;
-						scanField.object = obj;
-						scanField.isStatic = false;
-						scanField.offset = offset;
-						scanField.valueType = selectedType;
-						scanField.actualType = actualType;
-						scanField.fieldName = fieldName ? fieldName : "unknown";
-						scanField.className = UR::Invoke<const char*, void*>(
-							mono ? "mono_class_get_name" : "il2cpp_class_get_name", currentClass);
-						if (scanField.className.empty())
-							scanField.className = "Unknown";
-						const char* ns = UR::Invoke<const char*, void*>(
-							mono ? "mono_class_get_namespace" : "il2cpp_class_get_namespace", currentClass);
-						scanField.namespaze = ns ? ns : "";
-						scanField.objectName = objName;
-						memcpy(&scanField.lastValue, value, sizeof(double));
-						out.push_back(scanField);
-					}
+					uint8_t* address = chunks[i].base + offset;
+					if (SnapshotSegment::ReadLive(address, page))
+						segment.AddPage(address, page, nullptr, 0, elements);
 				}
+				bytesScanned.fetch_add(chunks[i].size, std::memory_order_relaxed);
 			}
-			else if (depth < MAX_SCAN_DEPTH)
+			workersRunning.fetch_sub(1, std::memory_order_release);
+		});
+	}
+
+	while (workersRunning.load(std::memory_order_acquire) > 0)
+	{
+		statusText = "Capturing heap snapshot... " + std::to_string(bytesScanned.load() >> 20) + "/" +
+			std::to_string(totalBytes >> 20) + " MB (" + std::to_string(workerCount) + " threads)";
+		std::this_thread::sleep_for(std::chrono::milliseconds(50));
+	}
+	for (auto& worker : workers)
+		worker.join();
+
+	if (stopRequested)
+		return;
+
+	const bool spillOk = captured->Finish();
+
+	if (debugLogging)
+		printf("[MemoryScanner] Snapshot: %llu candidates, %zu KB in memory, %zu KB spilled\n", captured->candidates,
+		       captured->memoryBytes >> 10, captured->spilledBytes >> 10);
+
+	std::scoped_lock lock(resultsMutex);
+	statusText = "Snapshot captured. " + std::to_string(captured->candidates) + " candidates.";
+	if (!spillOk)
+		statusText += " Spill file failed, pages past the memory budget were dropped.";
+	snapshot = std::move(captured);
+	currentResults.Clear();
+	resultsGeneration++;
+	hasDoneFirstScan = true;
+}
+
+void MemoryScanner::PerformSnapshotScan()
+{
+	const HeapSnapshot& previous = *snapshot;
+	const size_t workerCount = previous.segments.size();
+	const size_t elementSize = previous.ElementSize();
+	const size_t maskWords = SnapshotSegment::PAGE_SIZE / elementSize / 64;
+	const ScanField::ValUnion target = GetComparisonTarget();
+
+	auto next = std::make_unique<HeapSnapshot>();
+	next->type = previous.type;
+	for (size_t w = 0; w < workerCount; w++)
+		next->segments.push_back(std::make_unique<SnapshotSegment>(next->memoryUsed, SNAPSHOT_MEMORY_BUDGET));
+
+	size_t totalPages = 0;
+	for (const auto& segment : previous.segments)
+		totalPages += segment->Pages().size();
+
+	// Each worker narrows its own segment, so segments never need a lock
+	std::atomic<size_t> pagesDone{0};
+	std::atomic<size_t> workersRunning{workerCount};
+
+	std::vector<std::thread> workers;
+	workers.reserve(workerCount);
+	for (size_t w = 0; w < workerCount; w++)
+	{
+		workers.emplace_back([&, w]
+		{
+			alignas(32) uint8_t before[SnapshotSegment::PAGE_SIZE];
+			alignas(32) uint8_t now[SnapshotSegment::PAGE_SIZE];
+			uint64_t mask[SnapshotSegment::MAX_MASK_WORDS];
+			uint64_t survivors[SnapshotSegment::MAX_MASK_WORDS];
+			const SnapshotSegment& source = *previous.segments[w];
+			SnapshotSegment& segment = *next->segments[w];
+
+			for (const auto& page : source.Pages())
 			{
-				bool isPrimitive = TypeNameMatchesSearchType(typeNameStr);
-				bool isString = typeNameStr == "string" || typeNameStr == "System.String";
-				bool isArray = typeNameStr.ends_with("[]") || typeNameStr.find("<") != std::string::npos;
-
-				bool isDelegate = typeNameStr.starts_with("System.") &&
-				(typeNameStr.find("Action") != std::string::npos ||
-					typeNameStr.find("Func") != std::string::npos ||
-					typeNameStr.find("Predicate") != std::string::npos ||
-					typeNameStr.find("EventHandler") != std::string::npos ||
-					typeNameStr.find("Delegate") != std::string::npos ||
-					typeNameStr.find("MulticastDelegate") != std::string::npos);
-
-				if (!isPrimitive && !isString && !isArray && !isDelegate)
-				{
-					void* fieldClass = UR::Invoke<void*, void*>(
-						mono ? "mono_class_from_mono_type" : "il2cpp_class_from_type", fieldType);
-					if (fieldClass)
-					{
-						bool isValueType = UR::Invoke<bool, void*>(
-							mono ? "mono_class_is_valuetype" : "il2cpp_class_is_valuetype", fieldClass);
+				if (stopRequested)
+					break;
+				pagesDone.fetch_add(1, std::memory_order_relaxed);
 
-						if (isValueType)
-						{
-							std::string childName = objName + "." + (fieldName ? fieldName : "unknown") + "(S)";
-							ScanObjectInstance(static_cast<char*>(obj) + offset, fieldClass, out, visited, depth + 1,
-							                   childName);
-						}
-						else
-						{
-							if (void* refObj = nullptr; Helper::SafeReadPointer(obj, offset, refObj) && refObj)
-							{
-								std::string childName = objName + "." + (fieldName ? fieldName : "unknown");
-								ScanObjectInstance(refObj, fieldClass, out, visited, depth + 1, childName);
-							}
-						}
-					}
+				if (!SnapshotSegment::ReadLive(page.address, now))
+					continue;
+
+				source.ReadPage(page, before, mask, maskWords);
+				ScanKernels::ComparePacked(previous.type, comparison, now, before, SnapshotSegment::PAGE_SIZE, target,
+				                           survivors);
+
+				uint32_t count = 0;
+				for (size_t k = 0; k < maskWords; k++)
+				{
+					survivors[k] &= mask[k];
+					count += std::popcount(survivors[k]);
 				}
+
+				if (count == 0)
+					continue;
+				segment.AddPage(page.address, now, count == maskWords * 64 ? nullptr : survivors, maskWords, count);
+			}
+			workersRunning.fetch_sub(1, std::memory_order_release);
+		});
+	}
+
+	while (workersRunning.load(std::memory_order_acquire) > 0)
+	{
+		statusText = "Comparing snapshot... " + std::to_string(pagesDone.load()) + "/" + std::to_string(totalPages) +
+			" pages";
+		std::this_thread::sleep_for(std::chrono::milliseconds(50));
+	}
+	for (auto& worker : workers)
+		worker.join();
+
+	if (stopRequested)
+	{
+		scanInProgress = false;
+		return;
+	}
+
+	const bool spillOk = next->Finish();
+
+	if (debugLogging)
+		printf("[MemoryScanner] Snapshot kept %llu of %llu candidates (%zu KB in memory, %zu KB spilled)\n",
+		       next->candidates, previous.candidates, next->memoryBytes >> 10, next->spilledBytes >> 10);
+
+	if (next->candidates <= SNAPSHOT_MATERIALIZE_LIMIT)
+	{
+		// Few enough left to resolve owners and continue on the regular result columns
+		ScanResultStore materialized;
+		MaterializeSnapshot(*next, materialized);
+
+		std::scoped_lock lock(resultsMutex);
+		currentResults = std::move(materialized);
+		snapshot.reset();
+		statusText = "Next scan complete. " + std::to_string(currentResults.Size()) + " matches.";
+	}
+	else
+	{
+		std::scoped_lock lock(resultsMutex);
+		statusText = "Next scan complete. " + std::to_string(next->candidates) + " candidates.";
+		snapshot = std::move(next);
+	}
+	if (!spillOk)
+	{
+		std::scoped_lock lock(resultsMutex);
+		statusText += " Spill file failed, pages past the memory budget were dropped.";
+	}
+	resultsGeneration++;
+	scanInProgress = false;
+	selectedResultIndex = -1;
+}
+
+void MemoryScanner::MaterializeSnapshot(const HeapSnapshot& source, ScanResultStore& out)
+{
+	const size_t elementSize = source.ElementSize();
+	const size_t maskWords = SnapshotSegment::PAGE_SIZE / elementSize / 64;
+
+	std::vector<std::vector<uint8_t*>> hits(source.segments.size());
+	alignas(32) uint8_t data[SnapshotSegment::PAGE_SIZE];
+	uint64_t mask[SnapshotSegment::MAX_MASK_WORDS];
+
+	for (size_t w = 0; w < source.segments.size(); w++)
+	{
+		for (const auto& page : source.segments[w]->Pages())
+		{
+			source.segments[w]->ReadPage(page, data, mask, maskWords);
+			for (size_t k = 0; k < maskWords; k++)
+			{
+				for (uint64_t bits = mask[k]; bits; bits &= bits - 1)
+					hits[w].push_back(page.address + (k * 64 + std::countr_zero(bits)) * elementSize);
+			}
+		}
+	}
+
+	ResolveHeapHits(hits, out);
+}
+
+std::vector<MemoryScanner::HeapChunk> MemoryScanner::CollectHeapChunks()
+{
+	std::vector<HeapChunk> chunks;
+
+	SYSTEM_INFO systemInfo;
+	GetSystemInfo(&systemInfo);
+
+	auto* address = static_cast<uint8_t*>(systemInfo.lpMinimumApplicationAddress);
+	while (address < systemInfo.lpMaximumApplicationAddress)
+	{
+		MEMORY_BASIC_INFORMATION mbi;
+		if (VirtualQuery(address, &mbi, sizeof(mbi)) == 0)
+			break;
+
+		const bool readable = (mbi.Protect & (PAGE_READWRITE | PAGE_READONLY | PAGE_EXECUTE_READWRITE)) != 0 &&
+			(mbi.Protect & (PAGE_GUARD | PAGE_NOACCESS)) == 0;
+
+		if (mbi.State == MEM_COMMIT && mbi.Type == MEM_PRIVATE && readable)
+		{
+			auto* base = static_cast<uint8_t*>(mbi.BaseAddress);
+			for (size_t offset = 0; offset < mbi.RegionSize; offset += HEAP_CHUNK_SIZE)
+				chunks.push_back({base + offset, std::min(HEAP_CHUNK_SIZE, mbi.RegionSize - offset)});
+		}
+
+		address = static_cast<uint8_t*>(mbi.BaseAddress) + mbi.RegionSize;
+	}
+
+	return chunks;
+}
+
+void MemoryScanner::ScanObjectRoot(RegisteredObject& entry, ScanResultStore& out, VisitedWalks& visited)
+{
+	if (!entry.object)
+		return;
+
+	void* klass = Helper::SafeGetObjectClass(entry.object);
+	if (!klass)
+		return;
+
+	if (entry.walkedGeneration != 0 && entry.instances.front().klass == klass && WalkUnchanged(entry))
+	{
+		for (uint32_t i = 0; i < entry.instances.size() && !stopRequested && !ResultLimitReached(); i++)
+		{
+			const WalkedInstance& instance = entry.instances[i];
+			if (visited.try_emplace({instance.object, instance.klass}, &entry).second)
+				ScanInstancePrimitives(instance.object, GetClassLayout(instance.klass), entry, i, out);
+		}
+		objectsReused.fetch_add(1, std::memory_order_relaxed);
+		return;
+	}
+
+	if (objectsWalked.fetch_add(1, std::memory_order_relaxed) >= MAX_OBJECTS_TO_SCAN)
+	{
+		objectsDeferred.fetch_add(1, std::memory_order_relaxed);
+		return;
+	}
+
+	entry.walkedGeneration = 0;
+	entry.instances.clear();
+	entry.references.clear();
+	entry.sharesInstances = false;
+	entry.name = "(unknown)";
+	if (UT::String* nameStr = nullptr;
+		Helper::SafeGetName(static_cast<UnityObject*>(entry.object), nameStr) && nameStr)
+	{
+		entry.name = nameStr->ToString();
+	}
+
+	ScanObjectInstance(entry.object, klass, out, visited, 0, entry, 0, nullptr, false);
+
+	// A walk cut short would replay as if the rest of the object had no fields, and one that skipped
+	// instances under another root would lose them if that root stops reaching them
+	if (!stopRequested && !ResultLimitReached() && !entry.sharesInstances)
+		entry.walkedGeneration = objectRegistry.generation;
+}
+
+bool MemoryScanner::WalkUnchanged(const RegisteredObject& entry)
+{
+	for (const WalkedReference& reference : entry.references)
+	{
+		void* current = nullptr;
+		Helper::SafeReadPointer(reference.holder, reference.offset, current);
+		if (current != reference.target)
+			return false;
+	}
+	return true;
+}
+
+std::string MemoryScanner::WalkedInstanceName(const RegisteredObject& walk, const uint32_t index)
+{
+	std::vector<const WalkedInstance*> chain;
+	for (uint32_t i = index; i != 0; i = walk.instances[i].parent)
+		chain.push_back(&walk.instances[i]);
+
+	std::string name = walk.name;
+	for (auto it = chain.rbegin(); it != chain.rend(); ++it)
+	{
+		name += '.';
+		name += (*it)->fieldName;
+		if ((*it)->embedded)
+			name += "(S)";
+	}
+	return name;
+}
+
+bool MemoryScanner::TakeScanWork(std::vector<ScanWorkQueue>& queues, const size_t self, size_t& begin, size_t& end)
+{
+	ScanWorkQueue& own = queues[self];
+	{
+		std::scoped_lock lock(own.mutex);
+		if (own.begin < own.end)
+		{
+			begin = own.begin;
+			end = std::min(own.end, own.begin + SCAN_CHUNK_SIZE);
+			own.begin = end;
+			return true;
+		}
+	}
+
+	for (size_t n = 1; n < queues.size(); n++)
+	{
+		ScanWorkQueue& victim = queues[(self + n) % queues.size()];
+		size_t stolenBegin, stolenEnd;
+		{
+			std::scoped_lock lock(victim.mutex);
+			const size_t remaining = victim.end - victim.begin;
+			if (remaining == 0)
+				continue;
+			stolenEnd = victim.end;
+			stolenBegin = victim.end - (remaining + 1) / 2;
+			victim.end = stolenBegin;
+		}
+
+		std::scoped_lock lock(own.mutex);
+		begin = stolenBegin;
+		end = std::min(stolenEnd, stolenBegin + SCAN_CHUNK_SIZE);
+		own.begin = end;
+		own.end = stolenEnd;
+		return true;
+	}
+	return false;
+}
+
+void MemoryScanner::MergeScanResults(ScanResultStore& out, std::vector<ScanResultStore>& workerResults)
+{
+	size_t incoming = 0;
+	for (const auto& results : workerResults)
+		incoming += results.Size();
+	out.Reserve(std::min(out.Size() + incoming, MAX_RESULTS));
+
+	// Visited sets are per worker, so an object reachable from roots owned by different
+	// workers is still scanned once by each of them; keep the first hit for each field address.
+	std::unordered_set<VisitedKey, VisitedKeyHash> seen;
+	seen.reserve(incoming);
+
+	for (auto& results : workerResults)
+	{
+		for (size_t i = 0; i < results.Size(); i++)
+		{
+			if (out.Size() >= MAX_RESULTS)
+				return;
+			if (!seen.insert({static_cast<char*>(results.objects[i]) + results.offsets[i], results.fieldHandles[i]}).second)
+				continue;
+			out.Append(results, i);
+		}
+		results.Clear();
+	}
+}
+
+void MemoryScanner::ScanObjectInstance(void* obj, void* klass, ScanResultStore& out, VisitedWalks& visited,
+                                       int depth, RegisteredObject& walk, const uint32_t parent,
+                                       const char* fieldName, const bool embedded)
+{
+	if (stopRequested)
+		return;
+	if (!obj || !klass)
+		return;
+	if (depth > MAX_SCAN_DEPTH)
+		return;
+
+	if (const auto [it, inserted] = visited.try_emplace({obj, klass}, &walk); !inserted)
+	{
+		if (it->second != &walk)
+			walk.sharesInstances = true;
+		return;
+	}
+
+	if (ResultLimitReached())
+		return;
+
+	const auto index = static_cast<uint32_t>(walk.instances.size());
+	walk.instances.push_back({obj, klass, fieldName, parent, embedded});
+
+	const ClassLayout& layout = GetClassLayout(klass);
+	ScanInstancePrimitives(obj, layout, walk, index, out);
+
+	if (depth >= MAX_SCAN_DEPTH)
+		return;
+
+	for (const FieldLayout& field : layout.fields)
+	{
+		if (stopRequested)
+			return;
+		if (ResultLimitReached())
+			break;
+		if (field.systemNamespace && !includeSystemNamespaces)
+			continue;
+
+		if (field.kind == FieldLayoutKind::ValueType)
+		{
+			ScanObjectInstance(static_cast<char*>(obj) + field.offset, field.childClass, out, visited, depth + 1, walk,
+			                   index, field.fieldName, true);
+		}
+		else if (field.kind == FieldLayoutKind::Reference)
+		{
+			void* refObj = nullptr;
+			Helper::SafeReadPointer(obj, field.offset, refObj);
+			walk.references.push_back({obj, refObj, field.offset});
+
+			// Other gathered objects are walked as roots of their own
+			if (refObj && !objectRegistry.known.contains(refObj))
+				ScanObjectInstance(refObj, field.childClass, out, visited, depth + 1, walk, index, field.fieldName, false);
+		}
+	}
+}
+
+void MemoryScanner::ScanInstancePrimitives(void* obj, const ClassLayout& layout, const RegisteredObject& walk,
+                                           const uint32_t index, ScanResultStore& out)
+{
+	uint32_t objNameId = UINT32_MAX;
+
+	// One guarded copy of the instance instead of a guarded read per field; instanceEnd can
+	// overshoot past a trailing struct, so a failed copy falls back to reading fields one by one
+	alignas(8) uint8_t instance[MAX_INSTANCE_SPAN];
+	const bool haveInstance = layout.instanceEnd <= static_cast<int>(MAX_INSTANCE_SPAN) &&
+		Helper::SafeReadSpan(obj, 0, layout.instanceEnd, instance);
+
+	for (const FieldLayout& field : layout.fields)
+	{
+		if (stopRequested)
+			return;
+		if (ResultLimitReached())
+			break;
+		if (field.kind != FieldLayoutKind::Primitive)
+			continue;
+		if (field.systemNamespace && !includeSystemNamespaces)
+			continue;
+		if (!ActualTypeMatchesSearchType(field.actualType))
+			continue;
+
+		ScanField::ValUnion value{};
+		if (haveInstance)
+			value = ScanKernels::DecodeField(instance + field.offset, field.actualType);
+		else if (!ReadInstanceFieldValue(obj, field.offset, field.actualType, &value))
+			continue;
+		if (!CompareValueWithTarget(&value, field.actualType))
+			continue;
+
+		ScanField scanField;
+		scanField.fieldHandle = field.fieldHandle;
+		scanField.classHandle = field.declaringClass;
+		scanField.object = obj;
+		scanField.isStatic = false;
+		scanField.offset = field.offset;
+		scanField.actualType = field.actualType;
+		scanField.fieldNameId = field.fieldNameId;
+		scanField.classNameId = field.classNameId;
+		scanField.namespaceId = field.namespaceId;
+		if (objNameId == UINT32_MAX)
+			namePool->Intern(WalkedInstanceName(walk, index), &objNameId);
+		scanField.objectNameId = objNameId;
+		scanField.lastValue = value;
+		out.Push(scanField);
+		scanMatchCount.fetch_add(1, std::memory_order_relaxed);
+	}
+}
+
+const MemoryScanner::ClassLayout& MemoryScanner::GetClassLayout(void* klass)
+{
+	{
+		std::shared_lock lock(layoutMutex);
+		if (const auto it = layoutCache.find(klass); it != layoutCache.end())
+			return *it->second;
+	}
+
+	// Built outside the lock; if two workers race on the same class the first insert wins.
+	auto layout = BuildClassLayout(klass);
+
+	std::unique_lock lock(layoutMutex);
+	return *layoutCache.try_emplace(klass, std::move(layout)).first->second;
+}
+
+std::unique_ptr<MemoryScanner::ClassLayout> MemoryScanner::BuildClassLayout(void* klass) const
+{
+	auto layout = std::make_unique<ClassLayout>();
+
+	for (void* currentClass = klass; currentClass;
+	     currentClass = UR::Invoke<void*, void*>(UR::Export::ClassGetParent, currentClass))
+	{
+		const char* className = UR::Invoke<const char*, void*>(UR::Export::ClassGetName, currentClass);
+		const char* ns = UR::Invoke<const char*, void*>(UR::Export::ClassGetNamespace, currentClass);
+		const bool systemNamespace = ns && (std::string_view(ns).starts_with("System.") ||
+			std::string_view(ns).starts_with("UnityEngine.") ||
+			std::string_view(ns).starts_with("Unity."));
+
+		void* iter = nullptr;
+		void* field;
+
+		while ((field = UR::Invoke<void*, void*, void*>(UR::Export::ClassGetFields, currentClass, &iter)))
+		{
+			const int flags = UR::Invoke<int, void*>(UR::Export::FieldGetFlags, field);
+			if ((flags & 0x10) != 0)
+				continue;
+
+			void* fieldType = UR::Invoke<void*, void*>(UR::Export::FieldGetType, field);
+			if (!fieldType)
+				continue;
+
+			FieldLayout entry;
+			entry.fieldHandle = field;
+			entry.declaringClass = currentClass;
+			entry.fieldName = UR::Invoke<const char*, void*>(UR::Export::FieldGetName, field);
+			if (!entry.fieldName)
+				entry.fieldName = "unknown";
+			namePool->Intern(entry.fieldName, &entry.fieldNameId);
+			namePool->Intern(className && *className ? className : "Unknown", &entry.classNameId);
+			namePool->Intern(ns ? ns : "", &entry.namespaceId);
+			entry.offset = UR::Invoke<int, void*>(UR::Export::FieldGetOffset, field);
+			entry.systemNamespace = systemNamespace;
+
+			char* rawTypeName = UR::Invoke<char*, void*>(UR::Export::TypeGetName, fieldType);
+			std::string typeNameStr = rawTypeName ? rawTypeName : "unknown";
+			// Both runtimes hand back a heap copy of the name
+			if (rawTypeName)
+				UR::Invoke<void, void*>(UR::Export::Free, rawTypeName);
+
+			if (IsPrimitiveTypeName(typeNameStr))
+			{
+				entry.kind = FieldLayoutKind::Primitive;
+				entry.actualType = DetermineActualFieldType(typeNameStr);
+				layout->instanceEnd = std::max(layout->instanceEnd, entry.offset + GetFieldWidth(entry.actualType));
+				layout->fields.push_back(entry);
+				continue;
 			}
+
+			layout->instanceEnd = std::max(layout->instanceEnd, entry.offset + 16);
+
+			const bool isString = typeNameStr == "string" || typeNameStr == "System.String";
+			const bool isArray = typeNameStr.ends_with("[]") || typeNameStr.find("<") != std::string::npos;
+
+			const bool isDelegate = typeNameStr.starts_with("System.") &&
+			(typeNameStr.find("Action") != std::string::npos ||
+				typeNameStr.find("Func") != std::string::npos ||
+				typeNameStr.find("Predicate") != std::string::npos ||
+				typeNameStr.find("EventHandler") != std::string::npos ||
+				typeNameStr.find("Delegate") != std::string::npos ||
+				typeNameStr.find("MulticastDelegate") != std::string::npos);
+
+			if (isString || isArray || isDelegate)
+				continue;
+
+			entry.childClass = UR::Invoke<void*, void*>(UR::Export::ClassFromType, fieldType);
+			if (!entry.childClass)
+				continue;
+
+			entry.kind = UR::Invoke<bool, void*>(UR::Export::ClassIsValueType, entry.childClass)
+				             ? FieldLayoutKind::ValueType
+				             : FieldLayoutKind::Reference;
+			layout->fields.push_back(entry);
 		}
+	}
+
+	return layout;
+}
+
+bool MemoryScanner::TypeIdMatchesSearchType(const std::uint32_t typeId, ActualFieldType& actualType) const
+{
+	using KnownType = UR::KnownType;
 
-		currentClass = UR::Invoke<void*, void*>(
-			mono ? "mono_class_get_parent" : "il2cpp_class_get_parent", currentClass);
+	switch (UR::ToKnownType(typeId))
+	{
+	case KnownType::Byte: actualType = ActualFieldType::Byte; break;
+	case KnownType::SByte: actualType = ActualFieldType::SByte; break;
+	case KnownType::Int16: actualType = ActualFieldType::Short; break;
+	case KnownType::UInt16: actualType = ActualFieldType::UShort; break;
+	case KnownType::Int32: actualType = ActualFieldType::Int; break;
+	case KnownType::UInt32: actualType = ActualFieldType::UInt; break;
+	case KnownType::Int64: actualType = ActualFieldType::Long; break;
+	case KnownType::UInt64: actualType = ActualFieldType::ULong; break;
+	case KnownType::Single: actualType = ActualFieldType::Float; break;
+	case KnownType::Double: actualType = ActualFieldType::Double; break;
+	case KnownType::Boolean: actualType = ActualFieldType::Bool; break;
+	default: return false;
 	}
+
+	return ActualTypeMatchesSearchType(actualType);
 }
 
-bool MemoryScanner::TypeNameMatchesSearchType(const std::string& typeName) const
+bool MemoryScanner::ActualTypeMatchesSearchType(const ActualFieldType actualType) const
 {
 	switch (selectedType)
 	{
 	case ScanValueType::Int:
-		return typeName == "System.Int32" || typeName == "int" ||
-			typeName == "System.UInt32" || typeName == "uint" ||
-			typeName == "System.Int16" || typeName == "short" ||
-			typeName == "System.UInt16" || typeName == "ushort" ||
-			typeName == "System.Byte" || typeName == "byte" ||
-			typeName == "System.SByte" || typeName == "sbyte";
+		return actualType == ActualFieldType::Byte || actualType == ActualFieldType::SByte ||
+			actualType == ActualFieldType::Short || actualType == ActualFieldType::UShort ||
+			actualType == ActualFieldType::Int || actualType == ActualFieldType::UInt;
 	case ScanValueType::Long:
-		return typeName == "System.Int64" || typeName == "long" ||
-			typeName == "System.UInt64" || typeName == "ulong";
+		return actualType == ActualFieldType::Long || actualType == ActualFieldType::ULong;
 	case ScanValueType::Float:
-		return typeName == "System.Single" || typeName == "float";
+		return actualType == ActualFieldType::Float;
 	case ScanValueType::Double:
-		return typeName == "System.Double" || typeName == "double";
+		return actualType == ActualFieldType::Double;
 	case ScanValueType::Bool:
-		return typeName == "System.Boolean" || typeName == "bool";
+		return actualType == ActualFieldType::Bool;
 	}
 	return false;
 }
 
+bool MemoryScanner::IsPrimitiveTypeName(const std::string& typeName)
+{
+	return typeName == "System.Byte" || typeName == "byte" ||
+		typeName == "System.SByte" || typeName == "sbyte" ||
+		typeName == "System.Int16" || typeName == "short" ||
+		typeName == "System.UInt16" || typeName == "ushort" ||
+		typeName == "System.Int32" || typeName == "int" ||
+		typeName == "System.UInt32" || typeName == "uint" ||
+		typeName == "System.Int64" || typeName == "long" ||
+		typeName == "System.UInt64" || typeName == "ulong" ||
+		typeName == "System.Single" || typeName == "float" ||
+		typeName == "System.Double" || typeName == "double" ||
+		typeName == "System.Boolean" || typeName == "bool";
+}
+
 ActualFieldType MemoryScanner::DetermineActualFieldType(const std::string& typeName) const
 {
 	if (typeName == "System.Byte" || typeName == "byte") return ActualFieldType::Byte;
@@ -1018,14 +2094,14 @@ bool MemoryScanner::ReadStaticFieldValue(void* fieldHandle, void* outValue) cons
 	{
 		if (mono)
 		{
-			void* vTable = UR::Invoke<void*, void*, void*>("mono_class_vtable", UR::pDomain,
+			void* vTable = UR::Invoke<void*, void*, void*>(UR::Export::ClassVTable, UR::pDomain,
 			                                               UR::Invoke<void*, void*>(
-				                                               "mono_field_get_parent", fieldHandle));
-			UR::Invoke<void, void*, void*, void*>("mono_field_static_get_value", vTable, fieldHandle, outValue);
+				                                               UR::Export::FieldGetParent, fieldHandle));
+			UR::Invoke<void, void*, void*, void*>(UR::Export::FieldStaticGetValue, vTable, fieldHandle, outValue);
 		}
 		else
 		{
-			UR::Invoke<void, void*, void*>("il2cpp_field_static_get_value", fieldHandle, outValue);
+			UR::Invoke<void, void*, void*>(UR::Export::FieldStaticGetValue, fieldHandle, outValue);
 		}
 		return true;
 	}
@@ -1040,98 +2116,13 @@ bool MemoryScanner::ReadInstanceFieldValue(void* obj, int offset, ActualFieldTyp
 	if (!obj || offset < 0 || !outValue)
 		return false;
 
-	switch (type)
-	{
-	case ActualFieldType::Byte:
-		{
-			uint8_t v;
-			if (!SafeRead(obj, offset, v))
-				return false;
-			*static_cast<int64_t*>(outValue) = static_cast<int64_t>(v);
-			return true;
-		}
-	case ActualFieldType::SByte:
-		{
-			int8_t v;
-			if (!SafeRead(obj, offset, v))
-				return false;
-			*static_cast<int64_t*>(outValue) = static_cast<int64_t>(v);
-			return true;
-		}
-	case ActualFieldType::Short:
-		{
-			int16_t v;
-			if (!SafeRead(obj, offset, v))
-				return false;
-			*static_cast<int64_t*>(outValue) = static_cast<int64_t>(v);
-			return true;
-		}
-	case ActualFieldType::UShort:
-		{
-			uint16_t v;
-			if (!SafeRead(obj, offset, v))
-				return false;
-			*static_cast<int64_t*>(outValue) = static_cast<int64_t>(v);
-			return true;
-		}
-	case ActualFieldType::Int:
-		{
-			int32_t v;
-			if (!SafeRead(obj, offset, v))
-				return false;
-			*static_cast<int64_t*>(outValue) = static_cast<int64_t>(v);
-			return true;
-		}
-	case ActualFieldType::UInt:
-		{
-			uint32_t v;
-			if (!SafeRead(obj, offset, v))
-				return false;
-			*static_cast<int64_t*>(outValue) = static_cast<int64_t>(v);
-			return true;
-		}
-	case ActualFieldType::Long:
-		{
-			int64_t v;
-			if (!SafeRead(obj, offset, v))
-				return false;
-			*static_cast<int64_t*>(outValue) = v;
-			return true;
-		}
-	case ActualFieldType::ULong:
-		{
-			uint64_t v;
-			if (!SafeRead(obj, offset, v))
-				return false;
-			*static_cast<uint64_t*>(outValue) = v;
-			return true;
-		}
-	case ActualFieldType::Float:
-		{
-			float v;
-			if (!SafeRead(obj, offset, v))
-				return false;
-			*static_cast<float*>(outValue) = v;
-			return true;
-		}
-	case ActualFieldType::Double:
-		{
-			double v;
-			if (!SafeRead(obj, offset, v))
-				return false;
-			*static_cast<double*>(outValue) = v;
-			return true;
-		}
-	case ActualFieldType::Bool:
-		{
-			bool v;
-			if (!SafeReadBool(obj, offset, v))
-				return false;
-			*static_cast<bool*>(outValue) = v;
-			return true;
-		}
-	}
-	return false;
+	uint8_t bytes[sizeof(double)];
+	if (!Helper::SafeReadSpan(obj, offset, GetFieldWidth(type), bytes))
+		return false;
+
+	const ScanField::ValUnion value = ScanKernels::DecodeField(bytes, type);
+	memcpy(outValue, &value, sizeof(value));
+	return true;
 }
 
 bool MemoryScanner::GetTargetValueAsInt64(int64_t& out) const
@@ -1338,17 +2329,49 @@ void MemoryScanner::OpenResultInInspector(const ScanField& result) const
 	if (!result.object && !result.isStatic)
 		return;
 
+	if (!result.classHandle)
+		return;
+
 	auto* inspector = Inspector::GetInstance();
 	if (!inspector)
 		return;
 
 	if (result.isStatic)
 	{
-		inspector->InspectInstance(nullptr, result.classHandle, result.className + "::" + result.fieldName);
+		inspector->InspectInstance(nullptr, result.classHandle,
+		                           std::string(ResultName(result.classNameId)) + "::" + std::string(ResultName(result.fieldNameId)));
 	}
 	else
 	{
-		inspector->InspectInstance(result.object, result.classHandle, result.objectName);
+		inspector->InspectInstance(result.object, result.classHandle, ResultName(result.objectNameId));
+	}
+}
+
+void MemoryScanner::UpdateFilteredRows(const std::string& filterLower)
+{
+	if (filterLower.empty())
+	{
+		filteredFor.clear();
+		return;
+	}
+	if (filterLower == filteredFor && filteredGeneration == resultsGeneration)
+		return;
+
+	filteredFor = filterLower;
+	filteredGeneration = resultsGeneration;
+	filteredRows.clear();
+
+	const Helper::SearchNeedle filter(filterLower);
+	for (size_t i = 0; i < currentResults.Size(); i++)
+	{
+		if (filter.FoundIn(ResultName(currentResults.classNameIds[i])) ||
+			filter.FoundIn(ResultName(currentResults.namespaceIds[i])) ||
+			filter.FoundIn(ResultName(currentResults.fieldNameIds[i])) ||
+			filter.FoundIn(ResultName(currentResults.objectNameIds[i])) ||
+			filter.FoundIn(FormatValue(currentResults.lastValues[i], currentResults.types[i])))
+		{
+			filteredRows.push_back(static_cast<uint32_t>(i));
+		}
 	}
 }
 
@@ -1387,12 +2410,58 @@ std::vector<void*> MemoryScanner::GatherUnityObjects() const
 		catch (...) {}
 	}
 
-	if (allObjects.size() > MAX_OBJECTS_TO_SCAN)
-		allObjects.resize(MAX_OBJECTS_TO_SCAN);
-
 	return allObjects;
 }
 
+void MemoryScanner::UpdateObjectRegistry()
+{
+	const std::vector<void*> gathered = GatherUnityObjects();
+	if (gathered.empty())
+		return;
+
+	ObjectRegistry& registry = objectRegistry;
+	registry.generation++;
+
+	// Walks recorded under the other namespace filter followed a different set of fields
+	const bool filterChanged = registry.includeSystemNamespaces != includeSystemNamespaces;
+	registry.includeSystemNamespaces = includeSystemNamespaces;
+
+	const std::unordered_set<void*> present(gathered.begin(), gathered.end());
+	size_t destroyed = 0;
+	std::erase_if(registry.objects, [&](RegisteredObject& entry)
+	{
+		if (!present.contains(entry.object) && !Helper::SafeIsAlive(static_cast<UnityObject*>(entry.object)))
+		{
+			registry.known.erase(entry.object);
+			destroyed++;
+			return true;
+		}
+		if (filterChanged)
+			entry.walkedGeneration = 0;
+		return false;
+	});
+
+	size_t appeared = 0;
+	for (void* obj : gathered)
+	{
+		if (registry.known.insert(obj).second)
+		{
+			registry.objects.push_back({.object = obj});
+			appeared++;
+		}
+	}
+
+	// Objects that have never been walked go first, so ones deferred by the walk budget catch up
+	std::ranges::stable_partition(registry.objects, [](const RegisteredObject& entry)
+	{
+		return entry.walkedGeneration == 0;
+	});
+
+	if (debugLogging)
+		printf("[MemoryScanner] Object registry generation %llu: %zu objects, %zu new, %zu destroyed\n",
+		       registry.generation, registry.objects.size(), appeared, destroyed);
+}
+
 const char* MemoryScanner::GetValueTypeName(ScanValueType type)
 {
 	switch (type)
@@ -1425,6 +2494,42 @@ const char* MemoryScanner::GetActualFieldTypeName(ActualFieldType type)
 	return "unknown";
 }
 
+ActualFieldType MemoryScanner::GetRawFieldType(ScanValueType type)
+{
+	switch (type)
+	{
+	case ScanValueType::Int: return ActualFieldType::Int;
+	case ScanValueType::Long: return ActualFieldType::Long;
+	case ScanValueType::Float: return ActualFieldType::Float;
+	case ScanValueType::Double: return ActualFieldType::Double;
+	case ScanValueType::Bool: return ActualFieldType::Bool;
+	}
+	return ActualFieldType::Int;
+}
+
+int MemoryScanner::GetFieldWidth(ActualFieldType type)
+{
+	switch (type)
+	{
+	case ActualFieldType::Byte:
+	case ActualFieldType::SByte:
+	case ActualFieldType::Bool:
+		return 1;
+	case ActualFieldType::Short:
+	case ActualFieldType::UShort:
+		return 2;
+	case ActualFieldType::Int:
+	case ActualFieldType::UInt:
+	case ActualFieldType::Float:
+		return 4;
+	case ActualFieldType::Long:
+	case ActualFieldType::ULong:
+	case ActualFieldType::Double:
+		return 8;
+	}
+	return 4;
+}
+
 const char* MemoryScanner::GetComparisonName(ScanComparison comp)
 {
 	switch (comp)
@@ -1438,11 +2543,6 @@ const char* MemoryScanner::GetComparisonName(ScanComparison comp)
 	return "unknown";
 }
 
-std::string MemoryScanner::FormatFieldValue(const ScanField& field)
-{
-	return FormatValue(field.lastValue, field.actualType);
-}
-
 std::string MemoryScanner::FormatValue(const ScanField::ValUnion& val, ActualFieldType type)
 {
 	char buf[64];
@@ -1518,14 +2618,14 @@ bool MemoryScanner::WriteFieldValue(const ScanField& field, const void* valueBuf
 
 			if (mono)
 			{
-				void* vTable = UR::Invoke<void*, void*, void*>("mono_class_vtable", UR::pDomain,
+				void* vTable = UR::Invoke<void*, void*, void*>(UR::Export::ClassVTable, UR::pDomain,
 				                                               UR::Invoke<void*, void*>(
-					                                               "mono_field_get_parent", field.fieldHandle));
-				UR::Invoke<void, void*, void*, const void*>("mono_field_static_set_value", vTable, field.fieldHandle, rawBytes);
+					                                               UR::Export::FieldGetParent, field.fieldHandle));
+				UR::Invoke<void, void*, void*, const void*>(UR::Export::FieldStaticSetValue, vTable, field.fieldHandle, rawBytes);
 			}
 			else
 			{
-				UR::Invoke<void, void*, const void*>("il2cpp_field_static_set_value", field.fieldHandle, rawBytes);
+				UR::Invoke<void, void*, const void*>(UR::Export::FieldStaticSetValue, field.fieldHandle, rawBytes);
 			}
 			return true;
 		}
@@ -20,18 +20,42 @@ enum class ActualFieldType
 	Bool
 };
 
+struct HeapSnapshot;
+
+enum class PointerRootKind : uint8_t { StaticField, UnityObject };
+
+// A route to a field that can be followed again after a reload: a static field or a Unity object,
+// then instance fields by name. A Unity root is followed from its instance while that lives and is
+// matched by class and object name after that. Strings are ids into the scanner's path pool.
+struct PointerPath
+{
+	static constexpr uint32_t NO_FIELD = UINT32_MAX;
+
+	PointerRootKind rootKind = PointerRootKind::StaticField;
+	ActualFieldType type = ActualFieldType::Int;
+	uint32_t assemblyId = NO_FIELD;
+	uint32_t classId = 0;
+	uint32_t namespaceId = 0;
+	uint32_t rootNameId = 0; // static field name, or the Unity object's name
+	std::vector<uint32_t> steps; // field name id << 1, low bit set when the field is an embedded struct
+	uint32_t fieldId = NO_FIELD; // NO_FIELD when the target is a raw offset inside the last object
+	int32_t offset = 0;
+	void* rootObject = nullptr; // the Unity object the path was found from; not saved
+	void* rootClass = nullptr;
+};
+
+// A single result row. Names are ids into the scanner's name pool.
 struct ScanField
 {
 	void* fieldHandle = nullptr;
 	void* classHandle = nullptr;
 	void* object = nullptr;
-	std::string className;
-	std::string namespaze;
-	std::string fieldName;
-	std::string objectName;
+	uint32_t classNameId = 0;
+	uint32_t namespaceId = 0;
+	uint32_t fieldNameId = 0;
+	uint32_t objectNameId = 0;
 	bool isStatic = false;
 	int offset = 0;
-	ScanValueType valueType = ScanValueType::Int;
 	ActualFieldType actualType = ActualFieldType::Int;
 
 	union ValUnion
@@ -48,6 +72,37 @@ struct ScanField
 	bool hasPrevValue = false;
 };
 
+// Column-per-member result storage. Next scan compacts it in place instead of copying rows.
+class ScanResultStore
+{
+public:
+	enum Flags : uint8_t { Static = 1 << 0, HasPrevValue = 1 << 1 };
+
+	std::vector<void*> objects;
+	std::vector<void*> fieldHandles;
+	std::vector<void*> classHandles;
+	std::vector<int32_t> offsets;
+	std::vector<ActualFieldType> types;
+	std::vector<uint8_t> flags;
+	std::vector<ScanField::ValUnion> lastValues;
+	std::vector<ScanField::ValUnion> prevValues;
+	std::vector<uint32_t> classNameIds;
+	std::vector<uint32_t> namespaceIds;
+	std::vector<uint32_t> fieldNameIds;
+	std::vector<uint32_t> objectNameIds;
+
+	size_t Size() const { return objects.size(); }
+	bool Empty() const { return objects.empty(); }
+	size_t MemoryBytes() const;
+
+	void Reserve(size_t count);
+	void Push(const ScanField& row);
+	void Append(const ScanResultStore& other, size_t index);
+	ScanField Row(size_t index) const;
+	void Compact(const std::vector<uint64_t>& keepMask, const std::vector<ScanField::ValUnion>& values);
+	void Clear();
+};
+
 class MemoryScanner final : public IFeature
 {
 public:
@@ -56,20 +111,27 @@ public:
 	~MemoryScanner() override;
 
 private:
-	enum class ScanOperation { None, FirstScan, NextScan, Reset };
+	enum class ScanOperation { None, FirstScan, NextScan, Reset, PointerScan, WatchPaths };
 
 	ScanValueType selectedType = ScanValueType::Int;
 	ScanComparison comparison = ScanComparison::Exact;
 	char m_valueBuffer[64] = {};
-	bool scanInProgress = false;
+	std::atomic<bool> scanInProgress{false};
 	std::string statusText;
 	bool includeSystemNamespaces = false;
+	bool rawHeapScan = false;
 	bool debugLogging = false;
 
-	std::vector<ScanField> currentResults;
+	ScanResultStore currentResults;
+	std::unique_ptr<HeapSnapshot> snapshot; // raw heap unknown-value scans until few enough candidates remain
+	std::unique_ptr<UR::StringPool> namePool = std::make_unique<UR::StringPool>();
+	uint64_t resultsGeneration = 0;
 	bool hasDoneFirstScan = false;
 
 	char resultFilterBuffer[256] = {};
+	std::vector<uint32_t> filteredRows;
+	std::string filteredFor;
+	uint64_t filteredGeneration = 0;
 	int selectedResultIndex = -1;
 
 	ScanOperation pendingOperation = ScanOperation::None;
@@ -84,8 +146,22 @@ private:
 	} typedValue{.i64 = 100};
 
 	static constexpr size_t MAX_RESULTS = 5000000;
-	static constexpr size_t MAX_OBJECTS_TO_SCAN = 100000;
+	static constexpr size_t MAX_OBJECTS_TO_SCAN = 100000; // fresh walks per generation, the rest wait for the next
 	static constexpr int MAX_SCAN_DEPTH = 20;
+	static constexpr unsigned MAX_SCAN_WORKERS = 32;
+	static constexpr size_t SCAN_CHUNK_SIZE = 16;
+	static constexpr size_t HEAP_CHUNK_SIZE = 1 << 20;
+	static constexpr size_t OWNER_SEARCH_BYTES = 4096;
+	static constexpr size_t MAX_INSTANCE_SPAN = 2048;
+	static constexpr size_t SNAPSHOT_MEMORY_BUDGET = 256ull << 20;
+	static constexpr uint64_t SNAPSHOT_MATERIALIZE_LIMIT = 1000000;
+	static constexpr size_t MAX_WATCHES = 16384;
+	static constexpr int WATCH_SPAN_BYTES = 256;
+	static constexpr int POINTER_MAX_DEPTH = 6;
+	static constexpr size_t POINTER_FANOUT = 8;
+	static constexpr size_t POINTER_MAX_PATHS = 256;
+	static constexpr size_t POINTER_MAX_NODES = 2000000;
+	static constexpr size_t POINTER_MAX_EDGES = 8000000;
 
 	void PerformFirstScan();
 	void PerformNextScan();
@@ -94,8 +170,8 @@ private:
 	void RenderValueInput();
 	void SyncValueToBuffer();
 
-	void ScanStaticFields(std::vector<ScanField>& out) const;
-	void ScanUnityObjectFields(std::vector<ScanField>& out);
+	void ScanStaticFields(ScanResultStore& out) const;
+	void ScanUnityObjectFields(ScanResultStore& out);
 
 	struct VisitedKey
 	{
@@ -116,14 +192,178 @@ private:
 		}
 	};
 
-	void ScanObjectInstance(void* obj, void* klass, std::vector<ScanField>& out,
-	                        std::unordered_set<VisitedKey, VisitedKeyHash>& visited, int depth,
-	                        const std::string& objName);
+	enum class FieldLayoutKind : uint8_t { Primitive, ValueType, Reference };
+
+	struct FieldLayout
+	{
+		void* fieldHandle = nullptr;
+		void* declaringClass = nullptr;
+		void* childClass = nullptr;
+		const char* fieldName = nullptr;
+		uint32_t fieldNameId = 0;
+		uint32_t classNameId = 0;
+		uint32_t namespaceId = 0;
+		int offset = 0;
+		FieldLayoutKind kind = FieldLayoutKind::Primitive;
+		ActualFieldType actualType = ActualFieldType::Int;
+		bool systemNamespace = false;
+	};
+
+	struct ClassLayout
+	{
+		std::vector<FieldLayout> fields;
+		int instanceEnd = 0; // approximate, value-type fields are assumed to be at most 16 bytes
+	};
+
+	struct HeapChunk
+	{
+		uint8_t* base = nullptr;
+		size_t size = 0;
+	};
+
+	struct HeapNameIds
+	{
+		uint32_t heapObject = 0;
+		uint32_t raw = 0;
+		uint32_t unmanaged = 0;
+		uint32_t empty = 0;
+	};
+
+	// A result kept alive past its scan, read on the watch tick and optionally frozen. `classHandle` is the
+	// object's class when it was added; an object whose class no longer matches has been collected.
+	struct WatchEntry
+	{
+		void* object = nullptr;
+		void* classHandle = nullptr;
+		void* fieldHandle = nullptr;
+		int offset = 0;
+		ActualFieldType type = ActualFieldType::Int;
+		bool isStatic = false;
+		bool isUnityObject = false;
+		bool frozen = false;
+		bool readable = false;
+		std::string label;
+		ScanField::ValUnion value{};
+		ScanField::ValUnion frozenValue{};
+		std::array<float, 240> history{};
+		uint32_t historyHead = 0;
+		uint32_t historyCount = 0;
+	};
+
+	struct PointerNode
+	{
+		void* address = nullptr;
+		void* klass = nullptr;
+	};
+
+	// parent.fieldName holds child, either as a reference or as an embedded struct
+	struct PointerEdge
+	{
+		void* child = nullptr;
+		void* parent = nullptr;
+		const char* fieldName = nullptr;
+		bool embedded = false;
+	};
+
+	// Nodes claimed by the parallel reference walk, sharded so workers rarely contend
+	struct PointerClaims
+	{
+		struct Shard
+		{
+			std::mutex mutex;
+			std::unordered_set<VisitedKey, VisitedKeyHash> keys;
+		};
+
+		std::array<Shard, 64> shards;
+
+		bool Claim(const PointerNode& node);
+	};
+
+	struct PointerRoot
+	{
+		void* object = nullptr;
+		const UR::Assembly* assembly = nullptr; // set with field for static roots
+		const UR::Class* klass = nullptr;
+		const UR::Field* field = nullptr;
+	};
+
+	struct ScanWorkQueue
+	{
+		std::mutex mutex;
+		size_t begin = 0;
+		size_t end = 0;
+	};
+
+	struct WalkedInstance
+	{
+		void* object = nullptr;
+		void* klass = nullptr;
+		const char* fieldName = nullptr; // field of the parent instance, null for the root
+		uint32_t parent = 0;
+		bool embedded = false;
+	};
+
+	struct WalkedReference
+	{
+		void* holder = nullptr;
+		void* target = nullptr;
+		int offset = 0;
+	};
+
+	// A gathered object and the walk recorded for it. While every reference the walk read still
+	// holds the same pointer, later generations compare the recorded instances without walking.
+	struct RegisteredObject
+	{
+		void* object = nullptr;
+		std::string name;
+		uint64_t walkedGeneration = 0; // 0 until a complete walk has been recorded
+		std::vector<WalkedInstance> instances;
+		std::vector<WalkedReference> references;
+		bool sharesInstances = false; // reached instances another root already covered, so a replay would miss them
+	};
+
+	// Instances a worker has covered this scan and the root whose walk covered them. Kept across
+	// roots so a subgraph reachable from several roots is scanned and counted once per worker.
+	using VisitedWalks = std::unordered_map<VisitedKey, const RegisteredObject*, VisitedKeyHash>;
+
+	// Gathered objects persist across first scans; each scan is a new generation that only has
+	// to walk objects that appeared or whose references changed since they were last walked.
+	struct ObjectRegistry
+	{
+		std::vector<RegisteredObject> objects;
+		std::unordered_set<void*> known;
+		uint64_t generation = 0;
+		bool includeSystemNamespaces = false;
+	};
+
+	void ScanObjectInstance(void* obj, void* klass, ScanResultStore& out, VisitedWalks& visited, int depth,
+	                        RegisteredObject& walk, uint32_t parent, const char* fieldName, bool embedded);
+	void ScanInstancePrimitives(void* obj, const ClassLayout& layout, const RegisteredObject& walk, uint32_t index,
+	                            ScanResultStore& out);
+	void ScanObjectRoot(RegisteredObject& entry, ScanResultStore& out, VisitedWalks& visited);
+	static bool WalkUnchanged(const RegisteredObject& entry);
+	static std::string WalkedInstanceName(const RegisteredObject& walk, uint32_t index);
+	const ClassLayout& GetClassLayout(void* klass);
+	std::unique_ptr<ClassLayout> BuildClassLayout(void* klass) const;
+	void ScanHeapRegions(ScanResultStore& out);
+	void ResolveHeapHits(const std::vector<std::vector<uint8_t*>>& hits, ScanResultStore& out);
+	void ResolveHeapHit(uint8_t* address, const HeapNameIds& names, ScanResultStore& out);
+	void CaptureHeapSnapshot();
+	void PerformSnapshotScan();
+	void MaterializeSnapshot(const HeapSnapshot& source, ScanResultStore& out);
+	static std::vector<HeapChunk> CollectHeapChunks();
+	static bool TakeScanWork(std::vector<ScanWorkQueue>& queues, size_t self, size_t& begin, size_t& end);
+	static void MergeScanResults(ScanResultStore& out, std::vector<ScanResultStore>& workerResults);
+	bool ResultLimitReached() const { return scanMatchCount.load(std::memory_order_relaxed) >= MAX_RESULTS; }
 
-	bool TypeNameMatchesSearchType(const std::string& typeName) const;
 	ActualFieldType DetermineActualFieldType(const std::string& typeName) const;
+	bool TypeIdMatchesSearchType(std::uint32_t typeId, ActualFieldType& actualType) const;
+	bool ActualTypeMatchesSearchType(ActualFieldType actualType) const;
+	static bool IsPrimitiveTypeName(const std::string& typeName);
 
 	bool ReadFieldValue(const ScanField& field, void* outValue) const;
+	uint64_t GatherValues(size_t begin, size_t count, ScanField::ValUnion* out) const;
+	ScanField::ValUnion GetComparisonTarget() const;
 	bool ReadStaticFieldValue(void* fieldHandle, void* outValue) const;
 	bool ReadInstanceFieldValue(void* obj, int offset, ActualFieldType type, void* outValue) const;
 	bool WriteFieldValue(const ScanField& field, const void* valueBuffer) const;
@@ -138,19 +378,70 @@ private:
 	int CompareValueWithPrevious(const void* currentValue, const ScanField& field) const;
 
 	void OpenResultInInspector(const ScanField& result) const;
+	void AddWatch(const ScanField& result, bool frozen);
+	void UpdateWatches(float deltaTime);
+	void RenderWatchList();
+	static ScanField WatchField(const WatchEntry& entry);
+	static bool WatchTargetAlive(const WatchEntry& entry);
+
+	void FindPointerPaths();
+	void CollectPointerRoots(std::vector<PointerRoot>& roots, std::vector<PointerNode>& nodes) const;
+	void ExpandPointerNode(const PointerNode& node, std::vector<PointerEdge>& edges, std::vector<PointerNode>& next,
+	                       PointerClaims& claims, std::atomic<size_t>& nodeCount,
+	                       std::atomic<size_t>& edgeCount);
+	bool DescribePointerRoot(const PointerRoot& root, PointerPath& path) const;
+	bool ResolvePointerPath(const PointerPath& path, const std::unordered_map<std::string, void*>& unityRoots,
+	                        ScanField& out);
+	void WatchPointerPaths();
+	void QueueWatchPointerPaths(size_t begin, size_t end);
+	std::unordered_map<std::string, void*> IndexUnityRoots() const;
+	static bool PointerRootAlive(const PointerPath& path);
+	std::string FormatPointerPath(const PointerPath& path) const;
+	bool SavePointerPaths();
+	bool LoadPointerPaths();
+	void RenderPointerPaths();
+	static std::string UnityRootKey(void* obj);
+	static std::filesystem::path PointerPathsFile();
+	std::string_view ResultName(uint32_t id) const { return namePool->View(id); }
+	void UpdateFilteredRows(const std::string& filterLower);
 	std::vector<void*> GatherUnityObjects() const;
+	void UpdateObjectRegistry();
 
 	static const char* GetValueTypeName(ScanValueType type);
 	static const char* GetActualFieldTypeName(ActualFieldType type);
+	static ActualFieldType GetRawFieldType(ScanValueType type);
+	static int GetFieldWidth(ActualFieldType type);
 	static const char* GetComparisonName(ScanComparison comp);
-	static std::string FormatFieldValue(const ScanField& field);
 	static std::string FormatValue(const ScanField::ValUnion& val, ActualFieldType type);
 
-	std::vector<void*> objectsGathered;
+	ObjectRegistry objectRegistry;
 
 	ScanField::ValUnion editValue{.i64 = 0};
 
+	std::vector<WatchEntry> watches; // statics first, then by object and offset so one span read covers an object
+	int watchTickMs = 50;
+	float watchElapsedMs = 0.0f;
+	double watchTickMicros = 0.0;
+	size_t watchSpanReads = 0;
+	size_t watchWrites = 0;
+	int selectedWatchIndex = -1;
+
+	ScanField pointerTarget;
+	std::vector<PointerPath> pointerPaths;
+	size_t watchPathsBegin = 0;
+	size_t watchPathsEnd = 0;
+	std::vector<ScanField> resolvedPathWatches; // filled by the scan thread, added to the watch list by Update
+	std::unique_ptr<UR::StringPool> pathStrings = std::make_unique<UR::StringPool>(); // outlives result resets
+
 	std::thread scanThread;
 	std::mutex resultsMutex;
 	std::atomic<bool> stopRequested{false};
+	std::atomic<size_t> objectsScanned{0};
+	std::atomic<size_t> scanMatchCount{0};
+	std::atomic<size_t> objectsWalked{0};
+	std::atomic<size_t> objectsReused{0};
+	std::atomic<size_t> objectsDeferred{0};
+
+	std::unordered_map<void*, std::unique_ptr<ClassLayout>> layoutCache;
+	std::shared_mutex layoutMutex;
 };
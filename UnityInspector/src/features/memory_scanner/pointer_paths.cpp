@@ -0,0 +1,726 @@
+#include "pch.h"
+#include "memory_scanner.h"
+#include "helper/helper.h"
+
+namespace
+{
+	constexpr uint32_t POINTER_FILE_MAGIC = 0x50504955; // "UIPP"
+	constexpr uint16_t POINTER_FILE_VERSION = 1;
+
+	void PutVarint(std::vector<uint8_t>& out, uint64_t value)
+	{
+		while (value >= 0x80)
+		{
+			out.push_back(static_cast<uint8_t>(value) | 0x80);
+			value >>= 7;
+		}
+		out.push_back(static_cast<uint8_t>(value));
+	}
+
+	bool GetVarint(const uint8_t*& data, const uint8_t* end, uint64_t& value)
+	{
+		value = 0;
+		for (int shift = 0; data < end && shift < 64; shift += 7)
+		{
+			const uint8_t byte = *data++;
+			value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+			if (!(byte & 0x80))
+				return true;
+		}
+		return false;
+	}
+
+	template <typename T>
+	bool GetVarint(const uint8_t*& data, const uint8_t* end, T& value)
+	{
+		uint64_t wide;
+		if (!GetVarint(data, end, wide))
+			return false;
+		value = static_cast<T>(wide);
+		return true;
+	}
+}
+
+bool MemoryScanner::PointerClaims::Claim(const PointerNode& node)
+{
+	const VisitedKey key{node.address, node.klass};
+	Shard& shard = shards[VisitedKeyHash{}(key) % shards.size()];
+	std::scoped_lock lock(shard.mutex);
+	return shard.keys.insert(key).second;
+}
+
+void MemoryScanner::FindPointerPaths()
+{
+	const ScanField target = pointerTarget;
+	if (target.isStatic || !target.object)
+	{
+		statusText = "Static fields can be found by name already";
+		scanInProgress = false;
+		return;
+	}
+
+	std::vector<PointerRoot> roots;
+	std::vector<PointerNode> frontier;
+	statusText = "Collecting pointer roots...";
+	CollectPointerRoots(roots, frontier);
+
+	std::unordered_map<void*, uint32_t> rootIndex;
+	auto claims = std::make_unique<PointerClaims>();
+	for (size_t i = 0; i < roots.size(); i++)
+	{
+		rootIndex.try_emplace(roots[i].object, static_cast<uint32_t>(i));
+		claims->Claim(frontier[i]);
+	}
+
+	const size_t workerCount = std::min<size_t>(std::max(1u, std::thread::hardware_concurrency()), MAX_SCAN_WORKERS);
+	std::vector<std::vector<PointerEdge>> workerEdges(workerCount);
+	std::atomic<size_t> nodeCount{frontier.size()};
+	std::atomic<size_t> edgeCount{0};
+
+	// Breadth-first by level, so every node is expanded once and at the smallest depth it has
+	for (int depth = 0; depth < POINTER_MAX_DEPTH && !frontier.empty() && !stopRequested; depth++)
+	{
+		std::vector<std::vector<PointerNode>> next(workerCount);
+		std::atomic<size_t> nextNode{0};
+
+		std::vector<std::thread> workers;
+		workers.reserve(workerCount);
+		for (size_t w = 0; w < workerCount; w++)
+		{
+			workers.emplace_back([&, w]
+			{
+				void* thread = nullptr;
+				try
+				{
+					thread = UR::Invoke<void*>(UR::Export::ThreadAttach, UR::pDomain);
+					for (size_t i; !stopRequested && (i = nextNode.fetch_add(SCAN_CHUNK_SIZE)) < frontier.size();)
+					{
+						const size_t end = std::min(frontier.size(), i + SCAN_CHUNK_SIZE);
+						for (; i < end; i++)
+							ExpandPointerNode(frontier[i], workerEdges[w], next[w], *claims, nodeCount, edgeCount);
+					}
+				}
+				catch (...)
+				{
+				}
+
+				if (thread)
+					UR::Invoke<void>(UR::Export::ThreadDetach, thread);
+			});
+		}
+		for (auto& worker : workers)
+			worker.join();
+
+		frontier.clear();
+		for (auto& nodes : next)
+			frontier.insert(frontier.end(), nodes.begin(), nodes.end());
+
+		statusText = "Indexing references... depth " + std::to_string(depth + 1) + ", " +
+			std::to_string(nodeCount.load()) + " objects, " + std::to_string(edgeCount.load()) + " references";
+	}
+
+	if (stopRequested)
+	{
+		scanInProgress = false;
+		return;
+	}
+
+	std::vector<PointerEdge> edges;
+	edges.reserve(std::min(edgeCount.load(), POINTER_MAX_EDGES));
+	for (auto& workerEdge : workerEdges)
+	{
+		edges.insert(edges.end(), workerEdge.begin(), workerEdge.end());
+		std::vector<PointerEdge>().swap(workerEdge);
+	}
+	std::ranges::sort(edges, {}, &PointerEdge::child);
+
+	// Walk backwards from the target; each node is entered once, so paths found are the shortest
+	struct SearchStep
+	{
+		void* node;
+		uint32_t parentStep;
+		const PointerEdge* edge;
+		int depth;
+	};
+
+	std::vector<SearchStep> steps{{target.object, UINT32_MAX, nullptr, 0}};
+	std::unordered_set<void*> seen{target.object};
+	std::vector<PointerPath> found;
+
+	uint32_t fieldId = PointerPath::NO_FIELD;
+	if (target.fieldHandle)
+		pathStrings->Intern(ResultName(target.fieldNameId), &fieldId);
+
+	for (size_t head = 0; head < steps.size() && found.size() < POINTER_MAX_PATHS; head++)
+	{
+		const SearchStep step = steps[head];
+
+		if (const auto root = rootIndex.find(step.node); root != rootIndex.end())
+		{
+			PointerPath path;
+			if (!DescribePointerRoot(roots[root->second], path))
+				continue;
+
+			for (uint32_t i = static_cast<uint32_t>(head); steps[i].edge; i = steps[i].parentStep)
+			{
+				uint32_t nameId = 0;
+				pathStrings->Intern(steps[i].edge->fieldName, &nameId);
+				path.steps.push_back(nameId << 1 | (steps[i].edge->embedded ? 1 : 0));
+			}
+			path.type = target.actualType;
+			path.fieldId = fieldId;
+			path.offset = target.offset;
+			found.push_back(std::move(path));
+			continue;
+		}
+
+		if (step.depth >= POINTER_MAX_DEPTH)
+			continue;
+
+		const auto [first, last] = std::ranges::equal_range(edges, step.node, {}, &PointerEdge::child);
+		size_t fanout = 0;
+		for (auto it = first; it != last && fanout < POINTER_FANOUT; ++it)
+		{
+			if (!seen.insert(it->parent).second)
+				continue;
+			steps.push_back({it->parent, static_cast<uint32_t>(head), &*it, step.depth + 1});
+			fanout++;
+		}
+	}
+
+	if (debugLogging)
+		printf("[MemoryScanner] Pointer scan: %zu roots, %zu objects, %zu references, %zu paths\n", roots.size(),
+		       nodeCount.load(), edges.size(), found.size());
+
+	std::scoped_lock lock(resultsMutex);
+	pointerPaths = std::move(found);
+	statusText = "Pointer scan complete. " + std::to_string(pointerPaths.size()) + " paths.";
+	scanInProgress = false;
+}
+
+void MemoryScanner::CollectPointerRoots(std::vector<PointerRoot>& roots, std::vector<PointerNode>& nodes) const
+{
+	for (const auto& assembly : UR::assembly)
+	{
+		if (stopRequested)
+			return;
+		if (!assembly)
+			continue;
+
+		for (const auto& klass : assembly->classes)
+		{
+			if (!klass || !klass->address)
+				continue;
+			if (!includeSystemNamespaces &&
+				(klass->namespaze.starts_with("System.") || klass->namespaze.starts_with("UnityEngine.") ||
+					klass->namespaze.starts_with("Unity.")))
+				continue;
+
+			for (const auto& field : klass->GetFields())
+			{
+				// Only reference statics hold a pointer that can be read out; struct statics are copied
+				if (!field || !field->static_field || !field->type || field->offset == -1)
+					continue;
+				const UR::KnownType known = UR::ToKnownType(field->type->id);
+				if (known == UR::KnownType::Boolean || (known >= UR::KnownType::SByte && known <= UR::KnownType::Double) ||
+					known == UR::KnownType::String)
+					continue;
+
+				void* fieldClass = UR::Invoke<void*, void*>(UR::Export::ClassFromType, field->type->address);
+				if (!fieldClass || UR::Invoke<bool, void*>(UR::Export::ClassIsValueType, fieldClass))
+					continue;
+
+				void* object = nullptr;
+				if (!ReadStaticFieldValue(field->address, &object) || !object)
+					continue;
+				void* objectClass = Helper::SafeGetObjectClass(object);
+				if (!objectClass)
+					continue;
+
+				roots.push_back({object, assembly.get(), klass.get(), field.get()});
+				nodes.push_back({object, objectClass});
+			}
+		}
+	}
+
+	for (const RegisteredObject& entry : objectRegistry.objects)
+	{
+		if (void* objectClass = Helper::SafeGetObjectClass(entry.object))
+		{
+			roots.push_back({entry.object});
+			nodes.push_back({entry.object, objectClass});
+		}
+	}
+}
+
+void MemoryScanner::ExpandPointerNode(const PointerNode& node, std::vector<PointerEdge>& edges,
+                                      std::vector<PointerNode>& next, PointerClaims& claims,
+                                      std::atomic<size_t>& nodeCount, std::atomic<size_t>& edgeCount)
+{
+	const ClassLayout& layout = GetClassLayout(node.klass);
+
+	for (const FieldLayout& field : layout.fields)
+	{
+		if (field.systemNamespace && !includeSystemNamespaces)
+			continue;
+
+		PointerNode child;
+		if (field.kind == FieldLayoutKind::ValueType)
+		{
+			child = {static_cast<char*>(node.address) + field.offset, field.childClass};
+		}
+		else if (field.kind == FieldLayoutKind::Reference)
+		{
+			if (!Helper::SafeReadPointer(node.address, field.offset, child.address) || !child.address)
+				continue;
+			child.klass = Helper::SafeGetObjectClass(child.address);
+			if (!child.klass)
+				continue;
+		}
+		else
+		{
+			continue;
+		}
+
+		if (edgeCount.fetch_add(1, std::memory_order_relaxed) >= POINTER_MAX_EDGES)
+			return;
+		edges.push_back({child.address, node.address, field.fieldName, field.kind == FieldLayoutKind::ValueType});
+
+		if (nodeCount.load(std::memory_order_relaxed) < POINTER_MAX_NODES && claims.Claim(child))
+		{
+			nodeCount.fetch_add(1, std::memory_order_relaxed);
+			next.push_back(child);
+		}
+	}
+}
+
+bool MemoryScanner::DescribePointerRoot(const PointerRoot& root, PointerPath& path) const
+{
+	if (root.field)
+	{
+		path.rootKind = PointerRootKind::StaticField;
+		pathStrings->Intern(root.assembly->name, &path.assemblyId);
+		pathStrings->Intern(root.klass->m_name, &path.classId);
+		pathStrings->Intern(root.klass->namespaze, &path.namespaceId);
+		pathStrings->Intern(root.field->name, &path.rootNameId);
+		return true;
+	}
+
+	void* klass = Helper::SafeGetObjectClass(root.object);
+	if (!klass)
+		return false;
+
+	const char* className = UR::Invoke<const char*, void*>(UR::Export::ClassGetName, klass);
+	const char* ns = UR::Invoke<const char*, void*>(UR::Export::ClassGetNamespace, klass);
+	std::string name;
+	if (UT::String* nameStr = nullptr; Helper::SafeGetName(static_cast<UnityObject*>(root.object), nameStr) && nameStr)
+		name = nameStr->ToString();
+
+	path.rootKind = PointerRootKind::UnityObject;
+	path.rootObject = root.object;
+	path.rootClass = klass;
+	pathStrings->Intern(className ? className : "", &path.classId);
+	pathStrings->Intern(ns ? ns : "", &path.namespaceId);
+	pathStrings->Intern(name, &path.rootNameId);
+	return true;
+}
+
+std::string MemoryScanner::UnityRootKey(void* obj)
+{
+	void* klass = Helper::SafeGetObjectClass(obj);
+	if (!klass)
+		return {};
+
+	const char* className = UR::Invoke<const char*, void*>(UR::Export::ClassGetName, klass);
+	std::string key = className ? className : "";
+	key += '/';
+	if (UT::String* nameStr = nullptr; Helper::SafeGetName(static_cast<UnityObject*>(obj), nameStr) && nameStr)
+		key += nameStr->ToString();
+	return key;
+}
+
+// Runs on the scan thread over the registry Update refreshed before starting it. Several objects may
+// share a class and name; the first one found stands in for all of them.
+std::unordered_map<std::string, void*> MemoryScanner::IndexUnityRoots() const
+{
+	std::unordered_map<std::string, void*> index;
+	for (const RegisteredObject& entry : objectRegistry.objects)
+	{
+		if (std::string key = UnityRootKey(entry.object); !key.empty())
+			index.try_emplace(std::move(key), entry.object);
+	}
+	return index;
+}
+
+bool MemoryScanner::PointerRootAlive(const PointerPath& path)
+{
+	return path.rootObject && Helper::SafeGetObjectClass(path.rootObject) == path.rootClass &&
+		Helper::SafeIsAlive(static_cast<UnityObject*>(path.rootObject));
+}
+
+bool MemoryScanner::ResolvePointerPath(const PointerPath& path,
+                                       const std::unordered_map<std::string, void*>& unityRoots, ScanField& out)
+{
+	const auto view = [this](const uint32_t id) { return std::string(pathStrings->View(id)); };
+	const auto findField = [](const ClassLayout& layout, const std::string_view name) -> const FieldLayout*
+	{
+		const auto it = std::ranges::find_if(layout.fields, [&](const FieldLayout& f) { return name == f.fieldName; });
+		return it != layout.fields.end() ? &*it : nullptr;
+	};
+
+	void* current = nullptr;
+	if (path.rootKind == PointerRootKind::StaticField)
+	{
+		const UR::Assembly* assembly = UR::Get(view(path.assemblyId));
+		UR::Class* klass = assembly ? assembly->Get(view(path.classId), view(path.namespaceId)) : nullptr;
+		const UR::Field* field = klass ? klass->Get<UR::Field>(view(path.rootNameId)) : nullptr;
+		if (!field || !field->static_field || !ReadStaticFieldValue(field->address, &current))
+			return false;
+	}
+	else if (PointerRootAlive(path))
+	{
+		current = path.rootObject;
+	}
+	else
+	{
+		// Loaded from a file, or the object it was found from is gone: take one with the same class and name
+		const auto it = unityRoots.find(view(path.classId) + '/' + view(path.rootNameId));
+		if (it == unityRoots.end())
+			return false;
+		current = it->second;
+	}
+
+	void* embeddedClass = nullptr;
+	for (const uint32_t step : path.steps)
+	{
+		void* holderClass = embeddedClass ? embeddedClass : Helper::SafeGetObjectClass(current);
+		if (!current || !holderClass)
+			return false;
+
+		const FieldLayout* field = findField(GetClassLayout(holderClass), pathStrings->View(step >> 1));
+		if (!field)
+			return false;
+
+		if (step & 1)
+		{
+			current = static_cast<char*>(current) + field->offset;
+			embeddedClass = field->childClass;
+		}
+		else
+		{
+			if (!Helper::SafeReadPointer(current, field->offset, current))
+				return false;
+			embeddedClass = nullptr;
+		}
+	}
+
+	void* holderClass = embeddedClass ? embeddedClass : Helper::SafeGetObjectClass(current);
+	if (!current || !holderClass)
+		return false;
+
+	ScanField result;
+	result.object = current;
+	result.actualType = path.type;
+	result.offset = path.offset;
+
+	if (path.fieldId != PointerPath::NO_FIELD)
+	{
+		const FieldLayout* field = findField(GetClassLayout(holderClass), pathStrings->View(path.fieldId));
+		if (!field || field->kind != FieldLayoutKind::Primitive || field->actualType != path.type)
+			return false;
+		result.offset = field->offset;
+		result.fieldHandle = field->fieldHandle;
+		result.classHandle = field->declaringClass;
+		result.fieldNameId = field->fieldNameId;
+		result.classNameId = field->classNameId;
+		result.namespaceId = field->namespaceId;
+	}
+	else
+	{
+		const UR::Class* klass = UR::GetClassByHandle(holderClass);
+		result.classHandle = holderClass;
+		namePool->Intern(klass ? klass->m_name : "", &result.classNameId);
+		namePool->Intern(klass ? klass->namespaze : "", &result.namespaceId);
+		char offsetName[16];
+		snprintf(offsetName, sizeof(offsetName), "+0x%X", path.offset);
+		namePool->Intern(offsetName, &result.fieldNameId);
+	}
+
+	if (!ReadFieldValue(result, &result.lastValue))
+		return false;
+
+	namePool->Intern(FormatPointerPath(path), &result.objectNameId);
+	out = result;
+	return true;
+}
+
+void MemoryScanner::QueueWatchPointerPaths(const size_t begin, const size_t end)
+{
+	watchPathsBegin = begin;
+	watchPathsEnd = end;
+	pendingOperation = ScanOperation::WatchPaths;
+}
+
+// Scan thread side of "Watch": resolved fields are handed to Update, which owns the watch list
+void MemoryScanner::WatchPointerPaths()
+{
+	std::vector<PointerPath> paths;
+	{
+		std::scoped_lock lock(resultsMutex);
+		const size_t end = std::min(watchPathsEnd, pointerPaths.size());
+		if (watchPathsBegin < end)
+			paths.assign(pointerPaths.begin() + watchPathsBegin, pointerPaths.begin() + end);
+	}
+
+	const bool needsUnityRoots = std::ranges::any_of(paths, [](const PointerPath& path)
+	{
+		return path.rootKind == PointerRootKind::UnityObject && !PointerRootAlive(path);
+	});
+	const auto unityRoots = needsUnityRoots ? IndexUnityRoots() : std::unordered_map<std::string, void*>();
+
+	std::vector<ScanField> resolved;
+	for (const PointerPath& path : paths)
+	{
+		if (stopRequested)
+			break;
+		if (ScanField result; ResolvePointerPath(path, unityRoots, result))
+			resolved.push_back(result);
+	}
+
+	std::scoped_lock lock(resultsMutex);
+	statusText = "Resolved " + std::to_string(resolved.size()) + " of " + std::to_string(paths.size()) + " pointer paths";
+	resolvedPathWatches.insert(resolvedPathWatches.end(), resolved.begin(), resolved.end());
+	scanInProgress = false;
+}
+
+std::string MemoryScanner::FormatPointerPath(const PointerPath& path) const
+{
+	std::string text;
+	if (path.rootKind == PointerRootKind::StaticField)
+	{
+		if (const std::string_view ns = pathStrings->View(path.namespaceId); !ns.empty())
+			(text += ns) += '.';
+		(text += pathStrings->View(path.classId)) += "::";
+		text += pathStrings->View(path.rootNameId);
+	}
+	else
+	{
+		((text += '"') += pathStrings->View(path.rootNameId)) += "\" (";
+		(text += pathStrings->View(path.classId)) += ')';
+	}
+
+	for (const uint32_t step : path.steps)
+	{
+		text += step & 1 ? "." : "->";
+		text += pathStrings->View(step >> 1);
+	}
+
+	text += "->";
+	if (path.fieldId != PointerPath::NO_FIELD)
+		text += pathStrings->View(path.fieldId);
+	else
+		text += std::format("+0x{:X}", path.offset);
+	return text;
+}
+
+std::filesystem::path MemoryScanner::PointerPathsFile()
+{
+	char buffer[MAX_PATH];
+	GetModuleFileNameA(nullptr, buffer, MAX_PATH);
+	return std::filesystem::path(buffer).parent_path() / "pointer_paths.bin";
+}
+
+bool MemoryScanner::SavePointerPaths()
+{
+	// Strings are written once into a table local to the file and paths refer to them by index
+	std::vector<uint32_t> order;
+	std::unordered_map<uint32_t, uint32_t> remap;
+	const auto local = [&](const uint32_t id) -> uint64_t
+	{
+		if (id == PointerPath::NO_FIELD)
+			return 0;
+		const auto [it, inserted] = remap.try_emplace(id, static_cast<uint32_t>(order.size() + 1));
+		if (inserted)
+			order.push_back(id);
+		return it->second;
+	};
+
+	std::vector<uint8_t> records;
+	PutVarint(records, pointerPaths.size());
+	for (const PointerPath& path : pointerPaths)
+	{
+		records.push_back(static_cast<uint8_t>(path.rootKind));
+		records.push_back(static_cast<uint8_t>(path.type));
+		PutVarint(records, local(path.assemblyId));
+		PutVarint(records, local(path.classId));
+		PutVarint(records, local(path.namespaceId));
+		PutVarint(records, local(path.rootNameId));
+		PutVarint(records, path.steps.size());
+		for (const uint32_t step : path.steps)
+			PutVarint(records, local(step >> 1) << 1 | (step & 1));
+		PutVarint(records, local(path.fieldId));
+		PutVarint(records, static_cast<uint32_t>(path.offset));
+	}
+
+	std::vector<uint8_t> header(sizeof(POINTER_FILE_MAGIC) + sizeof(POINTER_FILE_VERSION));
+	memcpy(header.data(), &POINTER_FILE_MAGIC, sizeof(POINTER_FILE_MAGIC));
+	memcpy(header.data() + sizeof(POINTER_FILE_MAGIC), &POINTER_FILE_VERSION, sizeof(POINTER_FILE_VERSION));
+	PutVarint(header, order.size());
+	for (const uint32_t id : order)
+	{
+		const std::string_view text = pathStrings->View(id);
+		PutVarint(header, text.size());
+		header.insert(header.end(), text.begin(), text.end());
+	}
+
+	std::ofstream out(PointerPathsFile(), std::ios::binary | std::ios::trunc);
+	if (!out)
+		return false;
+	out.write(reinterpret_cast<const char*>(header.data()), static_cast<std::streamsize>(header.size()));
+	out.write(reinterpret_cast<const char*>(records.data()), static_cast<std::streamsize>(records.size()));
+	return out.good();
+}
+
+bool MemoryScanner::LoadPointerPaths()
+{
+	std::ifstream in(PointerPathsFile(), std::ios::binary);
+	if (!in)
+		return false;
+	const std::vector<uint8_t> bytes((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+
+	const uint8_t* data = bytes.data();
+	const uint8_t* end = data + bytes.size();
+	uint32_t magic;
+	uint16_t version;
+	if (bytes.size() < sizeof(magic) + sizeof(version))
+		return false;
+	memcpy(&magic, data, sizeof(magic));
+	memcpy(&version, data + sizeof(magic), sizeof(version));
+	data += sizeof(magic) + sizeof(version);
+	if (magic != POINTER_FILE_MAGIC || version != POINTER_FILE_VERSION)
+		return false;
+
+	// Every string takes at least its length byte, which bounds the count before anything is allocated
+	size_t stringCount;
+	if (!GetVarint(data, end, stringCount) || stringCount > static_cast<size_t>(end - data) ||
+		stringCount >= PointerPath::NO_FIELD >> 1)
+		return false;
+	std::vector<std::string_view> strings(stringCount + 1);
+	for (size_t i = 1; i <= stringCount; i++)
+	{
+		size_t length;
+		if (!GetVarint(data, end, length) || length > static_cast<size_t>(end - data))
+			return false;
+		strings[i] = std::string_view(reinterpret_cast<const char*>(data), length);
+		data += length;
+	}
+
+	// Records are parsed with file-local string indices and only mapped into the pool once the
+	// whole file is known to be valid
+	const auto local = [&](const size_t index, uint32_t& id)
+	{
+		if (index > stringCount)
+			return false;
+		id = static_cast<uint32_t>(index);
+		return true;
+	};
+
+	size_t pathCount;
+	if (!GetVarint(data, end, pathCount) || pathCount > static_cast<size_t>(end - data))
+		return false;
+
+	std::vector<PointerPath> loaded;
+	loaded.reserve(pathCount);
+	for (size_t p = 0; p < pathCount; p++)
+	{
+		PointerPath path;
+		size_t assembly, klass, ns, rootName, stepCount, field;
+		uint32_t offset;
+		if (end - data < 2 || data[0] > static_cast<uint8_t>(PointerRootKind::UnityObject) ||
+			data[1] > static_cast<uint8_t>(ActualFieldType::Bool))
+			return false;
+		path.rootKind = static_cast<PointerRootKind>(*data++);
+		path.type = static_cast<ActualFieldType>(*data++);
+		if (!GetVarint(data, end, assembly) || !GetVarint(data, end, klass) || !GetVarint(data, end, ns) ||
+			!GetVarint(data, end, rootName) || !GetVarint(data, end, stepCount))
+			return false;
+		if (!local(assembly, path.assemblyId) || !local(klass, path.classId) || !local(ns, path.namespaceId) ||
+			!local(rootName, path.rootNameId) || stepCount > static_cast<size_t>(end - data))
+			return false;
+
+		path.steps.reserve(stepCount);
+		for (size_t s = 0; s < stepCount; s++)
+		{
+			size_t step;
+			uint32_t nameIndex;
+			if (!GetVarint(data, end, step) || !local(step >> 1, nameIndex))
+				return false;
+			path.steps.push_back(nameIndex << 1 | static_cast<uint32_t>(step & 1));
+		}
+
+		if (!GetVarint(data, end, field) || !local(field, path.fieldId) || !GetVarint(data, end, offset))
+			return false;
+		path.offset = static_cast<int32_t>(offset);
+		loaded.push_back(std::move(path));
+	}
+
+	std::vector<uint32_t> ids(stringCount + 1, PointerPath::NO_FIELD);
+	for (size_t i = 1; i <= stringCount; i++)
+		pathStrings->Intern(strings[i], &ids[i]);
+
+	for (PointerPath& path : loaded)
+	{
+		path.assemblyId = ids[path.assemblyId];
+		path.classId = ids[path.classId];
+		path.namespaceId = ids[path.namespaceId];
+		path.rootNameId = ids[path.rootNameId];
+		path.fieldId = ids[path.fieldId];
+		for (uint32_t& step : path.steps)
+			step = ids[step >> 1] << 1 | (step & 1);
+	}
+
+	std::scoped_lock lock(resultsMutex);
+	pointerPaths = std::move(loaded);
+	return true;
+}
+
+void MemoryScanner::RenderPointerPaths()
+{
+	std::unique_lock lock(resultsMutex);
+	if (pointerPaths.empty())
+		return;
+
+	ImGui::Separator();
+	ImGui::TextDisabled("POINTER PATHS (%zu)", pointerPaths.size());
+	ImGui::SameLine();
+	if (ImGui::SmallButton("Watch All") && !scanInProgress)
+		QueueWatchPointerPaths(0, pointerPaths.size());
+	ImGui::SameLine();
+	if (ImGui::SmallButton("Save"))
+		statusText = SavePointerPaths() ? "Pointer paths saved" : "Failed to save pointer paths";
+	ImGui::SameLine();
+	if (ImGui::SmallButton("Clear##Paths"))
+	{
+		pointerPaths.clear();
+		return;
+	}
+
+	if (ImGui::BeginChild("PointerPaths", ImVec2(0, 120), ImGuiChildFlags_Borders))
+	{
+		ImGuiListClipper clipper;
+		clipper.Begin(static_cast<int>(pointerPaths.size()));
+		while (clipper.Step())
+		{
+			for (int row = clipper.DisplayStart; row < clipper.DisplayEnd; ++row)
+			{
+				ImGui::PushID(row);
+				if (ImGui::SmallButton("Watch") && !scanInProgress)
+					QueueWatchPointerPaths(row, row + 1);
+				ImGui::SameLine();
+				ImGui::TextUnformatted(FormatPointerPath(pointerPaths[row]).c_str());
+				ImGui::PopID();
+			}
+		}
+	}
+	ImGui::EndChild();
+}
@@ -0,0 +1,285 @@
+#include "pch.h"
+#include "scan_kernels.h"
+#include "helper/text_search.h"
+#include <immintrin.h>
+
+namespace
+{
+	using ValUnion = ScanField::ValUnion;
+	using ScanKernels::Lane;
+
+	uint32_t SelectMask(const ScanComparison comparison, const uint32_t eq, const uint32_t gt, const uint32_t lt,
+	                    const uint32_t laneBits)
+	{
+		switch (comparison)
+		{
+		case ScanComparison::Exact: return eq;
+		case ScanComparison::Increased: return gt;
+		case ScanComparison::Decreased: return lt;
+		case ScanComparison::Changed: return gt | lt;
+		case ScanComparison::Unchanged: return ~(gt | lt) & laneBits;
+		}
+		return 0;
+	}
+
+	uint32_t Mask64(const __m256i v)
+	{
+		return static_cast<uint32_t>(_mm256_movemask_pd(_mm256_castsi256_pd(v)));
+	}
+
+	// Floats sit in the low half of each 64-bit slot; keep only the even lanes of a ps mask
+	uint32_t EvenLanes(const int mask)
+	{
+		return (mask & 1) | ((mask >> 1) & 2) | ((mask >> 2) & 4) | ((mask >> 3) & 8);
+	}
+
+	template <Lane L>
+	uint64_t CompareAvx2(const ScanComparison comparison, const ValUnion* current, const ValUnion* last,
+	                     const ValUnion target, const size_t count)
+	{
+		const bool exact = comparison == ScanComparison::Exact;
+		const __m256i targetVec = _mm256_set1_epi64x(target.i64);
+		const __m256i signBias = _mm256_set1_epi64x(INT64_MIN);
+
+		uint64_t mask = 0;
+		size_t i = 0;
+		for (; i + 4 <= count; i += 4)
+		{
+			const __m256i cur = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(current + i));
+			const __m256i other = exact ? targetVec : _mm256_loadu_si256(reinterpret_cast<const __m256i*>(last + i));
+
+			uint32_t eq, gt, lt;
+			if constexpr (L == Lane::Int64)
+			{
+				eq = Mask64(_mm256_cmpeq_epi64(cur, other));
+				gt = Mask64(_mm256_cmpgt_epi64(cur, other));
+				lt = Mask64(_mm256_cmpgt_epi64(other, cur));
+			}
+			else if constexpr (L == Lane::UInt64)
+			{
+				const __m256i a = _mm256_xor_si256(cur, signBias);
+				const __m256i b = _mm256_xor_si256(other, signBias);
+				eq = Mask64(_mm256_cmpeq_epi64(cur, other));
+				gt = Mask64(_mm256_cmpgt_epi64(a, b));
+				lt = Mask64(_mm256_cmpgt_epi64(b, a));
+			}
+			else if constexpr (L == Lane::Double)
+			{
+				const __m256d a = _mm256_castsi256_pd(cur);
+				const __m256d b = _mm256_castsi256_pd(other);
+				eq = static_cast<uint32_t>(_mm256_movemask_pd(_mm256_cmp_pd(a, b, _CMP_EQ_OQ)));
+				gt = static_cast<uint32_t>(_mm256_movemask_pd(_mm256_cmp_pd(a, b, _CMP_GT_OQ)));
+				lt = static_cast<uint32_t>(_mm256_movemask_pd(_mm256_cmp_pd(a, b, _CMP_LT_OQ)));
+			}
+			else
+			{
+				const __m256 a = _mm256_castsi256_ps(cur);
+				const __m256 b = _mm256_castsi256_ps(other);
+				eq = EvenLanes(_mm256_movemask_ps(_mm256_cmp_ps(a, b, _CMP_EQ_OQ)));
+				gt = EvenLanes(_mm256_movemask_ps(_mm256_cmp_ps(a, b, _CMP_GT_OQ)));
+				lt = EvenLanes(_mm256_movemask_ps(_mm256_cmp_ps(a, b, _CMP_LT_OQ)));
+			}
+
+			mask |= static_cast<uint64_t>(SelectMask(comparison, eq, gt, lt, 0xF)) << i;
+		}
+
+		if (i < count)
+			mask |= ScanKernels::CompareBlockScalar(L, comparison, current + i, last + i, target, count - i) << i;
+		return mask;
+	}
+
+	void AppendMatches(uint32_t mask, const size_t base, const size_t width, std::vector<uint32_t>& offsets)
+	{
+		while (mask)
+		{
+			offsets.push_back(static_cast<uint32_t>(base + std::countr_zero(mask) * width));
+			mask &= mask - 1;
+		}
+	}
+
+	template <ScanValueType T>
+	void FindEqualAvx2(const uint8_t* data, const size_t bytes, const ValUnion target, std::vector<uint32_t>& offsets)
+	{
+		const __m256i int32Target = _mm256_set1_epi32(static_cast<int32_t>(target.i64));
+		const __m256i int64Target = _mm256_set1_epi64x(target.i64);
+		const __m256 floatTarget = _mm256_set1_ps(target.f32);
+		const __m256d doubleTarget = _mm256_set1_pd(target.f64);
+
+		for (size_t i = 0; i < bytes; i += 32)
+		{
+			const __m256i v = _mm256_load_si256(reinterpret_cast<const __m256i*>(data + i));
+			if constexpr (T == ScanValueType::Int)
+				AppendMatches(_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(v, int32Target))), i, 4, offsets);
+			else if constexpr (T == ScanValueType::Long)
+				AppendMatches(Mask64(_mm256_cmpeq_epi64(v, int64Target)), i, 8, offsets);
+			else if constexpr (T == ScanValueType::Float)
+				AppendMatches(_mm256_movemask_ps(_mm256_cmp_ps(_mm256_castsi256_ps(v), floatTarget, _CMP_EQ_OQ)), i, 4,
+				              offsets);
+			else
+				AppendMatches(_mm256_movemask_pd(_mm256_cmp_pd(_mm256_castsi256_pd(v), doubleTarget, _CMP_EQ_OQ)), i, 8,
+				              offsets);
+		}
+	}
+
+	template <typename T>
+	void FindEqualScalar(const uint8_t* data, const size_t bytes, const T target, std::vector<uint32_t>& offsets)
+	{
+		const auto* values = reinterpret_cast<const T*>(data);
+		for (size_t i = 0; i < bytes / sizeof(T); i++)
+		{
+			if (values[i] == target)
+				offsets.push_back(static_cast<uint32_t>(i * sizeof(T)));
+		}
+	}
+
+	template <typename T>
+	void ComparePackedTyped(const ScanComparison comparison, const uint8_t* current, const uint8_t* previous,
+	                        const size_t bytes, const T target, uint64_t* mask)
+	{
+		const size_t count = bytes / sizeof(T);
+		std::fill_n(mask, (count + 63) / 64, 0ull);
+
+		for (size_t i = 0; i < count; i++)
+		{
+			T cur, other;
+			memcpy(&cur, current + i * sizeof(T), sizeof(T));
+			if (comparison == ScanComparison::Exact)
+				other = target;
+			else
+				memcpy(&other, previous + i * sizeof(T), sizeof(T));
+
+			if (SelectMask(comparison, cur == other, cur > other, cur < other, 1))
+				mask[i >> 6] |= 1ull << (i & 63);
+		}
+	}
+}
+
+namespace ScanKernels
+{
+	Lane LaneFor(const ActualFieldType type)
+	{
+		switch (type)
+		{
+		case ActualFieldType::ULong: return Lane::UInt64;
+		case ActualFieldType::Float: return Lane::Float;
+		case ActualFieldType::Double: return Lane::Double;
+		default: return Lane::Int64;
+		}
+	}
+
+	bool HasAvx2()
+	{
+		return Helper::HasAvx2();
+	}
+
+	uint64_t CompareBlock(const Lane lane, const ScanComparison comparison, const ValUnion* current,
+	                      const ValUnion* last, const ValUnion target, const size_t count)
+	{
+		if (!HasAvx2())
+			return CompareBlockScalar(lane, comparison, current, last, target, count);
+
+		switch (lane)
+		{
+		case Lane::Int64: return CompareAvx2<Lane::Int64>(comparison, current, last, target, count);
+		case Lane::UInt64: return CompareAvx2<Lane::UInt64>(comparison, current, last, target, count);
+		case Lane::Float: return CompareAvx2<Lane::Float>(comparison, current, last, target, count);
+		case Lane::Double: return CompareAvx2<Lane::Double>(comparison, current, last, target, count);
+		}
+		return 0;
+	}
+
+	uint64_t CompareBlockScalar(const Lane lane, const ScanComparison comparison, const ValUnion* current,
+	                            const ValUnion* last, const ValUnion target, const size_t count)
+	{
+		const bool exact = comparison == ScanComparison::Exact;
+
+		uint64_t mask = 0;
+		for (size_t i = 0; i < count; i++)
+		{
+			const ValUnion& cur = current[i];
+			const ValUnion& other = exact ? target : last[i];
+
+			bool eq, gt, lt;
+			switch (lane)
+			{
+			case Lane::Int64:
+				eq = cur.i64 == other.i64;
+				gt = cur.i64 > other.i64;
+				lt = cur.i64 < other.i64;
+				break;
+			case Lane::UInt64:
+				eq = cur.u64 == other.u64;
+				gt = cur.u64 > other.u64;
+				lt = cur.u64 < other.u64;
+				break;
+			case Lane::Float:
+				eq = cur.f32 == other.f32;
+				gt = cur.f32 > other.f32;
+				lt = cur.f32 < other.f32;
+				break;
+			default:
+				eq = cur.f64 == other.f64;
+				gt = cur.f64 > other.f64;
+				lt = cur.f64 < other.f64;
+				break;
+			}
+
+			if (SelectMask(comparison, eq, gt, lt, 1))
+				mask |= 1ull << i;
+		}
+		return mask;
+	}
+
+	void FindEqual(const ScanValueType type, const uint8_t* data, const size_t bytes, const ValUnion target,
+	               std::vector<uint32_t>& offsets)
+	{
+		// An int32 element can never equal a target outside its range
+		if (type == ScanValueType::Int && (target.i64 < INT32_MIN || target.i64 > INT32_MAX))
+			return;
+
+		if (HasAvx2())
+		{
+			switch (type)
+			{
+			case ScanValueType::Int: FindEqualAvx2<ScanValueType::Int>(data, bytes, target, offsets); break;
+			case ScanValueType::Long: FindEqualAvx2<ScanValueType::Long>(data, bytes, target, offsets); break;
+			case ScanValueType::Float: FindEqualAvx2<ScanValueType::Float>(data, bytes, target, offsets); break;
+			case ScanValueType::Double: FindEqualAvx2<ScanValueType::Double>(data, bytes, target, offsets); break;
+			default: break;
+			}
+			return;
+		}
+
+		switch (type)
+		{
+		case ScanValueType::Int: FindEqualScalar(data, bytes, static_cast<int32_t>(target.i64), offsets); break;
+		case ScanValueType::Long: FindEqualScalar(data, bytes, target.i64, offsets); break;
+		case ScanValueType::Float: FindEqualScalar(data, bytes, target.f32, offsets); break;
+		case ScanValueType::Double: FindEqualScalar(data, bytes, target.f64, offsets); break;
+		default: break;
+		}
+	}
+
+	void ComparePacked(const ScanValueType type, const ScanComparison comparison, const uint8_t* current,
+	                   const uint8_t* previous, const size_t bytes, const ValUnion target, uint64_t* mask)
+	{
+		switch (type)
+		{
+		case ScanValueType::Int:
+			ComparePackedTyped(comparison, current, previous, bytes, static_cast<int32_t>(target.i64), mask);
+			break;
+		case ScanValueType::Long:
+			ComparePackedTyped(comparison, current, previous, bytes, target.i64, mask);
+			break;
+		case ScanValueType::Float:
+			ComparePackedTyped(comparison, current, previous, bytes, target.f32, mask);
+			break;
+		case ScanValueType::Double:
+			ComparePackedTyped(comparison, current, previous, bytes, target.f64, mask);
+			break;
+		default:
+			std::fill_n(mask, bytes / 4 / 64, 0ull);
+			break;
+		}
+	}
+}
@@ -0,0 +1,54 @@
+#pragma once
+#include "memory_scanner.h"
+
+// Block comparison kernels for next scan. Values are the normalized ScanField::ValUnion
+// slots produced by the gather step: integers widened to 64 bits, bools as 0/1, floats in
+// the low 32 bits of a zeroed slot.
+namespace ScanKernels
+{
+	enum class Lane : uint8_t { Int64, UInt64, Float, Double };
+
+	constexpr size_t BLOCK_SIZE = 64;
+
+	Lane LaneFor(ActualFieldType type);
+	bool HasAvx2();
+
+	// Normalizes the field of `type` stored at `data` into a zeroed slot
+	inline ScanField::ValUnion DecodeField(const uint8_t* data, const ActualFieldType type)
+	{
+		ScanField::ValUnion value{};
+		switch (type)
+		{
+		case ActualFieldType::Byte: value.i64 = *data; break;
+		case ActualFieldType::SByte: value.i64 = *reinterpret_cast<const int8_t*>(data); break;
+		case ActualFieldType::Short: value.i64 = *reinterpret_cast<const int16_t*>(data); break;
+		case ActualFieldType::UShort: value.i64 = *reinterpret_cast<const uint16_t*>(data); break;
+		case ActualFieldType::Int: value.i64 = *reinterpret_cast<const int32_t*>(data); break;
+		case ActualFieldType::UInt: value.i64 = *reinterpret_cast<const uint32_t*>(data); break;
+		case ActualFieldType::Long: value.i64 = *reinterpret_cast<const int64_t*>(data); break;
+		case ActualFieldType::ULong: value.u64 = *reinterpret_cast<const uint64_t*>(data); break;
+		case ActualFieldType::Float: value.f32 = *reinterpret_cast<const float*>(data); break;
+		case ActualFieldType::Double: value.f64 = *reinterpret_cast<const double*>(data); break;
+		case ActualFieldType::Bool: value.i64 = *data != 0; break;
+		}
+		return value;
+	}
+
+	// Bit i of the result is set when row i survives `comparison`. Exact compares against
+	// `target`, everything else against `last`. `count` must not exceed BLOCK_SIZE.
+	uint64_t CompareBlock(Lane lane, ScanComparison comparison, const ScanField::ValUnion* current,
+	                      const ScanField::ValUnion* last, ScanField::ValUnion target, size_t count);
+	uint64_t CompareBlockScalar(Lane lane, ScanComparison comparison, const ScanField::ValUnion* current,
+	                            const ScanField::ValUnion* last, ScanField::ValUnion target, size_t count);
+
+	// Appends the byte offset of every naturally aligned element of `type` in [data, data + bytes)
+	// that equals `target`. Int is matched as int32. `data` must be 32-byte aligned and `bytes` a
+	// multiple of 32; Bool is not supported.
+	void FindEqual(ScanValueType type, const uint8_t* data, size_t bytes, ScanField::ValUnion target,
+	               std::vector<uint32_t>& offsets);
+
+	// Compares the packed elements of `type` in two equally sized buffers (Exact compares against
+	// `target`) and sets bit i of `mask` for every element that survives. Bool is not supported.
+	void ComparePacked(ScanValueType type, ScanComparison comparison, const uint8_t* current, const uint8_t* previous,
+	                   size_t bytes, ScanField::ValUnion target, uint64_t* mask);
+}
@@ -0,0 +1,305 @@
+#include "pch.h"
+#include "memory_scanner.h"
+#include "scan_kernels.h"
+#include "helper/helper.h"
+
+namespace
+{
+	float PlotValue(const ScanField::ValUnion& value, const ActualFieldType type)
+	{
+		switch (type)
+		{
+		case ActualFieldType::Float: return value.f32;
+		case ActualFieldType::Double: return static_cast<float>(value.f64);
+		case ActualFieldType::ULong: return static_cast<float>(value.u64);
+		case ActualFieldType::Bool: return value.b ? 1.0f : 0.0f;
+		default: return static_cast<float>(value.i64);
+		}
+	}
+
+	bool IsUnityObjectClass(void* klass)
+	{
+		const auto coreModule = UR::Get("UnityEngine.CoreModule.dll");
+		const auto objectClass = coreModule ? coreModule->Get("Object", "UnityEngine") : nullptr;
+		if (!objectClass) return false;
+
+		for (; klass; klass = UR::Invoke<void*, void*>(UR::Export::ClassGetParent, klass))
+		{
+			if (klass == objectClass->address) return true;
+		}
+		return false;
+	}
+
+	bool WatchOrder(const void* objectA, const int offsetA, const void* objectB, const int offsetB)
+	{
+		return objectA != objectB ? objectA < objectB : offsetA < offsetB;
+	}
+}
+
+ScanField MemoryScanner::WatchField(const WatchEntry& entry)
+{
+	ScanField field;
+	field.object = entry.object;
+	field.fieldHandle = entry.fieldHandle;
+	field.offset = entry.offset;
+	field.actualType = entry.type;
+	field.isStatic = entry.isStatic;
+	return field;
+}
+
+// Watches outlive scans and scene changes; once the object is collected its memory may hold anything, so
+// its class has to be the one it had when the watch was added
+bool MemoryScanner::WatchTargetAlive(const WatchEntry& entry)
+{
+	if (entry.isStatic) return true;
+	if (Helper::SafeGetObjectClass(entry.object) != entry.classHandle) return false;
+	return !entry.isUnityObject || Helper::SafeIsAlive(static_cast<UnityObject*>(entry.object));
+}
+
+void MemoryScanner::AddWatch(const ScanField& result, const bool frozen)
+{
+	void* object = result.isStatic ? nullptr : result.object;
+	const int offset = result.isStatic ? 0 : result.offset;
+
+	// Statics have no object, so they sort first and are told apart by field handle
+	const auto it = std::ranges::partition_point(watches, [&](const WatchEntry& entry)
+	{
+		if (entry.isStatic && result.isStatic)
+			return entry.fieldHandle < result.fieldHandle;
+		return WatchOrder(entry.object, entry.offset, object, offset);
+	});
+
+	if (it != watches.end() && it->object == object && it->offset == offset && it->fieldHandle == result.fieldHandle)
+	{
+		// A new object at a collected one's address takes the entry over
+		if (object && !WatchTargetAlive(*it))
+		{
+			it->classHandle = Helper::SafeGetObjectClass(object);
+			it->isUnityObject = IsUnityObjectClass(it->classHandle);
+		}
+		it->frozen |= frozen && (result.isStatic || it->classHandle);
+		return;
+	}
+	if (watches.size() >= MAX_WATCHES)
+	{
+		statusText = "Watch list is full";
+		return;
+	}
+
+	WatchEntry entry;
+	entry.object = object;
+	if (object)
+	{
+		entry.classHandle = Helper::SafeGetObjectClass(object);
+		entry.isUnityObject = IsUnityObjectClass(entry.classHandle);
+	}
+	entry.fieldHandle = result.fieldHandle;
+	entry.offset = offset;
+	entry.type = result.actualType;
+	entry.isStatic = result.isStatic;
+	// Without a class to check against, a write could not be told apart from one into reused memory
+	entry.frozen = frozen && (entry.isStatic || entry.classHandle);
+	entry.label = std::string(ResultName(result.classNameId)) + "::" + std::string(ResultName(result.fieldNameId));
+	if (!result.isStatic)
+		entry.label += " @ " + std::string(ResultName(result.objectNameId));
+
+	entry.readable = WatchTargetAlive(entry) && ReadFieldValue(result, &entry.value);
+	entry.frozenValue = ScanKernels::DecodeField(
+		reinterpret_cast<const uint8_t*>(entry.readable ? &entry.value : &result.lastValue), entry.type);
+
+	watches.insert(it, std::move(entry));
+	selectedWatchIndex = -1;
+}
+
+void MemoryScanner::UpdateWatches(const float deltaTime)
+{
+	if (watches.empty())
+		return;
+
+	watchElapsedMs += deltaTime * 1000.0f;
+	if (watchElapsedMs < static_cast<float>(watchTickMs))
+		return;
+	watchElapsedMs = 0.0f;
+
+	const auto start = std::chrono::steady_clock::now();
+	size_t spanReads = 0;
+	size_t writes = 0;
+
+	const auto apply = [&](WatchEntry& entry, const ScanField::ValUnion& value)
+	{
+		entry.value = value;
+		// Only the field's own bytes are written, so only those can drift
+		if (entry.frozen && memcmp(&entry.value, &entry.frozenValue, GetFieldWidth(entry.type)) != 0)
+		{
+			// Only write on drift so frozen fields the game leaves alone don't dirty their cache lines
+			if (WriteFieldValue(WatchField(entry), &entry.frozenValue))
+			{
+				entry.value = entry.frozenValue;
+				writes++;
+			}
+		}
+		entry.history[entry.historyHead] = PlotValue(entry.value, entry.type);
+		entry.historyHead = (entry.historyHead + 1) % entry.history.size();
+		entry.historyCount = std::min<uint32_t>(entry.historyCount + 1, static_cast<uint32_t>(entry.history.size()));
+	};
+
+	for (size_t i = 0; i < watches.size();)
+	{
+		WatchEntry& first = watches[i];
+		if (first.isStatic)
+		{
+			ScanField::ValUnion value{};
+			first.readable = ReadFieldValue(WatchField(first), &value);
+			if (first.readable)
+				apply(first, value);
+			i++;
+			continue;
+		}
+
+		// Neighbouring fields of one object are read with a single copy of the span they cover
+		size_t end = i + 1;
+		int spanEnd = first.offset + GetFieldWidth(first.type);
+		while (end < watches.size() && watches[end].object == first.object &&
+		       watches[end].offset + GetFieldWidth(watches[end].type) - first.offset <= WATCH_SPAN_BYTES)
+		{
+			spanEnd = std::max(spanEnd, watches[end].offset + GetFieldWidth(watches[end].type));
+			end++;
+		}
+
+		// Entries of one object share its class and liveness, so one check covers the whole span
+		const bool alive = WatchTargetAlive(first);
+		alignas(8) uint8_t span[WATCH_SPAN_BYTES];
+		const bool readable = alive && Helper::SafeReadSpan(first.object, first.offset, spanEnd - first.offset, span);
+		if (alive)
+			spanReads++;
+
+		for (size_t k = i; k < end; k++)
+		{
+			WatchEntry& entry = watches[k];
+			entry.readable = readable;
+			if (!alive || !entry.classHandle)
+				entry.frozen = false;
+			if (readable)
+				apply(entry, ScanKernels::DecodeField(span + (entry.offset - first.offset), entry.type));
+		}
+		i = end;
+	}
+
+	watchTickMicros = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+	watchSpanReads = spanReads;
+	watchWrites = writes;
+}
+
+void MemoryScanner::RenderWatchList()
+{
+	if (watches.empty())
+		return;
+
+	ImGui::Separator();
+	ImGui::TextDisabled("WATCH LIST (%zu)", watches.size());
+	ImGui::SameLine();
+	ImGui::TextDisabled("|  Last tick: %.1f us, %zu span reads, %zu writes", watchTickMicros, watchSpanReads, watchWrites);
+	ImGui::SameLine();
+	ImGui::SetNextItemWidth(150.0f);
+	ImGui::SliderInt("Tick (ms)", &watchTickMs, 0, 1000);
+	ImGui::SameLine();
+	if (ImGui::Button("Clear"))
+	{
+		watches.clear();
+		selectedWatchIndex = -1;
+		return;
+	}
+
+	int removeIndex = -1;
+	if (ImGui::BeginTable("Watches", 4, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_ScrollY,
+	                      ImVec2(0, 140)))
+	{
+		ImGui::TableSetupColumn("Freeze", ImGuiTableColumnFlags_WidthFixed, 50.0f);
+		ImGui::TableSetupColumn("Value", ImGuiTableColumnFlags_WidthStretch, 0.25f);
+		ImGui::TableSetupColumn("Field", ImGuiTableColumnFlags_WidthStretch, 0.65f);
+		ImGui::TableSetupColumn("", ImGuiTableColumnFlags_WidthFixed, 24.0f);
+		ImGui::TableHeadersRow();
+
+		ImGuiListClipper clipper;
+		clipper.Begin(static_cast<int>(watches.size()));
+		while (clipper.Step())
+		{
+			for (int row = clipper.DisplayStart; row < clipper.DisplayEnd; ++row)
+			{
+				WatchEntry& entry = watches[row];
+				ImGui::TableNextRow();
+				ImGui::PushID(row);
+
+				ImGui::TableNextColumn();
+				if (ImGui::Checkbox("##Freeze", &entry.frozen) && entry.frozen && entry.readable)
+					entry.frozenValue = entry.value;
+
+				ImGui::TableNextColumn();
+				const std::string valueText = entry.readable ? FormatValue(entry.value, entry.type) : "??";
+				if (ImGui::Selectable(valueText.c_str(), selectedWatchIndex == row, ImGuiSelectableFlags_SpanAllColumns |
+				                      ImGuiSelectableFlags_AllowOverlap))
+					selectedWatchIndex = row;
+
+				ImGui::TableNextColumn();
+				ImGui::TextUnformatted(entry.label.c_str());
+
+				ImGui::TableNextColumn();
+				if (ImGui::SmallButton("x"))
+					removeIndex = row;
+
+				ImGui::PopID();
+			}
+		}
+		ImGui::EndTable();
+	}
+
+	if (removeIndex >= 0)
+	{
+		watches.erase(watches.begin() + removeIndex);
+		selectedWatchIndex = -1;
+	}
+
+	if (selectedWatchIndex >= 0 && selectedWatchIndex < static_cast<int>(watches.size()))
+	{
+		WatchEntry& entry = watches[selectedWatchIndex];
+
+		// The history is a ring buffer, so the oldest sample sits at the write head once it has wrapped
+		const int offset = entry.historyCount < entry.history.size() ? 0 : static_cast<int>(entry.historyHead);
+		ImGui::PlotLines("##History", entry.history.data(), static_cast<int>(entry.historyCount), offset,
+		                 entry.label.c_str(), FLT_MAX, FLT_MAX, ImVec2(-260.0f, 60.0f));
+		ImGui::SameLine();
+
+		ImGui::BeginGroup();
+		ImGui::SetNextItemWidth(160.0f);
+		bool changed;
+		switch (entry.type)
+		{
+		case ActualFieldType::Bool:
+			changed = ImGui::Checkbox("Frozen Value", &entry.frozenValue.b);
+			break;
+		case ActualFieldType::Float:
+			changed = ImGui::InputFloat("Frozen Value", &entry.frozenValue.f32, 0.0f, 0.0f, "%.3f", ImGuiInputTextFlags_EnterReturnsTrue);
+			break;
+		case ActualFieldType::Double:
+			changed = ImGui::InputDouble("Frozen Value", &entry.frozenValue.f64, 0.0, 0.0, "%.6f", ImGuiInputTextFlags_EnterReturnsTrue);
+			break;
+		case ActualFieldType::ULong:
+			changed = ImGui::InputScalar("Frozen Value", ImGuiDataType_U64, &entry.frozenValue.u64, nullptr, nullptr, nullptr, ImGuiInputTextFlags_EnterReturnsTrue);
+			break;
+		default:
+			changed = ImGui::InputScalar("Frozen Value", ImGuiDataType_S64, &entry.frozenValue.i64, nullptr, nullptr, nullptr, ImGuiInputTextFlags_EnterReturnsTrue);
+			break;
+		}
+		if (changed)
+		{
+			// Truncate to the field's width so the editor shows the value that actually gets written
+			entry.frozenValue = ScanKernels::DecodeField(reinterpret_cast<const uint8_t*>(&entry.frozenValue), entry.type);
+			entry.frozen = true;
+		}
+		if (entry.isStatic)
+			ImGui::TextDisabled("Static Field");
+		else
+			ImGui::TextDisabled("%p +0x%X", entry.object, entry.offset);
+		ImGui::EndGroup();
+	}
+}
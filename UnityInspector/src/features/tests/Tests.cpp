@@ -1,8 +1,37 @@
 ﻿#include "pch.h"
 #include "tests.h"
+#include "features/memory_scanner/scan_kernels.h"
+#include "helper/text_search.h"
 
 REGISTER_FEATURE(Tests)
 
+namespace
+{
+	constexpr int BENCHMARK_ITERATIONS = 1000000;
+	constexpr size_t SCAN_BENCHMARK_CANDIDATES = 5000000;
+	constexpr size_t TEXT_BENCHMARK_STRINGS = 100000;
+	constexpr int TEXT_BENCHMARK_PASSES = 10;
+
+	template <typename Fn>
+	double MeasureNsPerCall(Fn&& fn)
+	{
+		const auto start = std::chrono::steady_clock::now();
+		for (int i = 0; i < BENCHMARK_ITERATIONS; i++)
+			fn();
+		const auto elapsed = std::chrono::steady_clock::now() - start;
+		return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()) /
+			BENCHMARK_ITERATIONS;
+	}
+
+	uint64_t NextRandom(uint64_t& state)
+	{
+		state ^= state << 13;
+		state ^= state >> 7;
+		state ^= state << 17;
+		return state;
+	}
+}
+
 void Tests::Update(float)
 {
 
@@ -10,5 +39,245 @@ void Tests::Update(float)
 
 void Tests::Render()
 {
+	if (!Config::state.showMenu) return;
+	if (!Config::settings.tests.showWindow) return;
+
+	if (ImGui::Begin("Benchmarks", &Config::settings.tests.showWindow))
+	{
+		if (ImGui::Button("Runtime Exports"))
+			RunExportBenchmark();
+		if (ImGui::IsItemHovered()) ImGui::SetTooltip("Compare string-keyed UR::Invoke with the pre-resolved export table");
+
+		ImGui::SameLine();
+		if (ImGui::Button("Scan Kernels"))
+			RunScanKernelBenchmark();
+		if (ImGui::IsItemHovered()) ImGui::SetTooltip("Scalar vs SIMD next-scan comparison over 5M synthetic candidates");
+
+		ImGui::SameLine();
+		if (ImGui::Button("Text Search"))
+			RunTextSearchBenchmark();
+		if (ImGui::IsItemHovered()) ImGui::SetTooltip("Scalar vs SIMD case-insensitive search over 100k node names and 100k log lines");
+
+		ImGui::SameLine();
+		if (ImGui::Button("Clear"))
+			results.clear();
+
+		ImGui::Separator();
+
+		if (ImGui::BeginTable("##BenchmarkResults", 2, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg))
+		{
+			ImGui::TableSetupColumn("Benchmark", ImGuiTableColumnFlags_WidthStretch);
+			ImGui::TableSetupColumn("ns / call", ImGuiTableColumnFlags_WidthFixed, 100.0f);
+			ImGui::TableHeadersRow();
+
+			for (const auto& result : results)
+			{
+				ImGui::TableNextRow();
+				ImGui::TableNextColumn();
+				ImGui::TextUnformatted(result.name.c_str());
+				ImGui::TableNextColumn();
+				ImGui::Text("%.2f", result.nsPerCall);
+			}
+
+			ImGui::EndTable();
+		}
+	}
+	ImGui::End();
+}
+
+void Tests::RunExportBenchmark()
+{
+	const auto coreAssembly = UR::Get("UnityEngine.CoreModule.dll");
+	const auto objectClass = coreAssembly ? coreAssembly->Get("Object", "UnityEngine") : nullptr;
+	if (!objectClass || !objectClass->address)
+	{
+		LOG_WARNING("Export benchmark skipped: UnityEngine.Object not resolved");
+		return;
+	}
+
+	void* klass = objectClass->address;
+	const std::string exportName = UR::GetExportName(UR::Export::ClassGetName);
+	const auto classGetName = UR::GetExport<const char*, void*>(UR::Export::ClassGetName);
+	volatile uintptr_t sink = 0;
+
+	const double stringPath = MeasureNsPerCall([&]
+	{
+		sink = sink + reinterpret_cast<uintptr_t>(UR::Invoke<const char*, void*>(exportName, klass));
+	});
+	const double slotPath = MeasureNsPerCall([&]
+	{
+		sink = sink + reinterpret_cast<uintptr_t>(UR::Invoke<const char*, void*>(UR::Export::ClassGetName, klass));
+	});
+	const double pointerPath = MeasureNsPerCall([&]
+	{
+		sink = sink + reinterpret_cast<uintptr_t>(classGetName(klass));
+	});
+
+	results.push_back({exportName + " (string lookup)", stringPath});
+	results.push_back({exportName + " (export slot)", slotPath});
+	results.push_back({exportName + " (function pointer)", pointerPath});
+
+	LOG_INFO("Export benchmark ({} calls): string {:.2f} ns, slot {:.2f} ns, pointer {:.2f} ns", BENCHMARK_ITERATIONS,
+	         stringPath, slotPath, pointerPath);
+}
+
+void Tests::RunScanKernelBenchmark()
+{
+	using ScanKernels::Lane;
+
+	std::vector<ScanField::ValUnion> intCurrent(SCAN_BENCHMARK_CANDIDATES), intLast(SCAN_BENCHMARK_CANDIDATES);
+	std::vector<ScanField::ValUnion> floatCurrent(SCAN_BENCHMARK_CANDIDATES), floatLast(SCAN_BENCHMARK_CANDIDATES);
+
+	uint64_t state = 0x9E3779B97F4A7C15ull;
+	for (size_t i = 0; i < SCAN_BENCHMARK_CANDIDATES; i++)
+	{
+		const uint64_t r = NextRandom(state);
+		intLast[i].i64 = static_cast<int64_t>(r % 1000);
+		intCurrent[i].i64 = intLast[i].i64 + static_cast<int64_t>(r >> 62) - 1;
+
+		floatLast[i].u64 = 0;
+		floatCurrent[i].u64 = 0;
+		floatLast[i].f32 = static_cast<float>(r % 1000) * 0.5f;
+		floatCurrent[i].f32 = floatLast[i].f32 + static_cast<float>(r >> 62) - 1.0f;
+	}
+
+	const size_t maskWords = (SCAN_BENCHMARK_CANDIDATES + ScanKernels::BLOCK_SIZE - 1) / ScanKernels::BLOCK_SIZE;
+	size_t survivors = 0;
+
+	auto measure = [&](auto compare, const Lane lane, const std::vector<ScanField::ValUnion>& current,
+	                   const std::vector<ScanField::ValUnion>& last, std::vector<uint64_t>& mask)
+	{
+		mask.assign(maskWords, 0);
+		const auto start = std::chrono::steady_clock::now();
+		for (size_t begin = 0; begin < SCAN_BENCHMARK_CANDIDATES; begin += ScanKernels::BLOCK_SIZE)
+		{
+			const size_t n = std::min(ScanKernels::BLOCK_SIZE, SCAN_BENCHMARK_CANDIDATES - begin);
+			mask[begin / ScanKernels::BLOCK_SIZE] = compare(lane, ScanComparison::Changed, current.data() + begin,
+			                                                last.data() + begin, ScanField::ValUnion{}, n);
+		}
+		const auto elapsed = std::chrono::steady_clock::now() - start;
+
+		for (const uint64_t word : mask)
+			survivors += std::popcount(word);
+		return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()) /
+			SCAN_BENCHMARK_CANDIDATES;
+	};
+
+	// The scalar kernel is the reference; any word the SIMD kernel sets differently is a kernel bug
+	auto mismatches = [](const std::vector<uint64_t>& expected, const std::vector<uint64_t>& actual)
+	{
+		size_t words = 0;
+		for (size_t i = 0; i < expected.size(); i++)
+			words += expected[i] != actual[i] ? 1 : 0;
+		return words;
+	};
+
+	std::vector<uint64_t> scalarMask, simdMask;
+	const double intScalar = measure(ScanKernels::CompareBlockScalar, Lane::Int64, intCurrent, intLast, scalarMask);
+	const double intSimd = measure(ScanKernels::CompareBlock, Lane::Int64, intCurrent, intLast, simdMask);
+	const size_t intMismatches = mismatches(scalarMask, simdMask);
+	const double floatScalar = measure(ScanKernels::CompareBlockScalar, Lane::Float, floatCurrent, floatLast, scalarMask);
+	const double floatSimd = measure(ScanKernels::CompareBlock, Lane::Float, floatCurrent, floatLast, simdMask);
+	const size_t floatMismatches = mismatches(scalarMask, simdMask);
+
+	const std::string simdName = ScanKernels::HasAvx2() ? "AVX2" : "scalar fallback";
+	const auto mismatchNote = [](const size_t words)
+	{
+		return words ? std::format(" - MISMATCH in {} mask words", words) : std::string();
+	};
+	results.push_back({"Next scan int64 Changed (scalar, per candidate)", intScalar});
+	results.push_back({"Next scan int64 Changed (" + simdName + ", per candidate)" + mismatchNote(intMismatches), intSimd});
+	results.push_back({"Next scan float Changed (scalar, per candidate)", floatScalar});
+	results.push_back({"Next scan float Changed (" + simdName + ", per candidate)" + mismatchNote(floatMismatches), floatSimd});
+
+	LOG_INFO("Scan kernel benchmark ({} candidates, {} survivors): int64 {:.3f} -> {:.3f} ns, float {:.3f} -> {:.3f} ns",
+	         SCAN_BENCHMARK_CANDIDATES, survivors, intScalar, intSimd, floatScalar, floatSimd);
+	if (intMismatches || floatMismatches)
+	{
+		LOG_WARNING("Scan kernel mismatch: {} int64 and {} float mask words differ from the scalar kernel",
+		            intMismatches, floatMismatches);
+	}
+}
+
+void Tests::RunTextSearchBenchmark()
+{
+	static constexpr const char* nameParts[] = {
+		"Player", "Enemy", "Canvas", "Spawner", "Camera", "Light", "Terrain", "Weapon", "HealthBar", "Projectile",
+		"Audio", "Trigger", "Collider", "Pickup", "Door", "Particle", "Minimap", "Inventory", "Button", "Panel"
+	};
+	static constexpr const char* logParts[] = {
+		"Loaded asset bundle", "Failed to resolve reference on", "Spawned", "NullReferenceException in",
+		"Connection established to", "Shader variant compiled for", "Destroying", "Animator state changed on"
+	};
+
+	uint64_t state = 0xD1B54A32D192ED03ull;
+	auto pick = [&](const auto& parts) -> const char*
+	{
+		return parts[NextRandom(state) % std::size(parts)];
+	};
+
+	std::vector<std::string> nodeNames(TEXT_BENCHMARK_STRINGS);
+	for (auto& name : nodeNames)
+		name = std::format("{}_{}{}", pick(nameParts), pick(nameParts), NextRandom(state) % 4 ? "" : " (Clone)");
+
+	std::vector<std::string> logLines(TEXT_BENCHMARK_STRINGS);
+	for (auto& line : logLines)
+	{
+		line = std::format("{} {}/{} at frame {} (instance 0x{:X}) while updating {}", pick(logParts), pick(nameParts),
+		                   pick(nameParts), NextRandom(state) % 100000, NextRandom(state) & 0xFFFFFFFF, pick(nameParts));
+	}
 
-}
\ No newline at end of file
+	size_t matches = 0;
+	auto measure = [&](const std::vector<std::string>& haystacks, size_t& found, auto&& find)
+	{
+		found = 0;
+		const auto start = std::chrono::steady_clock::now();
+		for (int pass = 0; pass < TEXT_BENCHMARK_PASSES; pass++)
+		{
+			for (const auto& haystack : haystacks)
+				found += find(haystack) ? 1 : 0;
+		}
+		const auto elapsed = std::chrono::steady_clock::now() - start;
+		matches += found;
+		return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()) /
+			(static_cast<double>(haystacks.size()) * TEXT_BENCHMARK_PASSES);
+	};
+
+	const std::string simdName = Helper::HasAvx2() ? "AVX2" : "SSE2";
+	for (const std::string_view query : {"spawner", "health", "exception"})
+	{
+		const Helper::SearchNeedle needle(query);
+		size_t nodeScalarMatches, nodeSimdMatches, logScalarMatches, logSimdMatches;
+		const double nodeScalar = measure(nodeNames, nodeScalarMatches, [&](const std::string& s)
+		{
+			return Helper::CaseInsensitiveFindScalar(s, needle.Lower());
+		});
+		const double nodeSimd = measure(nodeNames, nodeSimdMatches, [&](const std::string& s) { return needle.FoundIn(s); });
+		const double logScalar = measure(logLines, logScalarMatches, [&](const std::string& s)
+		{
+			return Helper::CaseInsensitiveFindScalar(s, needle.Lower());
+		});
+		const double logSimd = measure(logLines, logSimdMatches, [&](const std::string& s) { return needle.FoundIn(s); });
+
+		// The scalar search is the reference; a different match count means the SIMD search is wrong
+		const auto mismatchNote = [](const size_t expected, const size_t actual)
+		{
+			return expected != actual ? std::format(" - MISMATCH {} vs {} matches", actual, expected) : std::string();
+		};
+		if (nodeScalarMatches != nodeSimdMatches || logScalarMatches != logSimdMatches)
+		{
+			LOG_WARNING("Text search mismatch for \"{}\": node names {} vs {}, log lines {} vs {} (scalar vs {})", query,
+			            nodeScalarMatches, nodeSimdMatches, logScalarMatches, logSimdMatches, simdName);
+		}
+
+		results.push_back({std::format("Node name \"{}\" (scalar, per string)", query), nodeScalar});
+		results.push_back({std::format("Node name \"{}\" ({}, per string){}", query, simdName,
+		                               mismatchNote(nodeScalarMatches, nodeSimdMatches)), nodeSimd});
+		results.push_back({std::format("Log line \"{}\" (scalar, per string)", query), logScalar});
+		results.push_back({std::format("Log line \"{}\" ({}, per string){}", query, simdName,
+		                               mismatchNote(logScalarMatches, logSimdMatches)), logSimd});
+	}
+
+	LOG_INFO("Text search benchmark ({} names, {} log lines, {} passes, {} matches)", nodeNames.size(), logLines.size(),
+	         TEXT_BENCHMARK_PASSES, matches);
+}
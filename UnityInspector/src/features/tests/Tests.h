@@ -1,9 +1,22 @@
 #pragma once
 #include "features/features.h"
 
+struct BenchmarkResult
+{
+	std::string name;
+	double nsPerCall = 0.0;
+};
+
 class Tests : public IFeature
 {
 public:
 	void Update(float deltaTime) override;
 	void Render() override;
-};
\ No newline at end of file
+
+private:
+	std::vector<BenchmarkResult> results;
+
+	void RunExportBenchmark();
+	void RunScanKernelBenchmark();
+	void RunTextSearchBenchmark();
+};
@@ -2,6 +2,94 @@
 #include "helper.h"
 #include "config/config.h"
 
+#ifdef _DEBUG
+namespace
+{
+	std::atomic<size_t> allocationCount = 0;
+}
+
+void* operator new(const size_t size)
+{
+	allocationCount.fetch_add(1, std::memory_order_relaxed);
+	if (void* p = std::malloc(size ? size : 1))
+		return p;
+	throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept
+{
+	std::free(p);
+}
+
+void operator delete(void* p, size_t) noexcept
+{
+	std::free(p);
+}
+#endif
+
+namespace
+{
+	// Regions VirtualQuery reported on recently. Reads into a region known to be unreadable fail
+	// without raising an exception, and a readable one is only queried again once the entry expires.
+	struct ReadableRegion
+	{
+		uintptr_t begin;
+		uintptr_t end;
+		uint64_t checkedAt;
+		bool readable;
+	};
+
+	constexpr size_t REGION_CACHE_SIZE = 16;
+	constexpr uint64_t REGION_CACHE_TTL_MS = 250;
+
+	thread_local std::array<ReadableRegion, REGION_CACHE_SIZE> regionCache{};
+	thread_local size_t regionCacheNext = 0;
+
+	const ReadableRegion& LookupRegion(const uintptr_t address)
+	{
+		const uint64_t now = GetTickCount64();
+		for (const ReadableRegion& region : regionCache)
+		{
+			if (address >= region.begin && address < region.end && now - region.checkedAt < REGION_CACHE_TTL_MS)
+				return region;
+		}
+
+		ReadableRegion& region = regionCache[regionCacheNext++ % REGION_CACHE_SIZE];
+		region = {address & ~uintptr_t{0xFFF}, (address & ~uintptr_t{0xFFF}) + 0x1000, now, false};
+
+		MEMORY_BASIC_INFORMATION mbi;
+		if (VirtualQuery(reinterpret_cast<void*>(address), &mbi, sizeof(mbi)) == sizeof(mbi))
+		{
+			constexpr DWORD readableMask = PAGE_READONLY | PAGE_READWRITE | PAGE_WRITECOPY | PAGE_EXECUTE_READ |
+				PAGE_EXECUTE_READWRITE | PAGE_EXECUTE_WRITECOPY;
+			region.begin = reinterpret_cast<uintptr_t>(mbi.BaseAddress);
+			region.end = region.begin + mbi.RegionSize;
+			region.readable = mbi.State == MEM_COMMIT && (mbi.Protect & readableMask) &&
+				!(mbi.Protect & (PAGE_GUARD | PAGE_NOACCESS));
+		}
+		return region;
+	}
+
+	void ForgetRegion(const uintptr_t address)
+	{
+		for (ReadableRegion& region : regionCache)
+		{
+			if (address >= region.begin && address < region.end)
+				region.checkedAt = 0;
+		}
+	}
+
+	bool CopyGuarded(void* out, const void* source, const size_t size)
+	{
+		__try
+		{
+			memcpy(out, source, size);
+			return true;
+		}
+		__except (EXCEPTION_EXECUTE_HANDLER) { return false; }
+	}
+}
+
 namespace Helper
 {
 	bool IsValidUserPointer(void* ptr)
@@ -464,6 +552,34 @@ namespace Helper
 		__except (EXCEPTION_EXECUTE_HANDLER) { return false; }
 	}
 
+	bool IsReadableRange(const void* ptr, const size_t size)
+	{
+		if (!IsValidUserPointer(const_cast<void*>(ptr))) return false;
+
+		const auto begin = reinterpret_cast<uintptr_t>(ptr);
+		const uintptr_t end = begin + size;
+		for (uintptr_t address = begin; address < end;)
+		{
+			const ReadableRegion& region = LookupRegion(address);
+			if (!region.readable) return false;
+			address = region.end;
+		}
+		return true;
+	}
+
+	bool SafeReadSpan(const void* ptr, const int offset, const size_t size, void* out)
+	{
+		if (!ptr || offset < 0) return false;
+
+		const auto* source = static_cast<const uint8_t*>(ptr) + offset;
+		if (!IsReadableRange(source, size)) return false;
+		if (CopyGuarded(out, source, size)) return true;
+
+		// Freed since the region was last queried
+		ForgetRegion(reinterpret_cast<uintptr_t>(source));
+		return false;
+	}
+
 	bool SafeGetStaticFieldInt(void* fieldHandle, int& outValue)
 	{
 		if (!fieldHandle) return false;
@@ -471,14 +587,14 @@ namespace Helper
 		{
 			if (Config::state.unityMode == UnityResolve::Mode::Mono)
 			{
-				void* vTable = UR::Invoke<void*, void*, void*>("mono_class_vtable", UR::pDomain,
+				void* vTable = UR::Invoke<void*, void*, void*>(UR::Export::ClassVTable, UR::pDomain,
 				                                               UR::Invoke<void*, void*>(
-					                                               "mono_field_get_parent", fieldHandle));
-				UR::Invoke<void, void*, void*, int*>("mono_field_static_get_value", vTable, fieldHandle, &outValue);
+					                                               UR::Export::FieldGetParent, fieldHandle));
+				UR::Invoke<void, void*, void*, int*>(UR::Export::FieldStaticGetValue, vTable, fieldHandle, &outValue);
 			}
 			else
 			{
-				UR::Invoke<void, void*, int*>("il2cpp_field_static_get_value", fieldHandle, &outValue);
+				UR::Invoke<void, void*, int*>(UR::Export::FieldStaticGetValue, fieldHandle, &outValue);
 			}
 			return true;
 		}
@@ -492,14 +608,14 @@ namespace Helper
 		{
 			if (Config::state.unityMode == UnityResolve::Mode::Mono)
 			{
-				void* vTable = UR::Invoke<void*, void*, void*>("mono_class_vtable", UR::pDomain,
+				void* vTable = UR::Invoke<void*, void*, void*>(UR::Export::ClassVTable, UR::pDomain,
 				                                               UR::Invoke<void*, void*>(
-					                                               "mono_field_get_parent", fieldHandle));
-				UR::Invoke<void, void*, void*, int*>("mono_field_static_set_value", vTable, fieldHandle, &value);
+					                                               UR::Export::FieldGetParent, fieldHandle));
+				UR::Invoke<void, void*, void*, int*>(UR::Export::FieldStaticSetValue, vTable, fieldHandle, &value);
 			}
 			else
 			{
-				UR::Invoke<void, void*, int*>("il2cpp_field_static_set_value", fieldHandle, &value);
+				UR::Invoke<void, void*, int*>(UR::Export::FieldStaticSetValue, fieldHandle, &value);
 			}
 			return true;
 		}
@@ -513,14 +629,14 @@ namespace Helper
 		{
 			if (Config::state.unityMode == UnityResolve::Mode::Mono)
 			{
-				void* vTable = UR::Invoke<void*, void*, void*>("mono_class_vtable", UR::pDomain,
+				void* vTable = UR::Invoke<void*, void*, void*>(UR::Export::ClassVTable, UR::pDomain,
 				                                               UR::Invoke<void*, void*>(
-					                                               "mono_field_get_parent", fieldHandle));
-				UR::Invoke<void, void*, void*, int64_t*>("mono_field_static_get_value", vTable, fieldHandle, &outValue);
+					                                               UR::Export::FieldGetParent, fieldHandle));
+				UR::Invoke<void, void*, void*, int64_t*>(UR::Export::FieldStaticGetValue, vTable, fieldHandle, &outValue);
 			}
 			else
 			{
-				UR::Invoke<void, void*, int64_t*>("il2cpp_field_static_get_value", fieldHandle, &outValue);
+				UR::Invoke<void, void*, int64_t*>(UR::Export::FieldStaticGetValue, fieldHandle, &outValue);
 			}
 			return true;
 		}
@@ -534,14 +650,14 @@ namespace Helper
 		{
 			if (Config::state.unityMode == UnityResolve::Mode::Mono)
 			{
-				void* vTable = UR::Invoke<void*, void*, void*>("mono_class_vtable", UR::pDomain,
+				void* vTable = UR::Invoke<void*, void*, void*>(UR::Export::ClassVTable, UR::pDomain,
 				                                               UR::Invoke<void*, void*>(
-					                                               "mono_field_get_parent", fieldHandle));
-				UR::Invoke<void, void*, void*, int64_t*>("mono_field_static_set_value", vTable, fieldHandle, &value);
+					                                               UR::Export::FieldGetParent, fieldHandle));
+				UR::Invoke<void, void*, void*, int64_t*>(UR::Export::FieldStaticSetValue, vTable, fieldHandle, &value);
 			}
 			else
 			{
-				UR::Invoke<void, void*, int64_t*>("il2cpp_field_static_set_value", fieldHandle, &value);
+				UR::Invoke<void, void*, int64_t*>(UR::Export::FieldStaticSetValue, fieldHandle, &value);
 			}
 			return true;
 		}
@@ -555,15 +671,15 @@ namespace Helper
 		{
 			if (Config::state.unityMode == UnityResolve::Mode::Mono)
 			{
-				void* vTable = UR::Invoke<void*, void*, void*>("mono_class_vtable", UR::pDomain,
+				void* vTable = UR::Invoke<void*, void*, void*>(UR::Export::ClassVTable, UR::pDomain,
 				                                               UR::Invoke<void*, void*>(
-					                                               "mono_field_get_parent", fieldHandle));
+					                                               UR::Export::FieldGetParent, fieldHandle));
 				UR::Invoke<void, void*, void*, uint64_t
-				           *>("mono_field_static_get_value", vTable, fieldHandle, &outValue);
+				           *>(UR::Export::FieldStaticGetValue, vTable, fieldHandle, &outValue);
 			}
 			else
 			{
-				UR::Invoke<void, void*, uint64_t*>("il2cpp_field_static_get_value", fieldHandle, &outValue);
+				UR::Invoke<void, void*, uint64_t*>(UR::Export::FieldStaticGetValue, fieldHandle, &outValue);
 			}
 			return true;
 		}
@@ -577,14 +693,14 @@ namespace Helper
 		{
 			if (Config::state.unityMode == UnityResolve::Mode::Mono)
 			{
-				void* vTable = UR::Invoke<void*, void*, void*>("mono_class_vtable", UR::pDomain,
+				void* vTable = UR::Invoke<void*, void*, void*>(UR::Export::ClassVTable, UR::pDomain,
 				                                               UR::Invoke<void*, void*>(
-					                                               "mono_field_get_parent", fieldHandle));
-				UR::Invoke<void, void*, void*, uint64_t*>("mono_field_static_set_value", vTable, fieldHandle, &value);
+					                                               UR::Export::FieldGetParent, fieldHandle));
+				UR::Invoke<void, void*, void*, uint64_t*>(UR::Export::FieldStaticSetValue, vTable, fieldHandle, &value);
 			}
 			else
 			{
-				UR::Invoke<void, void*, uint64_t*>("il2cpp_field_static_set_value", fieldHandle, &value);
+				UR::Invoke<void, void*, uint64_t*>(UR::Export::FieldStaticSetValue, fieldHandle, &value);
 			}
 			return true;
 		}
@@ -598,14 +714,14 @@ namespace Helper
 		{
 			if (Config::state.unityMode == UnityResolve::Mode::Mono)
 			{
-				void* vTable = UR::Invoke<void*, void*, void*>("mono_class_vtable", UR::pDomain,
+				void* vTable = UR::Invoke<void*, void*, void*>(UR::Export::ClassVTable, UR::pDomain,
 				                                               UR::Invoke<void*, void*>(
-					                                               "mono_field_get_parent", fieldHandle));
-				UR::Invoke<void, void*, void*, uint8_t*>("mono_field_static_get_value", vTable, fieldHandle, &outValue);
+					                                               UR::Export::FieldGetParent, fieldHandle));
+				UR::Invoke<void, void*, void*, uint8_t*>(UR::Export::FieldStaticGetValue, vTable, fieldHandle, &outValue);
 			}
 			else
 			{
-				UR::Invoke<void, void*, uint8_t*>("il2cpp_field_static_get_value", fieldHandle, &outValue);
+				UR::Invoke<void, void*, uint8_t*>(UR::Export::FieldStaticGetValue, fieldHandle, &outValue);
 			}
 			return true;
 		}
@@ -619,14 +735,14 @@ namespace Helper
 		{
 			if (Config::state.unityMode == UnityResolve::Mode::Mono)
 			{
-				void* vTable = UR::Invoke<void*, void*, void*>("mono_class_vtable", UR::pDomain,
+				void* vTable = UR::Invoke<void*, void*, void*>(UR::Export::ClassVTable, UR::pDomain,
 				                                               UR::Invoke<void*, void*>(
-					                                               "mono_field_get_parent", fieldHandle));
-				UR::Invoke<void, void*, void*, uint8_t*>("mono_field_static_set_value", vTable, fieldHandle, &value);
+					                                               UR::Export::FieldGetParent, fieldHandle));
+				UR::Invoke<void, void*, void*, uint8_t*>(UR::Export::FieldStaticSetValue, vTable, fieldHandle, &value);
 			}
 			else
 			{
-				UR::Invoke<void, void*, uint8_t*>("il2cpp_field_static_set_value", fieldHandle, &value);
+				UR::Invoke<void, void*, uint8_t*>(UR::Export::FieldStaticSetValue, fieldHandle, &value);
 			}
 			return true;
 		}
@@ -640,14 +756,14 @@ namespace Helper
 		{
 			if (Config::state.unityMode == UnityResolve::Mode::Mono)
 			{
-				void* vTable = UR::Invoke<void*, void*, void*>("mono_class_vtable", UR::pDomain,
+				void* vTable = UR::Invoke<void*, void*, void*>(UR::Export::ClassVTable, UR::pDomain,
 				                                               UR::Invoke<void*, void*>(
-					                                               "mono_field_get_parent", fieldHandle));
-				UR::Invoke<void, void*, void*, int8_t*>("mono_field_static_get_value", vTable, fieldHandle, &outValue);
+					                                               UR::Export::FieldGetParent, fieldHandle));
+				UR::Invoke<void, void*, void*, int8_t*>(UR::Export::FieldStaticGetValue, vTable, fieldHandle, &outValue);
 			}
 			else
 			{
-				UR::Invoke<void, void*, int8_t*>("il2cpp_field_static_get_value", fieldHandle, &outValue);
+				UR::Invoke<void, void*, int8_t*>(UR::Export::FieldStaticGetValue, fieldHandle, &outValue);
 			}
 			return true;
 		}
@@ -661,14 +777,14 @@ namespace Helper
 		{
 			if (Config::state.unityMode == UnityResolve::Mode::Mono)
 			{
-				void* vTable = UR::Invoke<void*, void*, void*>("mono_class_vtable", UR::pDomain,
+				void* vTable = UR::Invoke<void*, void*, void*>(UR::Export::ClassVTable, UR::pDomain,
 				                                               UR::Invoke<void*, void*>(
-					                                               "mono_field_get_parent", fieldHandle));
-				UR::Invoke<void, void*, void*, int8_t*>("mono_field_static_set_value", vTable, fieldHandle, &value);
+					                                               UR::Export::FieldGetParent, fieldHandle));
+				UR::Invoke<void, void*, void*, int8_t*>(UR::Export::FieldStaticSetValue, vTable, fieldHandle, &value);
 			}
 			else
 			{
-				UR::Invoke<void, void*, int8_t*>("il2cpp_field_static_set_value", fieldHandle, &value);
+				UR::Invoke<void, void*, int8_t*>(UR::Export::FieldStaticSetValue, fieldHandle, &value);
 			}
 			return true;
 		}
@@ -682,14 +798,14 @@ namespace Helper
 		{
 			if (Config::state.unityMode == UnityResolve::Mode::Mono)
 			{
-				void* vTable = UR::Invoke<void*, void*, void*>("mono_class_vtable", UR::pDomain,
+				void* vTable = UR::Invoke<void*, void*, void*>(UR::Export::ClassVTable, UR::pDomain,
 				                                               UR::Invoke<void*, void*>(
-					                                               "mono_field_get_parent", fieldHandle));
-				UR::Invoke<void, void*, void*, int16_t*>("mono_field_static_get_value", vTable, fieldHandle, &outValue);
+					                                               UR::Export::FieldGetParent, fieldHandle));
+				UR::Invoke<void, void*, void*, int16_t*>(UR::Export::FieldStaticGetValue, vTable, fieldHandle, &outValue);
 			}
 			else
 			{
-				UR::Invoke<void, void*, int16_t*>("il2cpp_field_static_get_value", fieldHandle, &outValue);
+				UR::Invoke<void, void*, int16_t*>(UR::Export::FieldStaticGetValue, fieldHandle, &outValue);
 			}
 			return true;
 		}
@@ -703,14 +819,14 @@ namespace Helper
 		{
 			if (Config::state.unityMode == UnityResolve::Mode::Mono)
 			{
-				void* vTable = UR::Invoke<void*, void*, void*>("mono_class_vtable", UR::pDomain,
+				void* vTable = UR::Invoke<void*, void*, void*>(UR::Export::ClassVTable, UR::pDomain,
 				                                               UR::Invoke<void*, void*>(
-					                                               "mono_field_get_parent", fieldHandle));
-				UR::Invoke<void, void*, void*, int16_t*>("mono_field_static_set_value", vTable, fieldHandle, &value);
+					                                               UR::Export::FieldGetParent, fieldHandle));
+				UR::Invoke<void, void*, void*, int16_t*>(UR::Export::FieldStaticSetValue, vTable, fieldHandle, &value);
 			}
 			else
 			{
-				UR::Invoke<void, void*, int16_t*>("il2cpp_field_static_set_value", fieldHandle, &value);
+				UR::Invoke<void, void*, int16_t*>(UR::Export::FieldStaticSetValue, fieldHandle, &value);
 			}
 			return true;
 		}
@@ -724,15 +840,15 @@ namespace Helper
 		{
 			if (Config::state.unityMode == UnityResolve::Mode::Mono)
 			{
-				void* vTable = UR::Invoke<void*, void*, void*>("mono_class_vtable", UR::pDomain,
+				void* vTable = UR::Invoke<void*, void*, void*>(UR::Export::ClassVTable, UR::pDomain,
 				                                               UR::Invoke<void*, void*>(
-					                                               "mono_field_get_parent", fieldHandle));
+					                                               UR::Export::FieldGetParent, fieldHandle));
 				UR::Invoke<void, void*, void*, uint16_t
-				           *>("mono_field_static_get_value", vTable, fieldHandle, &outValue);
+				           *>(UR::Export::FieldStaticGetValue, vTable, fieldHandle, &outValue);
 			}
 			else
 			{
-				UR::Invoke<void, void*, uint16_t*>("il2cpp_field_static_get_value", fieldHandle, &outValue);
+				UR::Invoke<void, void*, uint16_t*>(UR::Export::FieldStaticGetValue, fieldHandle, &outValue);
 			}
 			return true;
 		}
@@ -746,14 +862,14 @@ namespace Helper
 		{
 			if (Config::state.unityMode == UnityResolve::Mode::Mono)
 			{
-				void* vTable = UR::Invoke<void*, void*, void*>("mono_class_vtable", UR::pDomain,
+				void* vTable = UR::Invoke<void*, void*, void*>(UR::Export::ClassVTable, UR::pDomain,
 				                                               UR::Invoke<void*, void*>(
-					                                               "mono_field_get_parent", fieldHandle));
-				UR::Invoke<void, void*, void*, uint16_t*>("mono_field_static_set_value", vTable, fieldHandle, &value);
+					                                               UR::Export::FieldGetParent, fieldHandle));
+				UR::Invoke<void, void*, void*, uint16_t*>(UR::Export::FieldStaticSetValue, vTable, fieldHandle, &value);
 			}
 			else
 			{
-				UR::Invoke<void, void*, uint16_t*>("il2cpp_field_static_set_value", fieldHandle, &value);
+				UR::Invoke<void, void*, uint16_t*>(UR::Export::FieldStaticSetValue, fieldHandle, &value);
 			}
 			return true;
 		}
@@ -767,15 +883,15 @@ namespace Helper
 		{
 			if (Config::state.unityMode == UnityResolve::Mode::Mono)
 			{
-				void* vTable = UR::Invoke<void*, void*, void*>("mono_class_vtable", UR::pDomain,
+				void* vTable = UR::Invoke<void*, void*, void*>(UR::Export::ClassVTable, UR::pDomain,
 				                                               UR::Invoke<void*, void*>(
-					                                               "mono_field_get_parent", fieldHandle));
+					                                               UR::Export::FieldGetParent, fieldHandle));
 				UR::Invoke<void, void*, void*, char16_t
-				           *>("mono_field_static_get_value", vTable, fieldHandle, &outValue);
+				           *>(UR::Export::FieldStaticGetValue, vTable, fieldHandle, &outValue);
 			}
 			else
 			{
-				UR::Invoke<void, void*, char16_t*>("il2cpp_field_static_get_value", fieldHandle, &outValue);
+				UR::Invoke<void, void*, char16_t*>(UR::Export::FieldStaticGetValue, fieldHandle, &outValue);
 			}
 			return true;
 		}
@@ -789,14 +905,14 @@ namespace Helper
 		{
 			if (Config::state.unityMode == UnityResolve::Mode::Mono)
 			{
-				void* vTable = UR::Invoke<void*, void*, void*>("mono_class_vtable", UR::pDomain,
+				void* vTable = UR::Invoke<void*, void*, void*>(UR::Export::ClassVTable, UR::pDomain,
 				                                               UR::Invoke<void*, void*>(
-					                                               "mono_field_get_parent", fieldHandle));
-				UR::Invoke<void, void*, void*, char16_t*>("mono_field_static_set_value", vTable, fieldHandle, &value);
+					                                               UR::Export::FieldGetParent, fieldHandle));
+				UR::Invoke<void, void*, void*, char16_t*>(UR::Export::FieldStaticSetValue, vTable, fieldHandle, &value);
 			}
 			else
 			{
-				UR::Invoke<void, void*, char16_t*>("il2cpp_field_static_set_value", fieldHandle, &value);
+				UR::Invoke<void, void*, char16_t*>(UR::Export::FieldStaticSetValue, fieldHandle, &value);
 			}
 			return true;
 		}
@@ -810,14 +926,14 @@ namespace Helper
 		{
 			if (Config::state.unityMode == UnityResolve::Mode::Mono)
 			{
-				void* vTable = UR::Invoke<void*, void*, void*>("mono_class_vtable", UR::pDomain,
+				void* vTable = UR::Invoke<void*, void*, void*>(UR::Export::ClassVTable, UR::pDomain,
 				                                               UR::Invoke<void*, void*>(
-					                                               "mono_field_get_parent", fieldHandle));
-				UR::Invoke<void, void*, void*, float*>("mono_field_static_get_value", vTable, fieldHandle, &outValue);
+					                                               UR::Export::FieldGetParent, fieldHandle));
+				UR::Invoke<void, void*, void*, float*>(UR::Export::FieldStaticGetValue, vTable, fieldHandle, &outValue);
 			}
 			else
 			{
-				UR::Invoke<void, void*, float*>("il2cpp_field_static_get_value", fieldHandle, &outValue);
+				UR::Invoke<void, void*, float*>(UR::Export::FieldStaticGetValue, fieldHandle, &outValue);
 			}
 			return true;
 		}
@@ -831,14 +947,14 @@ namespace Helper
 		{
 			if (Config::state.unityMode == UnityResolve::Mode::Mono)
 			{
-				void* vTable = UR::Invoke<void*, void*, void*>("mono_class_vtable", UR::pDomain,
+				void* vTable = UR::Invoke<void*, void*, void*>(UR::Export::ClassVTable, UR::pDomain,
 				                                               UR::Invoke<void*, void*>(
-					                                               "mono_field_get_parent", fieldHandle));
-				UR::Invoke<void, void*, void*, float*>("mono_field_static_set_value", vTable, fieldHandle, &value);
+					                                               UR::Export::FieldGetParent, fieldHandle));
+				UR::Invoke<void, void*, void*, float*>(UR::Export::FieldStaticSetValue, vTable, fieldHandle, &value);
 			}
 			else
 			{
-				UR::Invoke<void, void*, float*>("il2cpp_field_static_set_value", fieldHandle, &value);
+				UR::Invoke<void, void*, float*>(UR::Export::FieldStaticSetValue, fieldHandle, &value);
 			}
 			return true;
 		}
@@ -855,14 +971,14 @@ namespace Helper
 		{
 			if (Config::state.unityMode == UnityResolve::Mode::Mono)
 			{
-				void* vTable = UR::Invoke<void*, void*, void*>("mono_class_vtable", UR::pDomain,
+				void* vTable = UR::Invoke<void*, void*, void*>(UR::Export::ClassVTable, UR::pDomain,
 				                                               UR::Invoke<void*, void*>(
-					                                               "mono_field_get_parent", fieldHandle));
-				UR::Invoke<void, void*, void*, bool*>("mono_field_static_get_value", vTable, fieldHandle, &outValue);
+					                                               UR::Export::FieldGetParent, fieldHandle));
+				UR::Invoke<void, void*, void*, bool*>(UR::Export::FieldStaticGetValue, vTable, fieldHandle, &outValue);
 			}
 			else
 			{
-				UR::Invoke<void, void*, bool*>("il2cpp_field_static_get_value", fieldHandle, &outValue);
+				UR::Invoke<void, void*, bool*>(UR::Export::FieldStaticGetValue, fieldHandle, &outValue);
 			}
 			return true;
 		}
@@ -876,14 +992,14 @@ namespace Helper
 		{
 			if (Config::state.unityMode == UnityResolve::Mode::Mono)
 			{
-				void* vTable = UR::Invoke<void*, void*, void*>("mono_class_vtable", UR::pDomain,
+				void* vTable = UR::Invoke<void*, void*, void*>(UR::Export::ClassVTable, UR::pDomain,
 				                                               UR::Invoke<void*, void*>(
-					                                               "mono_field_get_parent", fieldHandle));
-				UR::Invoke<void, void*, void*, bool*>("mono_field_static_set_value", vTable, fieldHandle, &value);
+					                                               UR::Export::FieldGetParent, fieldHandle));
+				UR::Invoke<void, void*, void*, bool*>(UR::Export::FieldStaticSetValue, vTable, fieldHandle, &value);
 			}
 			else
 			{
-				UR::Invoke<void, void*, bool*>("il2cpp_field_static_set_value", fieldHandle, &value);
+				UR::Invoke<void, void*, bool*>(UR::Export::FieldStaticSetValue, fieldHandle, &value);
 			}
 			return true;
 		}
@@ -897,14 +1013,14 @@ namespace Helper
 		{
 			if (Config::state.unityMode == UnityResolve::Mode::Mono)
 			{
-				void* vTable = UR::Invoke<void*, void*, void*>("mono_class_vtable", UR::pDomain,
+				void* vTable = UR::Invoke<void*, void*, void*>(UR::Export::ClassVTable, UR::pDomain,
 				                                               UR::Invoke<void*, void*>(
-					                                               "mono_field_get_parent", fieldHandle));
-				UR::Invoke<void, void*, void*, double*>("mono_field_static_get_value", vTable, fieldHandle, &outValue);
+					                                               UR::Export::FieldGetParent, fieldHandle));
+				UR::Invoke<void, void*, void*, double*>(UR::Export::FieldStaticGetValue, vTable, fieldHandle, &outValue);
 			}
 			else
 			{
-				UR::Invoke<void, void*, double*>("il2cpp_field_static_get_value", fieldHandle, &outValue);
+				UR::Invoke<void, void*, double*>(UR::Export::FieldStaticGetValue, fieldHandle, &outValue);
 			}
 			return true;
 		}
@@ -918,14 +1034,14 @@ namespace Helper
 		{
 			if (Config::state.unityMode == UnityResolve::Mode::Mono)
 			{
-				void* vTable = UR::Invoke<void*, void*, void*>("mono_class_vtable", UR::pDomain,
+				void* vTable = UR::Invoke<void*, void*, void*>(UR::Export::ClassVTable, UR::pDomain,
 				                                               UR::Invoke<void*, void*>(
-					                                               "mono_field_get_parent", fieldHandle));
-				UR::Invoke<void, void*, void*, double*>("mono_field_static_set_value", vTable, fieldHandle, &value);
+					                                               UR::Export::FieldGetParent, fieldHandle));
+				UR::Invoke<void, void*, void*, double*>(UR::Export::FieldStaticSetValue, vTable, fieldHandle, &value);
 			}
 			else
 			{
-				UR::Invoke<void, void*, double*>("il2cpp_field_static_set_value", fieldHandle, &value);
+				UR::Invoke<void, void*, double*>(UR::Export::FieldStaticSetValue, fieldHandle, &value);
 			}
 			return true;
 		}
@@ -939,14 +1055,14 @@ namespace Helper
 		{
 			if (Config::state.unityMode == UnityResolve::Mode::Mono)
 			{
-				void* vTable = UR::Invoke<void*, void*, void*>("mono_class_vtable", UR::pDomain,
+				void* vTable = UR::Invoke<void*, void*, void*>(UR::Export::ClassVTable, UR::pDomain,
 				                                               UR::Invoke<void*, void*>(
-					                                               "mono_field_get_parent", fieldHandle));
-				UR::Invoke<void, void*, void*, Vec3*>("mono_field_static_get_value", vTable, fieldHandle, &outValue);
+					                                               UR::Export::FieldGetParent, fieldHandle));
+				UR::Invoke<void, void*, void*, Vec3*>(UR::Export::FieldStaticGetValue, vTable, fieldHandle, &outValue);
 			}
 			else
 			{
-				UR::Invoke<void, void*, Vec3*>("il2cpp_field_static_get_value", fieldHandle, &outValue);
+				UR::Invoke<void, void*, Vec3*>(UR::Export::FieldStaticGetValue, fieldHandle, &outValue);
 			}
 			return true;
 		}
@@ -961,14 +1077,14 @@ namespace Helper
 			Vec3 v = value;
 			if (Config::state.unityMode == UnityResolve::Mode::Mono)
 			{
-				void* vTable = UR::Invoke<void*, void*, void*>("mono_class_vtable", UR::pDomain,
+				void* vTable = UR::Invoke<void*, void*, void*>(UR::Export::ClassVTable, UR::pDomain,
 				                                               UR::Invoke<void*, void*>(
-					                                               "mono_field_get_parent", fieldHandle));
-				UR::Invoke<void, void*, void*, Vec3*>("mono_field_static_set_value", vTable, fieldHandle, &v);
+					                                               UR::Export::FieldGetParent, fieldHandle));
+				UR::Invoke<void, void*, void*, Vec3*>(UR::Export::FieldStaticSetValue, vTable, fieldHandle, &v);
 			}
 			else
 			{
-				UR::Invoke<void, void*, Vec3*>("il2cpp_field_static_set_value", fieldHandle, &v);
+				UR::Invoke<void, void*, Vec3*>(UR::Export::FieldStaticSetValue, fieldHandle, &v);
 			}
 			return true;
 		}
@@ -982,14 +1098,14 @@ namespace Helper
 		{
 			if (Config::state.unityMode == UnityResolve::Mode::Mono)
 			{
-				void* vTable = UR::Invoke<void*, void*, void*>("mono_class_vtable", UR::pDomain,
+				void* vTable = UR::Invoke<void*, void*, void*>(UR::Export::ClassVTable, UR::pDomain,
 				                                               UR::Invoke<void*, void*>(
-					                                               "mono_field_get_parent", fieldHandle));
-				UR::Invoke<void, void*, void*, Vec2*>("mono_field_static_get_value", vTable, fieldHandle, &outValue);
+					                                               UR::Export::FieldGetParent, fieldHandle));
+				UR::Invoke<void, void*, void*, Vec2*>(UR::Export::FieldStaticGetValue, vTable, fieldHandle, &outValue);
 			}
 			else
 			{
-				UR::Invoke<void, void*, Vec2*>("il2cpp_field_static_get_value", fieldHandle, &outValue);
+				UR::Invoke<void, void*, Vec2*>(UR::Export::FieldStaticGetValue, fieldHandle, &outValue);
 			}
 			return true;
 		}
@@ -1004,14 +1120,14 @@ namespace Helper
 			Vec2 v = value;
 			if (Config::state.unityMode == UnityResolve::Mode::Mono)
 			{
-				void* vTable = UR::Invoke<void*, void*, void*>("mono_class_vtable", UR::pDomain,
+				void* vTable = UR::Invoke<void*, void*, void*>(UR::Export::ClassVTable, UR::pDomain,
 				                                               UR::Invoke<void*, void*>(
-					                                               "mono_field_get_parent", fieldHandle));
-				UR::Invoke<void, void*, void*, Vec2*>("mono_field_static_set_value", vTable, fieldHandle, &v);
+					                                               UR::Export::FieldGetParent, fieldHandle));
+				UR::Invoke<void, void*, void*, Vec2*>(UR::Export::FieldStaticSetValue, vTable, fieldHandle, &v);
 			}
 			else
 			{
-				UR::Invoke<void, void*, Vec2*>("il2cpp_field_static_set_value", fieldHandle, &v);
+				UR::Invoke<void, void*, Vec2*>(UR::Export::FieldStaticSetValue, fieldHandle, &v);
 			}
 			return true;
 		}
@@ -1025,14 +1141,14 @@ namespace Helper
 		{
 			if (Config::state.unityMode == UnityResolve::Mode::Mono)
 			{
-				void* vTable = UR::Invoke<void*, void*, void*>("mono_class_vtable", UR::pDomain,
+				void* vTable = UR::Invoke<void*, void*, void*>(UR::Export::ClassVTable, UR::pDomain,
 				                                               UR::Invoke<void*, void*>(
-					                                               "mono_field_get_parent", fieldHandle));
-				UR::Invoke<void, void*, void*, Vec4*>("mono_field_static_get_value", vTable, fieldHandle, &outValue);
+					                                               UR::Export::FieldGetParent, fieldHandle));
+				UR::Invoke<void, void*, void*, Vec4*>(UR::Export::FieldStaticGetValue, vTable, fieldHandle, &outValue);
 			}
 			else
 			{
-				UR::Invoke<void, void*, Vec4*>("il2cpp_field_static_get_value", fieldHandle, &outValue);
+				UR::Invoke<void, void*, Vec4*>(UR::Export::FieldStaticGetValue, fieldHandle, &outValue);
 			}
 			return true;
 		}
@@ -1047,14 +1163,14 @@ namespace Helper
 			Vec4 v = value;
 			if (Config::state.unityMode == UnityResolve::Mode::Mono)
 			{
-				void* vTable = UR::Invoke<void*, void*, void*>("mono_class_vtable", UR::pDomain,
+				void* vTable = UR::Invoke<void*, void*, void*>(UR::Export::ClassVTable, UR::pDomain,
 				                                               UR::Invoke<void*, void*>(
-					                                               "mono_field_get_parent", fieldHandle));
-				UR::Invoke<void, void*, void*, Vec4*>("mono_field_static_set_value", vTable, fieldHandle, &v);
+					                                               UR::Export::FieldGetParent, fieldHandle));
+				UR::Invoke<void, void*, void*, Vec4*>(UR::Export::FieldStaticSetValue, vTable, fieldHandle, &v);
 			}
 			else
 			{
-				UR::Invoke<void, void*, Vec4*>("il2cpp_field_static_set_value", fieldHandle, &v);
+				UR::Invoke<void, void*, Vec4*>(UR::Export::FieldStaticSetValue, fieldHandle, &v);
 			}
 			return true;
 		}
@@ -1068,14 +1184,14 @@ namespace Helper
 		{
 			if (Config::state.unityMode == UnityResolve::Mode::Mono)
 			{
-				void* vTable = UR::Invoke<void*, void*, void*>("mono_class_vtable", UR::pDomain,
+				void* vTable = UR::Invoke<void*, void*, void*>(UR::Export::ClassVTable, UR::pDomain,
 				                                               UR::Invoke<void*, void*>(
-					                                               "mono_field_get_parent", fieldHandle));
-				UR::Invoke<void, void*, void*, Quat*>("mono_field_static_get_value", vTable, fieldHandle, &outValue);
+					                                               UR::Export::FieldGetParent, fieldHandle));
+				UR::Invoke<void, void*, void*, Quat*>(UR::Export::FieldStaticGetValue, vTable, fieldHandle, &outValue);
 			}
 			else
 			{
-				UR::Invoke<void, void*, Quat*>("il2cpp_field_static_get_value", fieldHandle, &outValue);
+				UR::Invoke<void, void*, Quat*>(UR::Export::FieldStaticGetValue, fieldHandle, &outValue);
 			}
 			return true;
 		}
@@ -1090,14 +1206,14 @@ namespace Helper
 			Quat v = value;
 			if (Config::state.unityMode == UnityResolve::Mode::Mono)
 			{
-				void* vTable = UR::Invoke<void*, void*, void*>("mono_class_vtable", UR::pDomain,
+				void* vTable = UR::Invoke<void*, void*, void*>(UR::Export::ClassVTable, UR::pDomain,
 				                                               UR::Invoke<void*, void*>(
-					                                               "mono_field_get_parent", fieldHandle));
-				UR::Invoke<void, void*, void*, Quat*>("mono_field_static_set_value", vTable, fieldHandle, &v);
+					                                               UR::Export::FieldGetParent, fieldHandle));
+				UR::Invoke<void, void*, void*, Quat*>(UR::Export::FieldStaticSetValue, vTable, fieldHandle, &v);
 			}
 			else
 			{
-				UR::Invoke<void, void*, Quat*>("il2cpp_field_static_set_value", fieldHandle, &v);
+				UR::Invoke<void, void*, Quat*>(UR::Export::FieldStaticSetValue, fieldHandle, &v);
 			}
 			return true;
 		}
@@ -1111,14 +1227,14 @@ namespace Helper
 		{
 			if (Config::state.unityMode == UnityResolve::Mode::Mono)
 			{
-				void* vTable = UR::Invoke<void*, void*, void*>("mono_class_vtable", UR::pDomain,
+				void* vTable = UR::Invoke<void*, void*, void*>(UR::Export::ClassVTable, UR::pDomain,
 				                                               UR::Invoke<void*, void*>(
-					                                               "mono_field_get_parent", fieldHandle));
-				UR::Invoke<void, void*, void*, Color*>("mono_field_static_get_value", vTable, fieldHandle, &outValue);
+					                                               UR::Export::FieldGetParent, fieldHandle));
+				UR::Invoke<void, void*, void*, Color*>(UR::Export::FieldStaticGetValue, vTable, fieldHandle, &outValue);
 			}
 			else
 			{
-				UR::Invoke<void, void*, Color*>("il2cpp_field_static_get_value", fieldHandle, &outValue);
+				UR::Invoke<void, void*, Color*>(UR::Export::FieldStaticGetValue, fieldHandle, &outValue);
 			}
 			return true;
 		}
@@ -1133,14 +1249,14 @@ namespace Helper
 			Color v = value;
 			if (Config::state.unityMode == UnityResolve::Mode::Mono)
 			{
-				void* vTable = UR::Invoke<void*, void*, void*>("mono_class_vtable", UR::pDomain,
+				void* vTable = UR::Invoke<void*, void*, void*>(UR::Export::ClassVTable, UR::pDomain,
 				                                               UR::Invoke<void*, void*>(
-					                                               "mono_field_get_parent", fieldHandle));
-				UR::Invoke<void, void*, void*, Color*>("mono_field_static_set_value", vTable, fieldHandle, &v);
+					                                               UR::Export::FieldGetParent, fieldHandle));
+				UR::Invoke<void, void*, void*, Color*>(UR::Export::FieldStaticSetValue, vTable, fieldHandle, &v);
 			}
 			else
 			{
-				UR::Invoke<void, void*, Color*>("il2cpp_field_static_set_value", fieldHandle, &v);
+				UR::Invoke<void, void*, Color*>(UR::Export::FieldStaticSetValue, fieldHandle, &v);
 			}
 			return true;
 		}
@@ -1165,14 +1281,14 @@ namespace Helper
 
 		if (Config::state.unityMode == UnityResolve::Mode::Mono)
 		{
-			void* vTable = UR::Invoke<void*, void*, void*>("mono_class_vtable", UR::pDomain,
+			void* vTable = UR::Invoke<void*, void*, void*>(UR::Export::ClassVTable, UR::pDomain,
 			                                               UR::Invoke<void*, void*>(
-				                                               "mono_field_get_parent", fieldHandle));
-			UR::Invoke<void, void*, void*, void*>("mono_field_static_get_value", vTable, fieldHandle, safeBuffer);
+				                                               UR::Export::FieldGetParent, fieldHandle));
+			UR::Invoke<void, void*, void*, void*>(UR::Export::FieldStaticGetValue, vTable, fieldHandle, safeBuffer);
 		}
 		else
 		{
-			UR::Invoke<void, void*, void*>("il2cpp_field_static_get_value", fieldHandle, safeBuffer);
+			UR::Invoke<void, void*, void*>(UR::Export::FieldStaticGetValue, fieldHandle, safeBuffer);
 		}
 
 		outValue = *reinterpret_cast<void**>(safeBuffer);
@@ -1189,13 +1305,9 @@ namespace Helper
 		__except (EXCEPTION_EXECUTE_HANDLER) { return false; }
 	}
 
-	__declspec(noinline) void* DoGetObjectClass(void* obj, bool isMono)
+	__declspec(noinline) void* DoGetObjectClass(void* obj)
 	{
-		if (isMono)
-		{
-			return UR::Invoke<void*, void*>("mono_object_get_class", obj);
-		}
-		return UR::Invoke<void*, void*>("il2cpp_object_get_class", obj);
+		return UR::Invoke<void*, void*>(UR::Export::ObjectGetClass, obj);
 	}
 
 	void* SafeGetObjectClass(void* obj)
@@ -1203,26 +1315,20 @@ namespace Helper
 		if (!IsValidReadPtr(obj)) return nullptr;
 		__try
 		{
-			return DoGetObjectClass(obj, Config::state.unityMode == UnityResolve::Mode::Mono);
+			return DoGetObjectClass(obj);
 		}
 		__except (EXCEPTION_EXECUTE_HANDLER) { return nullptr; }
 	}
 
 	__declspec(noinline) void* DoSafeInvokeGetter(void* obj, void* methodHandle)
 	{
-		if (Config::state.unityMode == UnityResolve::Mode::Mono)
-		{
-			return UR::Invoke<void*, void*, void*, void**, void*>("mono_runtime_invoke", methodHandle, obj, nullptr,
-			                                                      nullptr);
-		}
-		return UR::Invoke<void*, void*, void*, void**, void*>("il2cpp_runtime_invoke", methodHandle, obj, nullptr,
+		return UR::Invoke<void*, void*, void*, void**, void*>(UR::Export::RuntimeInvoke, methodHandle, obj, nullptr,
 		                                                      nullptr);
 	}
 
 	__declspec(noinline) void* DoSafeUnbox(void* result)
 	{
-		return UR::Invoke<void*, void*>(
-			Config::state.unityMode == UnityResolve::Mode::Mono ? "mono_object_unbox" : "il2cpp_object_unbox", result);
+		return UR::Invoke<void*, void*>(UR::Export::ObjectUnbox, result);
 	}
 
 	bool SafeInvokeGetter(void* obj, void* methodHandle, void* outValue, int valueSize)
@@ -1256,14 +1362,7 @@ namespace Helper
 	__declspec(noinline) void DoSafeInvokeSetter(void* obj, void* methodHandle, void* value)
 	{
 		void* params[1] = {value};
-		if (Config::state.unityMode == UnityResolve::Mode::Mono)
-		{
-			UR::Invoke<void*, void*, void*, void**, void*>("mono_runtime_invoke", methodHandle, obj, params, nullptr);
-		}
-		else
-		{
-			UR::Invoke<void*, void*, void*, void**, void*>("il2cpp_runtime_invoke", methodHandle, obj, params, nullptr);
-		}
+		UR::Invoke<void*, void*, void*, void**, void*>(UR::Export::RuntimeInvoke, methodHandle, obj, params, nullptr);
 	}
 
 	bool SafeInvokeSetter(void* obj, void* methodHandle, void* value)
@@ -1279,12 +1378,7 @@ namespace Helper
 
 	__declspec(noinline) void* DoSafeInvokeMethod(void* obj, void* methodHandle, void** params)
 	{
-		if (Config::state.unityMode == UnityResolve::Mode::Mono)
-		{
-			return UR::Invoke<void*, void*, void*, void**, void*>("mono_runtime_invoke", methodHandle, obj, params,
-			                                                      nullptr);
-		}
-		return UR::Invoke<void*, void*, void*, void**, void*>("il2cpp_runtime_invoke", methodHandle, obj, params,
+		return UR::Invoke<void*, void*, void*, void**, void*>(UR::Export::RuntimeInvoke, methodHandle, obj, params,
 		                                                      nullptr);
 	}
 
@@ -1423,7 +1517,25 @@ namespace Helper
 		if (!obj || !componentClass) return false;
 		try
 		{
-			outComponents = obj->GetComponents<UT::Component*>(componentClass);
+			// Same call as GameObject::GetComponents, but copied straight out of the managed array so a caller
+			// that keeps its vector between calls does not allocate once the capacity has grown to fit. The
+			// lookup builds std::string keys, so it is only done once.
+			static UR::Method* method = nullptr;
+			if (!method)
+			{
+				const auto coreModule = UR::Get("UnityEngine.CoreModule.dll");
+				const auto gameObjectClass = coreModule ? coreModule->Get("GameObject") : nullptr;
+				method = gameObjectClass ? gameObjectClass->Get<UR::Method>("GetComponentsInternal") : nullptr;
+				if (!method) return false;
+			}
+
+			const auto components = method->Invoke<UT::Array<UT::Component*>*>(
+				obj, componentClass->GetType(), false, false, true, false, static_cast<UT::List<UT::Component*>*>(nullptr));
+			if (components)
+			{
+				for (uintptr_t i = 0; i < components->max_length; i++)
+					outComponents.push_back(components->At(static_cast<unsigned int>(i)));
+			}
 			return true;
 		}
 		catch (...)
@@ -1734,27 +1846,27 @@ namespace Helper
 			void* iter = nullptr;
 			void* method;
 			while ((method = UR::Invoke<void*, void*, void*>(
-				mono ? "mono_class_get_methods" : "il2cpp_class_get_methods", currentClass, &iter)))
+				UR::Export::ClassGetMethods, currentClass, &iter)))
 			{
 				const char* name = UR::Invoke<const char*, void*>(
-					mono ? "mono_method_get_name" : "il2cpp_method_get_name", method);
+					UR::Export::MethodGetName, method);
 				if (name && strcmp(name, methodName) == 0)
 				{
 					if (paramCount < 0) return method;
 					int actualParamCount = 0;
 					if (mono)
 					{
-						if (void* sig = UR::Invoke<void*, void*>("mono_method_signature", method))
-							actualParamCount = UR::Invoke<int, void*>("mono_signature_get_param_count", sig);
+						if (void* sig = UR::Invoke<void*, void*>(UR::Export::MethodSignature, method))
+							actualParamCount = UR::Invoke<int, void*>(UR::Export::SignatureGetParamCount, sig);
 					}
 					else
 					{
-						actualParamCount = UR::Invoke<int, void*>("il2cpp_method_get_param_count", method);
+						actualParamCount = UR::Invoke<int, void*>(UR::Export::MethodGetParamCount, method);
 					}
 					if (actualParamCount == paramCount) return method;
 				}
 			}
-			currentClass = UR::Invoke<void*, void*>(mono ? "mono_class_get_parent" : "il2cpp_class_get_parent",
+			currentClass = UR::Invoke<void*, void*>(UR::Export::ClassGetParent,
 			                                        currentClass);
 		}
 		return nullptr;
@@ -1781,24 +1893,12 @@ namespace Helper
 		return SafeInvokeSetter(comp, method, &value);
 	}
 
-	bool CaseInsensitiveFind(std::string_view haystack, std::string_view lowerNeedle)
+	size_t AllocationCount()
 	{
-		if (lowerNeedle.empty()) return true;
-		if (haystack.size() < lowerNeedle.size()) return false;
-
-		for (size_t i = 0; i <= haystack.size() - lowerNeedle.size(); ++i)
-		{
-			bool match = true;
-			for (size_t j = 0; j < lowerNeedle.size(); ++j)
-			{
-				if (static_cast<char>(std::tolower(static_cast<unsigned char>(haystack[i + j]))) != lowerNeedle[j])
-				{
-					match = false;
-					break;
-				}
-			}
-			if (match) return true;
-		}
-		return false;
+#ifdef _DEBUG
+		return allocationCount.load(std::memory_order_relaxed);
+#else
+		return 0;
+#endif
 	}
 }
@@ -1,6 +1,7 @@
 #pragma once
 #include "pch.h"
 #include "features/inspector/editable_type.h"
+#include "helper/text_search.h"
 
 namespace Helper
 {
@@ -56,6 +57,11 @@ namespace Helper
 
 	bool SafeReadPointer(void* ptr, int offset, void*& outValue);
 
+	// Bulk reads: the page range is validated once (and remembered for a short while), then copied
+	// under a single guarded frame.
+	bool IsReadableRange(const void* ptr, size_t size);
+	bool SafeReadSpan(const void* ptr, int offset, size_t size, void* out);
+
 	bool SafeGetStaticFieldInt(void* fieldHandle, int& outValue);
 	bool SafeSetStaticFieldInt(void* fieldHandle, int value);
 	bool SafeGetStaticFieldInt64(void* fieldHandle, int64_t& outValue);
@@ -126,5 +132,7 @@ namespace Helper
 
 	bool SafeGetComponentEnabled(UT::Component* comp, bool& outEnabled);
 	bool SafeSetComponentEnabled(UT::Component* comp, bool value);
-	bool CaseInsensitiveFind(std::string_view haystack, std::string_view lowerNeedle);
+
+	// Global operator new calls made by this module so far; always 0 outside debug builds
+	size_t AllocationCount();
 }
@@ -0,0 +1,203 @@
+#include "pch.h"
+#include "text_search.h"
+#include <intrin.h>
+#include <immintrin.h>
+
+namespace
+{
+	constexpr size_t MATCHED = SIZE_MAX;
+
+	constexpr std::array<uint8_t, 256> MakeFoldTable()
+	{
+		std::array<uint8_t, 256> table{};
+		for (size_t i = 0; i < table.size(); i++)
+			table[i] = static_cast<uint8_t>(i >= 'A' && i <= 'Z' ? i | 0x20 : i);
+		return table;
+	}
+
+	constexpr std::array<uint8_t, 256> FOLD = MakeFoldTable();
+
+	struct NeedleView
+	{
+		const char* lower;
+		size_t size;
+		uint8_t first;
+		uint8_t last;
+		uint8_t firstFold;
+		uint8_t lastFold;
+	};
+
+	uint8_t FoldBitFor(const uint8_t c)
+	{
+		return c >= 'a' && c <= 'z' ? 0x20 : 0;
+	}
+
+	NeedleView ViewOf(const std::string_view lowerNeedle)
+	{
+		const auto first = static_cast<uint8_t>(lowerNeedle.front());
+		const auto last = static_cast<uint8_t>(lowerNeedle.back());
+		return {lowerNeedle.data(), lowerNeedle.size(), first, last, FoldBitFor(first), FoldBitFor(last)};
+	}
+
+	// The first and last bytes already matched; compares the ones in between
+	bool MiddleMatches(const char* candidate, const NeedleView& needle)
+	{
+		for (size_t j = 1; j + 1 < needle.size; j++)
+		{
+			if (FOLD[static_cast<uint8_t>(candidate[j])] != static_cast<uint8_t>(needle.lower[j]))
+				return false;
+		}
+		return true;
+	}
+
+	bool ScanRemaining(const char* haystack, const size_t size, const NeedleView& needle, size_t i)
+	{
+		for (; i + needle.size <= size; i++)
+		{
+			if ((static_cast<uint8_t>(haystack[i]) | needle.firstFold) != needle.first) continue;
+			if ((static_cast<uint8_t>(haystack[i + needle.size - 1]) | needle.lastFold) != needle.last) continue;
+			if (MiddleMatches(haystack + i, needle)) return true;
+		}
+		return false;
+	}
+
+	// Each block tests 32 (16) candidate positions at once: the byte at the position must equal the
+	// needle's first byte and the byte needle.size - 1 further on its last byte. Only positions
+	// passing both are compared in full. Returns the first position left unscanned, or MATCHED.
+	size_t ScanAvx2(const char* haystack, const size_t size, const NeedleView& needle, size_t i)
+	{
+		const __m256i first = _mm256_set1_epi8(static_cast<char>(needle.first));
+		const __m256i last = _mm256_set1_epi8(static_cast<char>(needle.last));
+		const __m256i firstFold = _mm256_set1_epi8(static_cast<char>(needle.firstFold));
+		const __m256i lastFold = _mm256_set1_epi8(static_cast<char>(needle.lastFold));
+
+		for (; i + needle.size - 1 + 32 <= size; i += 32)
+		{
+			const __m256i head = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(haystack + i));
+			const __m256i tail = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(haystack + i + needle.size - 1));
+			const __m256i hits = _mm256_and_si256(_mm256_cmpeq_epi8(_mm256_or_si256(head, firstFold), first),
+			                                      _mm256_cmpeq_epi8(_mm256_or_si256(tail, lastFold), last));
+
+			for (auto mask = static_cast<uint32_t>(_mm256_movemask_epi8(hits)); mask; mask &= mask - 1)
+			{
+				if (MiddleMatches(haystack + i + std::countr_zero(mask), needle))
+					return MATCHED;
+			}
+		}
+		return i;
+	}
+
+	size_t ScanSse2(const char* haystack, const size_t size, const NeedleView& needle, size_t i)
+	{
+		const __m128i first = _mm_set1_epi8(static_cast<char>(needle.first));
+		const __m128i last = _mm_set1_epi8(static_cast<char>(needle.last));
+		const __m128i firstFold = _mm_set1_epi8(static_cast<char>(needle.firstFold));
+		const __m128i lastFold = _mm_set1_epi8(static_cast<char>(needle.lastFold));
+
+		for (; i + needle.size - 1 + 16 <= size; i += 16)
+		{
+			const __m128i head = _mm_loadu_si128(reinterpret_cast<const __m128i*>(haystack + i));
+			const __m128i tail = _mm_loadu_si128(reinterpret_cast<const __m128i*>(haystack + i + needle.size - 1));
+			const __m128i hits = _mm_and_si128(_mm_cmpeq_epi8(_mm_or_si128(head, firstFold), first),
+			                                   _mm_cmpeq_epi8(_mm_or_si128(tail, lastFold), last));
+
+			for (auto mask = static_cast<uint32_t>(_mm_movemask_epi8(hits)); mask; mask &= mask - 1)
+			{
+				if (MiddleMatches(haystack + i + std::countr_zero(mask), needle))
+					return MATCHED;
+			}
+		}
+		return i;
+	}
+
+	bool Find(const std::string_view haystack, const NeedleView& needle)
+	{
+		if (haystack.size() < needle.size) return false;
+
+		size_t i = 0;
+		if (haystack.size() >= needle.size - 1 + 32 && Helper::HasAvx2())
+		{
+			i = ScanAvx2(haystack.data(), haystack.size(), needle, i);
+			if (i == MATCHED) return true;
+		}
+		if (haystack.size() >= i + needle.size - 1 + 16)
+		{
+			i = ScanSse2(haystack.data(), haystack.size(), needle, i);
+			if (i == MATCHED) return true;
+		}
+		return ScanRemaining(haystack.data(), haystack.size(), needle, i);
+	}
+
+	bool DetectAvx2()
+	{
+		int info[4] = {};
+		__cpuid(info, 0);
+		if (info[0] < 7)
+			return false;
+
+		__cpuid(info, 1);
+		const bool osxsave = (info[2] & (1 << 27)) != 0;
+		const bool avx = (info[2] & (1 << 28)) != 0;
+		if (!osxsave || !avx || (_xgetbv(0) & 6) != 6)
+			return false;
+
+		__cpuidex(info, 7, 0);
+		return (info[1] & (1 << 5)) != 0;
+	}
+}
+
+namespace Helper
+{
+	SearchNeedle::SearchNeedle(const std::string_view text)
+		: lower(text)
+	{
+		for (char& c : lower)
+			c = static_cast<char>(FOLD[static_cast<uint8_t>(c)]);
+
+		if (lower.empty()) return;
+		const NeedleView view = ViewOf(lower);
+		first = view.first;
+		last = view.last;
+		firstFold = view.firstFold;
+		lastFold = view.lastFold;
+	}
+
+	bool SearchNeedle::FoundIn(const std::string_view haystack) const
+	{
+		if (lower.empty()) return true;
+		return Find(haystack, {lower.data(), lower.size(), first, last, firstFold, lastFold});
+	}
+
+	bool HasAvx2()
+	{
+		static const bool supported = DetectAvx2();
+		return supported;
+	}
+
+	bool CaseInsensitiveFind(const std::string_view haystack, const std::string_view lowerNeedle)
+	{
+		if (lowerNeedle.empty()) return true;
+		return Find(haystack, ViewOf(lowerNeedle));
+	}
+
+	bool CaseInsensitiveFindScalar(const std::string_view haystack, const std::string_view lowerNeedle)
+	{
+		if (lowerNeedle.empty()) return true;
+		if (haystack.size() < lowerNeedle.size()) return false;
+
+		for (size_t i = 0; i <= haystack.size() - lowerNeedle.size(); ++i)
+		{
+			bool match = true;
+			for (size_t j = 0; j < lowerNeedle.size(); ++j)
+			{
+				if (static_cast<char>(std::tolower(static_cast<unsigned char>(haystack[i + j]))) != lowerNeedle[j])
+				{
+					match = false;
+					break;
+				}
+			}
+			if (match) return true;
+		}
+		return false;
+	}
+}
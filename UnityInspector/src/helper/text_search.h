@@ -0,0 +1,34 @@
+#pragma once
+#include <string>
+#include <string_view>
+
+namespace Helper
+{
+	// A search box's text, ASCII-lowercased once and prepared for the vectorized substring scan.
+	// Build one per frame (or per filter change) and test every candidate against it.
+	class SearchNeedle
+	{
+	public:
+		SearchNeedle() = default;
+		explicit SearchNeedle(std::string_view text);
+
+		[[nodiscard]] bool Empty() const { return lower.empty(); }
+		[[nodiscard]] const std::string& Lower() const { return lower; }
+
+		// True when the needle occurs in `haystack` ignoring ASCII case; an empty needle matches everything
+		[[nodiscard]] bool FoundIn(std::string_view haystack) const;
+
+	private:
+		std::string lower;
+		// First and last needle bytes and the bit OR-ed into haystack bytes before comparing them:
+		// 0x20 for letters (folds 'A'..'Z' onto 'a'..'z'), 0 otherwise
+		unsigned char first = 0;
+		unsigned char last = 0;
+		unsigned char firstFold = 0;
+		unsigned char lastFold = 0;
+	};
+
+	bool HasAvx2();
+	bool CaseInsensitiveFind(std::string_view haystack, std::string_view lowerNeedle);
+	bool CaseInsensitiveFindScalar(std::string_view haystack, std::string_view lowerNeedle);
+}
@@ -10,6 +10,13 @@
 
 namespace Loader
 {
+	static double GetWorkingSetMB()
+	{
+		PROCESS_MEMORY_COUNTERS counters{};
+		if (!GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) return 0.0;
+		return static_cast<double>(counters.WorkingSetSize) / (1024.0 * 1024.0);
+	}
+
 	static DWORD WINAPI OverlayInitThread(LPVOID)
 	{
 		if (!Config::settings.ini.internal_overlay && !Config::settings.ini.external_overlay)
@@ -89,7 +96,34 @@ namespace Loader
 		if (Config::settings.ini.debug_console) console::StartConsole("Debug Console", false);
 		LOG_INFO("loaded, initializing...");
 
+		UR::SetLazyMembers(Config::settings.ini.lazy_metadata);
+		UR::SetInitWorkers(Config::settings.ini.parallel_metadata ? std::thread::hardware_concurrency() : 0);
+		if (Config::settings.ini.metadata_cache)
+		{
+			char buffer[MAX_PATH];
+			GetModuleFileNameA(nullptr, buffer, MAX_PATH);
+			UR::SetMetadataCache((std::filesystem::path(buffer).parent_path() / "metadata.cache").string());
+		}
+
+		const double workingSetBefore = GetWorkingSetMB();
+		const auto initStart = std::chrono::steady_clock::now();
 		UR::Init(Config::state.gameHandle, Config::state.unityMode);
+		const auto initMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - initStart).count();
+		const double workingSetAfter = GetWorkingSetMB();
+
+		size_t classCount = 0;
+		for (const auto& assembly : UR::assembly) classCount += assembly->classes.size();
+		for (const auto& [name, classes, milliseconds] : UR::GetImageTimings())
+		{
+			if (!name.empty()) LOG_DEBUG("  {:<48} {:>6} classes {:>9.2f} ms", name, classes, milliseconds);
+		}
+		LOG_INFO("metadata: {} assemblies, {} classes in {:.1f} ms ({} {:.1f} ms on {} thread(s), {} members), working set {:.1f} MB -> {:.1f} MB",
+		         UR::assembly.size(), classCount, initMs, UR::LoadedFromCache() ? "cache load" : "walk",
+		         UR::GetWalkMilliseconds(), UR::GetInitWorkersUsed(), UR::LazyMembers() ? "lazy" : "eager",
+		         workingSetBefore, workingSetAfter);
+		LOG_INFO("metadata: {} interned names in {:.1f} KB", UR::GetStringPool().Count(),
+		         static_cast<double>(UR::GetStringPool().Bytes()) / 1024.0);
+
 		Hooks::Init();
 		Features::Init();
 
@@ -32,5 +32,13 @@ void DebugTab::Render()
 	ImGui::Checkbox("Show Memory Scanner", &Config::settings.memoryScanner.showWindow);
 	if (ImGui::IsItemHovered()) ImGui::SetTooltip("Open a memory scanner window to scan specific values");
 
+	ImGui::Spacing();
+	ImGui::Separator();
+	ImGui::Spacing();
+
+	ImGui::Text("Benchmarks");
+	ImGui::Checkbox("Show Benchmarks", &Config::settings.tests.showWindow);
+	if (ImGui::IsItemHovered()) ImGui::SetTooltip("Open a benchmark window to time internal hot paths");
+
 	ImGui::EndChild();
 }
@@ -13,9 +13,11 @@
 #include <dwmapi.h>
 #include <winhttp.h>
 #include <shellapi.h>
+#include <psapi.h>
 #pragma comment(lib, "dwmapi")
 #pragma comment(lib, "winhttp.lib")
 #pragma comment(lib, "shell32.lib")
+#pragma comment(lib, "psapi.lib")
 
 // std
 #include <cstdio>
@@ -34,11 +36,13 @@
 #include <array>
 #include <utility>
 #include <mutex>
+#include <shared_mutex>
 #include <atomic>
 #include <memory>
 #include <string>
 #include <cctype>
 #include <numbers>
+#include <bit>
 
 // Graphics
 #include <d3d11.h>